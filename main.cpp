@@ -8,6 +8,8 @@
 #include "core/scene.hpp"
 #include "core/scene_manager.hpp"
 #include "scenes/game_scene.hpp"
+#include "gameplay/preflop_table.hpp"
+#include "gameplay/strategy_table.hpp"
 #include "raylib.h"
 #include <string>
 
@@ -17,13 +19,6 @@ Scene* CreateDeathScene(PhysicsWorld* physics);
 // Global debug flag
 bool g_showCollisionDebug = false;
 
-// Helper function to check if a type hierarchy contains a component
-inline bool TypeContains(const std::string& type, const std::string& component) {
-    return type.find("_" + component) != std::string::npos ||
-           type.find(component + "_") != std::string::npos ||
-           type == component;
-}
-
 int main(void)
 {
     // Initialization
@@ -39,6 +34,16 @@ int main(void)
     LightingManager::InitLightingSystem();
     PsychedelicManager::InitPsychedelicSystem();
 
+    // Preflop equity table for the AI (optional - without it enemies run Monte Carlo preflop too)
+    if (!PreflopTable::GetGlobal()->Open(PREFLOP_TABLE_PATH)) {
+        TraceLog(LOG_WARNING, "Preflop table %s not loaded (run `make preflop-table`)", PREFLOP_TABLE_PATH);
+    }
+
+    // Trained strategy for enemy decisions (optional - without it they use the equity rule)
+    if (!StrategyTable::GetGlobal()->Open(STRATEGY_TABLE_PATH)) {
+        TraceLog(LOG_WARNING, "Strategy table %s not loaded (run `make strategy-table`)", STRATEGY_TABLE_PATH);
+    }
+
     // Initialize DOM (main owns this)
     DOM dom;
     DOM::SetGlobal(&dom);
@@ -60,10 +65,8 @@ int main(void)
     // Get player reference for rendering
     Player* player = nullptr;
     for (int i = 0; i < dom.GetCount(); i++) {
-        if (TypeContains(dom.GetObject(i)->GetType(), "player")) {
-            player = static_cast<Player*>(dom.GetObject(i));
-            break;
-        }
+        player = dom.GetObject(i)->As<Player>();
+        if (player) break;
     }
 
     // Create render texture for psychedelic post-processing
@@ -101,18 +104,20 @@ int main(void)
         }
 
         // Update all light sources
-        for (int i = 0; i < dom.GetCount(); i++) {
-            Object* obj = dom.GetObject(i);
-            if (TypeContains(obj->GetType(), "light")) {
-                Light* light = static_cast<Light*>(obj);
-                light->UpdateLight();
-            }
+        for (Object* obj : dom.GetCategory(CATEGORY_LIGHTS)) {
+            static_cast<Light*>(obj)->UpdateLight();
         }
 
-        // Update all objects
+        // Update all objects (adds and removes they make are applied at the Sync below)
+        dom.BeginDeferred();
         for (int i = 0; i < dom.GetCount(); i++) {
-            dom.GetObject(i)->Update(deltaTime);
+            Object* obj = dom.GetObject(i);
+            if (obj) obj->Update(deltaTime);
         }
+        dom.Sync();
+
+        // Re-bucket anything that moved so next frame's proximity and ray queries see it
+        dom.UpdateSpatialIndex();
 
         // Update psychedelic effect
         PsychedelicManager::Update(deltaTime);
@@ -135,21 +140,15 @@ int main(void)
             // Draw objects with lighting
             if (lightingShader.id != 0) {
                 BeginShaderMode(lightingShader);
-                for (int i = 0; i < dom.GetCount(); i++) {
-                    Object* obj = dom.GetObject(i);
-                    // Skip unlit objects
-                    if (!obj->usesLighting) continue;
+                for (Object* obj : dom.GetCategory(CATEGORY_LIT)) {
                     obj->Draw(*camera);
                 }
                 EndShaderMode();
             }
 
             // Draw unlit objects
-            for (int i = 0; i < dom.GetCount(); i++) {
-                Object* obj = dom.GetObject(i);
-                if (!obj->usesLighting) {
-                    obj->Draw(*camera);
-                }
+            for (Object* obj : dom.GetCategory(CATEGORY_UNLIT)) {
+                obj->Draw(*camera);
             }
 
             // Draw held item (needs to be in 3D mode)
@@ -1,32 +1,75 @@
 #include "core/dom.hpp"
 #include "raylib.h"
+#include <algorithm>
+#include <functional>
 
 // Initialize static member
 DOM* DOM::globalInstance = nullptr;
 
-DOM::DOM() {
+DOM::DOM() : spatialIndexEnabled(true), deferring(false) {
 }
 
 DOM::~DOM() {
     Cleanup();
 }
 
+// A slot only counts if this DOM's list agrees - slots left over from another DOM or a Cleanup are ignored
+static bool IsListed(const std::vector<Object*>& list, const Object* obj, int slot) {
+    return slot >= 0 && slot < (int)list.size() && list[slot] == obj;
+}
+
 void DOM::AddObject(Object* obj) {
     if (obj == nullptr) {
         TraceLog(LOG_ERROR, "DOM::AddObject: obj is nullptr!");
         return;
     }
-    
+
+    if (deferring) {
+        pendingAdds.push_back(obj->GetHandle());
+        return;
+    }
+    Insert(obj);
+}
+
+void DOM::Insert(Object* obj) {
+    if (IsListed(objects, obj, obj->domSlot)) return;
+
+    obj->domSlot = objects.size();
     objects.push_back(obj);
+    LinkCategories(obj);
+    if (spatialIndexEnabled) spatialIndex.Insert(obj);
+}
+
+void DOM::Reserve(int extra) {
+    if (deferring) pendingAdds.reserve(pendingAdds.size() + extra);
+    else objects.reserve(objects.size() + extra);
 }
 
 void DOM::RemoveObject(Object* obj) {
-    for (size_t i = 0; i < objects.size(); i++) {
-        if (objects[i] == obj) {
-            objects.erase(objects.begin() + i);
-            return;
-        }
+    if (!obj) return;
+
+    int slot = obj->domSlot;
+    if (!IsListed(objects, obj, slot)) {
+        // Added during this deferred pass - just drop the pending add
+        ObjectHandle handle = obj->GetHandle();
+        pendingAdds.erase(std::remove(pendingAdds.begin(), pendingAdds.end(), handle), pendingAdds.end());
+        return;
+    }
+
+    obj->domSlot = -1;
+    UnlinkCategories(obj);
+    spatialIndex.Remove(obj);
+
+    if (deferring) {
+        objects[slot] = nullptr;
+        vacatedSlots.push_back(slot);
+        return;
     }
+
+    Object* last = objects.back();
+    objects[slot] = last;
+    objects.pop_back();
+    if (last != obj) last->domSlot = slot;
 }
 
 void DOM::RemoveAndDelete(Object* obj) {
@@ -34,6 +77,33 @@ void DOM::RemoveAndDelete(Object* obj) {
     delete obj;
 }
 
+// ========== DEFERRED CHANGES ==========
+
+void DOM::BeginDeferred() {
+    deferring = true;
+}
+
+void DOM::Sync() {
+    deferring = false;
+
+    // Fill gaps from the back; going from the highest slot down, the last object is never a gap
+    // unless it is the slot being filled
+    std::sort(vacatedSlots.begin(), vacatedSlots.end(), std::greater<int>());
+    for (int slot : vacatedSlots) {
+        Object* last = objects.back();
+        objects[slot] = last;
+        objects.pop_back();
+        if (last) last->domSlot = slot;
+    }
+    vacatedSlots.clear();
+
+    for (ObjectHandle handle : pendingAdds) {
+        Object* obj = Resolve(handle);
+        if (obj) Insert(obj);
+    }
+    pendingAdds.clear();
+}
+
 Object* DOM::FindObjectByID(int id) {
     for (Object* obj : objects) {
         if (obj && obj->GetID() == id) {
@@ -44,9 +114,163 @@ Object* DOM::FindObjectByID(int id) {
 }
 
 void DOM::Cleanup() {
+    // Objects may already be deleted here, so their slots are left alone (see IsListed)
     objects.clear();
+    for (int c = 0; c < CATEGORY_COUNT; c++) categories[c].clear();
+    spatialIndex.Clear();
+    pendingAdds.clear();
+    vacatedSlots.clear();
+    deferring = false;
 }
 
+// ========== CATEGORIES ==========
+
+bool DOM::BelongsTo(const Object* obj, ObjectCategory category) {
+    switch (category) {
+    case CATEGORY_LIGHTS:           return obj->IsA(TYPE_LIGHT);
+    case CATEGORY_INTERACTABLES:    return obj->IsA(TYPE_INTERACTABLE);
+    case CATEGORY_STATIC_COLLIDERS: return (obj->GetTypeMask() & (TypeBit(TYPE_WALL) | TypeBit(TYPE_POKER_TABLE))) != 0;
+    case CATEGORY_POKER_TABLES:     return obj->IsA(TYPE_POKER_TABLE);
+    case CATEGORY_LIT:              return obj->usesLighting;
+    case CATEGORY_UNLIT:            return !obj->usesLighting;
+    default:                        return false;
+    }
+}
+
+void DOM::LinkCategories(Object* obj) {
+    for (int c = 0; c < CATEGORY_COUNT; c++) {
+        std::vector<Object*>& list = categories[c];
+        if (IsListed(list, obj, obj->categorySlots[c])) continue;
+        if (!BelongsTo(obj, (ObjectCategory)c)) {
+            obj->categorySlots[c] = -1;
+            continue;
+        }
+        obj->categorySlots[c] = list.size();
+        list.push_back(obj);
+    }
+}
+
+void DOM::UnlinkCategories(Object* obj) {
+    for (int c = 0; c < CATEGORY_COUNT; c++) {
+        std::vector<Object*>& list = categories[c];
+        int slot = obj->categorySlots[c];
+        obj->categorySlots[c] = -1;
+        if (!IsListed(list, obj, slot)) continue;
+
+        list[slot] = list.back();
+        list[slot]->categorySlots[c] = slot;
+        list.pop_back();
+    }
+}
+
+// ========== SPATIAL QUERIES ==========
+
+void DOM::SetSpatialIndexEnabled(bool enabled) {
+    if (enabled == spatialIndexEnabled) return;
+    spatialIndexEnabled = enabled;
+    spatialIndex.Clear();
+    if (enabled) {
+        for (Object* obj : objects) {
+            if (obj) spatialIndex.Insert(obj);
+        }
+    }
+}
+
+void DOM::UpdateSpatialIndex() {
+    if (!spatialIndexEnabled) return;
+    spatialIndex.RefreshAll();
+}
+
+void DOM::QuerySphere(Vector3 center, float radius, std::vector<Object*>& out, TypeMask types) {
+    if (spatialIndexEnabled) {
+        spatialIndex.QuerySphere(center, radius, out, types);
+        return;
+    }
+    out.clear();
+    for (Object* obj : objects) {
+        if (obj && (obj->GetTypeMask() & types) && SpatialGrid::SphereTouches(obj, center, radius)) out.push_back(obj);
+    }
+}
+
+void DOM::QueryCone(Vector3 origin, Vector3 direction, float range, float halfAngle,
+                    std::vector<Object*>& out, TypeMask types) {
+    if (spatialIndexEnabled) {
+        spatialIndex.QueryCone(origin, direction, range, halfAngle, out, types);
+        return;
+    }
+    out.clear();
+    for (Object* obj : objects) {
+        if (obj && (obj->GetTypeMask() & types) && SpatialGrid::ConeTouches(obj, origin, direction, range, halfAngle)) {
+            out.push_back(obj);
+        }
+    }
+}
+
+void DOM::QueryRay(Vector3 origin, Vector3 direction, float maxDistance, float radius,
+                   std::vector<Object*>& out, TypeMask types) {
+    if (spatialIndexEnabled) {
+        spatialIndex.QueryRay(origin, direction, maxDistance, radius, out, types);
+        return;
+    }
+    out.clear();
+    for (Object* obj : objects) {
+        if (obj && (obj->GetTypeMask() & types) && SpatialGrid::RayTouches(obj, origin, direction, maxDistance, radius)) {
+            out.push_back(obj);
+        }
+    }
+}
+
+// ========== HANDLES ==========
+
+struct HandleSlot {
+    Object* object;        // nullptr while the slot is free
+    uint32_t generation;
+};
+
+// Function statics, so objects built during static initialization still find the table
+static std::vector<HandleSlot>& HandleSlots() {
+    static std::vector<HandleSlot> slots;
+    return slots;
+}
+
+static std::vector<uint32_t>& FreeHandleSlots() {
+    static std::vector<uint32_t> freeSlots;
+    return freeSlots;
+}
+
+ObjectHandle DOM::AcquireHandle(Object* obj) {
+    std::vector<HandleSlot>& slots = HandleSlots();
+    std::vector<uint32_t>& freeSlots = FreeHandleSlots();
+
+    if (freeSlots.empty()) {
+        slots.push_back({obj, 1});
+        return ObjectHandle((uint32_t)(slots.size() - 1), 1);
+    }
+
+    uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    slots[slot].object = obj;
+    return ObjectHandle(slot, slots[slot].generation);
+}
+
+void DOM::ReleaseHandle(ObjectHandle handle) {
+    if (!Resolve(handle)) return;
+
+    HandleSlot& entry = HandleSlots()[handle.slot];
+    entry.object = nullptr;
+    if (++entry.generation == 0) entry.generation = 1;   // 0 is the null handle
+    FreeHandleSlots().push_back(handle.slot);
+}
+
+Object* DOM::Resolve(ObjectHandle handle) {
+    const std::vector<HandleSlot>& slots = HandleSlots();
+    if (handle.IsNull() || handle.slot >= slots.size()) return nullptr;
+    const HandleSlot& entry = slots[handle.slot];
+    return entry.generation == handle.generation ? entry.object : nullptr;
+}
+
+// ========== GLOBAL ==========
+
 void DOM::SetGlobal(DOM* dom) {
     globalInstance = dom;
 }
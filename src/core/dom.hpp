@@ -2,29 +2,93 @@
 #define DOM_HPP
 
 #include "core/object.hpp"
+#include "core/spatial_grid.hpp"
 #include <vector>
 
 // DOM - Document Object Model (manages all objects in the scene)
 class DOM {
 private:
-    std::vector<Object*> objects;
+    std::vector<Object*> objects;   // nullptr where an object was removed while deferring (until Sync)
+    std::vector<Object*> categories[CATEGORY_COUNT];
+    SpatialGrid spatialIndex;
+    bool spatialIndexEnabled;
     static DOM* globalInstance;
 
+    // Structural changes made between BeginDeferred and Sync
+    bool deferring;
+    std::vector<ObjectHandle> pendingAdds;   // Handles, so objects deleted before Sync are skipped
+    std::vector<int> vacatedSlots;
+
+    void Insert(Object* obj);
+    void Reserve(int extra);
+
+    static bool BelongsTo(const Object* obj, ObjectCategory category);
+    void LinkCategories(Object* obj);
+    void UnlinkCategories(Object* obj);
+
 public:
     DOM();
     ~DOM();
 
+    // O(1): each object keeps its index, and removal moves the last object into the gap
     void AddObject(Object* obj);
     void RemoveObject(Object* obj);
     void RemoveAndDelete(Object* obj);  // Helper: removes from DOM and deletes
     void Cleanup();
-    
+
+    // Same as adding/removing one at a time, with the lists grown once per batch
+    template <typename T> void AddObjects(const std::vector<T*>& batch) {
+        Reserve(batch.size());
+        for (T* obj : batch) {
+            if (obj) AddObject(obj);
+        }
+    }
+    template <typename T> void RemoveObjects(const std::vector<T*>& batch) {
+        for (T* obj : batch) RemoveObject(obj);
+    }
+
+    // Between BeginDeferred and Sync the object list keeps its shape, so a loop over it can add and
+    // remove objects safely: adds wait for Sync, and a removed object leaves a nullptr in its slot
+    // (it is gone from categories and queries right away, and may be deleted at once)
+    void BeginDeferred();
+    void Sync();
+    bool IsDeferring() const { return deferring; }
+
     // Accessors
     int GetCount() const { return objects.size(); }
-    Object* GetObject(int index) { return objects[index]; }
+    Object* GetObject(int index) { return objects[index]; }   // nullptr for slots vacated while deferring
     Object* FindObjectByID(int id);
     const std::vector<Object*>& GetObjects() const { return objects; }
+
+    // Objects in one category (see ObjectCategory), kept current by Add/Remove. Membership is decided
+    // when an object is added; removal swaps the last member into the gap, so order is not kept
+    const std::vector<Object*>& GetCategory(ObjectCategory category) const { return categories[category]; }
+
+    // Spatial queries - clear `out` and fill it with objects matching `types` whose bounding sphere
+    // touches the shape. Served by the spatial index when enabled, by a scan over every object otherwise
+    void QuerySphere(Vector3 center, float radius, std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+    void QueryCone(Vector3 origin, Vector3 direction, float range, float halfAngle,
+                   std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+    void QueryRay(Vector3 origin, Vector3 direction, float maxDistance, float radius,
+                  std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+
+    // Spatial index (on by default). Objects are bucketed by position when added; call
+    // UpdateSpatialIndex once per frame after objects move so queries see where they are now
+    void SetSpatialIndexEnabled(bool enabled);
+    bool IsSpatialIndexEnabled() const { return spatialIndexEnabled; }
+    void UpdateSpatialIndex();
     
+    // Generational handles (see ObjectHandle). Every Object takes one when constructed and releases it
+    // when destroyed, whether or not it is in a DOM; resolving is O(1) and stale handles give nullptr.
+    // Objects are created and destroyed on the main thread only
+    static ObjectHandle AcquireHandle(Object* obj);
+    static void ReleaseHandle(ObjectHandle handle);
+    static Object* Resolve(ObjectHandle handle);
+    template <typename T> static T* Resolve(ObjectHandle handle) {
+        Object* obj = Resolve(handle);
+        return obj ? obj->As<T>() : nullptr;
+    }
+
     // Global instance management
     static void SetGlobal(DOM* dom);
     static DOM* GetGlobal();
@@ -0,0 +1,67 @@
+#include "core/mapped_file.hpp"
+#include <cstdio>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : data(nullptr), size(0), mapped(false) {}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path, bool sequential) {
+    Close();
+
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file alive
+    if (view == MAP_FAILED) return false;
+
+    madvise(view, static_cast<size_t>(info.st_size), sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    data = static_cast<const unsigned char*>(view);
+    size = static_cast<size_t>(info.st_size);
+    mapped = true;
+#else
+    (void)sequential;
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (length <= 0) {
+        fclose(f);
+        return false;
+    }
+    fallback.resize(static_cast<size_t>(length));
+    size_t got = fread(fallback.data(), 1, fallback.size(), f);
+    fclose(f);
+    data = fallback.data();
+    size = got;
+#endif
+
+    return true;
+}
+
+void MappedFile::Close() {
+#ifndef _WIN32
+    if (mapped && data) munmap(const_cast<unsigned char*>(data), size);
+#endif
+    fallback.clear();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
@@ -0,0 +1,34 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Read-only view of a whole file: memory-mapped on POSIX, read into memory elsewhere
+// Data stays valid until Close() or destruction; callers point straight into it
+class MappedFile {
+private:
+    const unsigned char* data;
+    size_t size;
+    bool mapped;
+    std::vector<unsigned char> fallback;   // Platforms without mmap read the file into memory
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // sequential = hint that the file is read front to back once (otherwise random access is expected)
+    bool Open(const std::string& path, bool sequential = false);
+    void Close();
+
+    // Accessors
+    const unsigned char* GetData() const { return data; }
+    size_t GetSize() const { return size; }
+    bool IsOpen() const { return data != nullptr; }
+};
+
+#endif
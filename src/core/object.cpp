@@ -1,18 +1,45 @@
 #include "core/object.hpp"
+#include "core/dom.hpp"
 
 // Static ID counter
 int Object::nextID = 1;
 
 Object::Object(Vector3 pos)
     : id(nextID++)
+    , handle(DOM::AcquireHandle(this))
+    , domSlot(-1)
     , position(pos)
     , rotation({0.0f, 0.0f, 0.0f})
     , scale({1.0f, 1.0f, 1.0f})
     , usesLighting(true)  // Default: objects use lighting
-{}
+{
+    for (int c = 0; c < CATEGORY_COUNT; c++) categorySlots[c] = -1;
+}
+
+Object::Object(const Object& other)
+    : id(other.id)
+    , handle(DOM::AcquireHandle(this))
+    , domSlot(-1)
+    , position(other.position)
+    , rotation(other.rotation)
+    , scale(other.scale)
+    , usesLighting(other.usesLighting)
+{
+    for (int c = 0; c < CATEGORY_COUNT; c++) categorySlots[c] = -1;
+}
+
+Object& Object::operator=(const Object& other) {
+    id = other.id;
+    position = other.position;
+    rotation = other.rotation;
+    scale = other.scale;
+    usesLighting = other.usesLighting;
+    return *this;
+}
 
 Object::~Object() {
-    // Nothing to clean up - DOM manages lifetime
+    // DOM manages lifetime; just make every handle to this object stale
+    DOM::ReleaseHandle(handle);
 }
 
 void Object::Update(float deltaTime) {
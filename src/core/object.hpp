@@ -2,30 +2,68 @@
 #define OBJECT_HPP
 
 #include "raylib.h"
+#include "core/type_id.hpp"
+#include "core/object_handle.hpp"
 #include <string>
 
+// Lists a DOM keeps up to date on add/remove, so per-frame passes only visit the objects they need
+enum ObjectCategory {
+    CATEGORY_LIGHTS = 0,
+    CATEGORY_INTERACTABLES,
+    CATEGORY_STATIC_COLLIDERS,   // Walls and poker tables
+    CATEGORY_POKER_TABLES,
+    CATEGORY_LIT,                // Drawn with the lighting shader (usesLighting when added)
+    CATEGORY_UNLIT,
+    CATEGORY_COUNT
+};
+
 class Object {
 private:
+    friend class DOM;
+
     static int nextID;
     int id;
+    ObjectHandle handle;   // Taken from DOM's handle table for the object's lifetime
+    int domSlot;           // Index in the DOM's object list (-1 = not in one)
+    int categorySlots[CATEGORY_COUNT];   // Index in the DOM's list per category (-1 = not listed)
 
 public:
+    static constexpr ObjectTypeId TYPE_ID = TYPE_OBJECT;
+    static constexpr TypeMask TYPE_MASK = TypeBit(TYPE_OBJECT);
+
     Vector3 position;
     Vector3 rotation;
     Vector3 scale;
     bool usesLighting;  // Whether this object should be rendered with lighting shader (default: true)
 
     Object(Vector3 pos = {0.0f, 0.0f, 0.0f});
+    Object(const Object& other);              // A copy is a new object with its own handle
+    Object& operator=(const Object& other);   // Keeps this object's handle
     virtual ~Object();
 
     virtual void Update(float deltaTime);
     virtual void Draw(Camera3D camera);
+    // Hierarchical name for logs and debugging; builds a string, so keep it out of per-frame code
     virtual std::string GetType() const;
+
+    // Type checks without strings (see DECLARE_OBJECT_TYPE)
+    virtual ObjectTypeId GetTypeId() const { return TYPE_ID; }
+    virtual TypeMask GetTypeMask() const { return TYPE_MASK; }
+    bool IsA(ObjectTypeId type) const { return (GetTypeMask() & TypeBit(type)) != 0; }
+    template <typename T> bool IsA() const { return IsA(T::TYPE_ID); }
+
+    // This object as a T, or nullptr if it is not one
+    template <typename T> T* As() { return IsA<T>() ? static_cast<T*>(this) : nullptr; }
+    template <typename T> const T* As() const { return IsA<T>() ? static_cast<const T*>(this) : nullptr; }
     
+    // Radius of a sphere around position that encloses the object (spatial queries); 0 = a point
+    virtual float GetBoundingRadius() const { return 0.0f; }
+
     // Clone this object at a new position (for spawning)
     virtual Object* Clone(Vector3 newPos) const;
     
     int GetID() const { return id; }
+    ObjectHandle GetHandle() const { return handle; }   // Resolves to this object until it is destroyed
 };
 
 #endif
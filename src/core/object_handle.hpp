@@ -0,0 +1,28 @@
+#ifndef OBJECT_HANDLE_HPP
+#define OBJECT_HANDLE_HPP
+
+#include <cstdint>
+
+// Weak reference to an Object: a slot in DOM's handle table plus the generation the slot had when
+// the object took it. The slot's generation moves on when the object is destroyed, so an old handle
+// resolves to nullptr instead of dangling (see DOM::Resolve)
+struct ObjectHandle {
+    uint32_t slot;
+    uint32_t generation;   // 0 = null handle, live slots never use it
+
+    ObjectHandle() : slot(0), generation(0) {}
+    ObjectHandle(uint32_t s, uint32_t g) : slot(s), generation(g) {}
+
+    bool IsNull() const { return generation == 0; }
+
+    // One 64-bit value, e.g. for hashing or storing outside the game
+    uint64_t Pack() const { return ((uint64_t)generation << 32) | slot; }
+    static ObjectHandle Unpack(uint64_t packed) {
+        return ObjectHandle((uint32_t)(packed & 0xFFFFFFFFu), (uint32_t)(packed >> 32));
+    }
+
+    bool operator==(const ObjectHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const ObjectHandle& other) const { return !(*this == other); }
+};
+
+#endif
@@ -7,6 +7,8 @@
 
 class RigidBody : public Object {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_RIGIDBODY, Object)
+
     dBodyID body;
     dGeomID geom;
     PhysicsWorld* physics;
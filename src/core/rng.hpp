@@ -0,0 +1,70 @@
+#ifndef RNG_HPP
+#define RNG_HPP
+
+#include <cstdint>
+#include <random>
+
+// Small, fast, seedable generator (xoshiro256**) for shuffles and simulations
+// Same seed = same sequence on every platform, so a hand can be replayed from its seed
+// Also satisfies UniformRandomBitGenerator, so it can drive std::shuffle etc.
+class Rng {
+private:
+    uint64_t state[4];
+
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    typedef uint64_t result_type;
+
+    explicit Rng(uint64_t seed = 0) { Seed(seed); }
+
+    // Expand one 64-bit seed into the full state (SplitMix64, as recommended for xoshiro)
+    void Seed(uint64_t seed) {
+        uint64_t s = seed;
+        for (int i = 0; i < 4; i++) {
+            state[i] = SplitMix64(s);
+        }
+    }
+
+    uint64_t Next() {
+        uint64_t result = Rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = Rotl(state[3], 45);
+        return result;
+    }
+
+    uint32_t Next32() { return static_cast<uint32_t>(Next() >> 32); }
+
+    // Uniform integer in [0, bound) - multiply-shift, no division
+    uint32_t Below(uint32_t bound) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(Next32()) * bound) >> 32);
+    }
+
+    // Uniform double in [0, 1)
+    double NextDouble() { return (Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    // UniformRandomBitGenerator interface
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+    result_type operator()() { return Next(); }
+
+    // Helpers
+    static uint64_t SplitMix64(uint64_t& s) {
+        uint64_t z = (s += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    static uint64_t RandomSeed() {
+        std::random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) | rd();
+    }
+};
+
+#endif
@@ -0,0 +1,306 @@
+#include "core/spatial_grid.hpp"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+#define SPATIAL_KEY_BITS 21                  // Bits per axis in a packed cell key
+#define SPATIAL_KEY_MASK 0x1FFFFFull
+#define SPATIAL_WIDE_CONE 0.785398f          // Half angles past 45 degrees search the cone's bounding sphere
+
+SpatialGrid::SpatialGrid(float size)
+    : cellSize(size > 0.0f ? size : SPATIAL_CELL_SIZE)
+    , looseMargin(cellSize * 0.5f)
+    , queryStamp(0)
+    , hasBounds(false)
+{
+    for (int axis = 0; axis < 3; axis++) {
+        minCell[axis] = 0;
+        maxCell[axis] = 0;
+    }
+}
+
+// ========== BUCKETS ==========
+
+int SpatialGrid::CellCoord(float v) const {
+    return (int)floorf(v / cellSize);
+}
+
+uint64_t SpatialGrid::PackKey(int x, int y, int z) {
+    return ((uint64_t)(x & SPATIAL_KEY_MASK) << (2 * SPATIAL_KEY_BITS)) |
+           ((uint64_t)(y & SPATIAL_KEY_MASK) << SPATIAL_KEY_BITS) |
+           (uint64_t)(z & SPATIAL_KEY_MASK);
+}
+
+uint64_t SpatialGrid::KeyFor(Vector3 pos) const {
+    return PackKey(CellCoord(pos.x), CellCoord(pos.y), CellCoord(pos.z));
+}
+
+bool SpatialGrid::IsLarge(const Object* obj) const {
+    return obj->GetBoundingRadius() > looseMargin;
+}
+
+void SpatialGrid::Link(const Entry& entry) {
+    if (entry.large) {
+        large.push_back(entry.obj);
+        return;
+    }
+
+    Cell& cell = cells[entry.key];
+    cell.objects.push_back(entry.obj);
+
+    Vector3 pos = entry.obj->position;
+    int coord[3] = {CellCoord(pos.x), CellCoord(pos.y), CellCoord(pos.z)};
+    for (int axis = 0; axis < 3; axis++) {
+        if (!hasBounds || coord[axis] < minCell[axis]) minCell[axis] = coord[axis];
+        if (!hasBounds || coord[axis] > maxCell[axis]) maxCell[axis] = coord[axis];
+    }
+    hasBounds = true;
+}
+
+// Order inside a bucket does not matter, so removal swaps with the last element
+static void SwapRemove(std::vector<Object*>& list, Object* obj) {
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i] == obj) {
+            list[i] = list.back();
+            list.pop_back();
+            return;
+        }
+    }
+}
+
+void SpatialGrid::Unlink(const Entry& entry) {
+    if (entry.large) {
+        SwapRemove(large, entry.obj);
+        return;
+    }
+
+    auto it = cells.find(entry.key);
+    if (it == cells.end()) return;
+    SwapRemove(it->second.objects, entry.obj);
+    if (it->second.objects.empty()) cells.erase(it);
+}
+
+void SpatialGrid::Rebucket(Entry& entry) {
+    uint64_t key = KeyFor(entry.obj->position);
+    bool isLarge = IsLarge(entry.obj);
+    if (isLarge == entry.large && (isLarge || key == entry.key)) return;
+
+    Unlink(entry);
+    entry.key = key;
+    entry.large = isLarge;
+    Link(entry);
+}
+
+void SpatialGrid::Insert(Object* obj) {
+    if (!obj) return;
+    auto it = entryIndex.find(obj);
+    if (it != entryIndex.end()) {
+        Rebucket(entries[it->second]);
+        return;
+    }
+
+    Entry entry = {obj, KeyFor(obj->position), IsLarge(obj)};
+    Link(entry);
+    entryIndex[obj] = entries.size();
+    entries.push_back(entry);
+}
+
+void SpatialGrid::Remove(Object* obj) {
+    auto it = entryIndex.find(obj);
+    if (it == entryIndex.end()) return;
+
+    int index = it->second;
+    Unlink(entries[index]);
+    entryIndex.erase(it);
+
+    // Keep the entry list dense: the last entry takes the removed one's place
+    if (index != (int)entries.size() - 1) {
+        entries[index] = entries.back();
+        entryIndex[entries[index].obj] = index;
+    }
+    entries.pop_back();
+}
+
+void SpatialGrid::Refresh(Object* obj) {
+    auto it = entryIndex.find(obj);
+    if (it != entryIndex.end()) Rebucket(entries[it->second]);
+}
+
+void SpatialGrid::RefreshAll() {
+    for (Entry& entry : entries) Rebucket(entry);
+}
+
+void SpatialGrid::Clear() {
+    cells.clear();
+    entries.clear();
+    entryIndex.clear();
+    large.clear();
+    hasBounds = false;
+}
+
+// ========== TRAVERSAL ==========
+
+template <typename Visit>
+void SpatialGrid::ForEachCell(Vector3 lo, Vector3 hi, Visit visit) {
+    if (!hasBounds) return;
+
+    // Clamp the box to occupied cells so huge shapes cost no more than the grid itself
+    int from[3] = {CellCoord(lo.x), CellCoord(lo.y), CellCoord(lo.z)};
+    int to[3] = {CellCoord(hi.x), CellCoord(hi.y), CellCoord(hi.z)};
+    double volume = 1.0;
+    for (int axis = 0; axis < 3; axis++) {
+        from[axis] = std::max(from[axis], minCell[axis]);
+        to[axis] = std::min(to[axis], maxCell[axis]);
+        if (from[axis] > to[axis]) return;
+        volume *= (double)(to[axis] - from[axis] + 1);
+    }
+
+    // A box spanning more cells than exist is cheaper to answer from the occupied cells
+    if (volume > (double)cells.size()) {
+        for (auto& pair : cells) {
+            if (pair.second.visited == queryStamp) continue;
+            pair.second.visited = queryStamp;
+            visit(pair.second.objects);
+        }
+        return;
+    }
+
+    for (int x = from[0]; x <= to[0]; x++) {
+        for (int y = from[1]; y <= to[1]; y++) {
+            for (int z = from[2]; z <= to[2]; z++) {
+                auto it = cells.find(PackKey(x, y, z));
+                if (it == cells.end() || it->second.visited == queryStamp) continue;
+                it->second.visited = queryStamp;
+                visit(it->second.objects);
+            }
+        }
+    }
+}
+
+template <typename Pad, typename Visit>
+void SpatialGrid::MarchCells(Vector3 origin, Vector3 dir, float length, Pad pad, Visit visit) {
+    if (!hasBounds || length <= 0.0f) return;
+
+    // Clip the segment to the occupied cells (slab test) so long rays stop where the objects do
+    float margin = pad(length) + looseMargin;
+    float enter = 0.0f;
+    float exit = length;
+    float o[3] = {origin.x, origin.y, origin.z};
+    float d[3] = {dir.x, dir.y, dir.z};
+    for (int axis = 0; axis < 3; axis++) {
+        float lo = minCell[axis] * cellSize - margin;
+        float hi = (maxCell[axis] + 1) * cellSize + margin;
+        if (fabsf(d[axis]) < 1e-8f) {
+            if (o[axis] < lo || o[axis] > hi) return;
+            continue;
+        }
+        float t0 = (lo - o[axis]) / d[axis];
+        float t1 = (hi - o[axis]) / d[axis];
+        if (t0 > t1) std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+        if (enter > exit) return;
+    }
+
+    // One cell-length step at a time, each step's box padded for the shape's width there
+    for (float t = enter; t < exit; t += cellSize) {
+        float end = std::min(t + cellSize, exit);
+        Vector3 a = Vector3Add(origin, Vector3Scale(dir, t));
+        Vector3 b = Vector3Add(origin, Vector3Scale(dir, end));
+        float p = pad(end) + looseMargin;
+        Vector3 lo = {std::min(a.x, b.x) - p, std::min(a.y, b.y) - p, std::min(a.z, b.z) - p};
+        Vector3 hi = {std::max(a.x, b.x) + p, std::max(a.y, b.y) + p, std::max(a.z, b.z) + p};
+        ForEachCell(lo, hi, visit);
+    }
+}
+
+// ========== QUERIES ==========
+
+// Fresh stamp for the next traversal (cells are reset if it wraps around)
+void SpatialGrid::BeginQuery() {
+    if (++queryStamp == 0) {
+        for (auto& pair : cells) pair.second.visited = 0;
+        queryStamp = 1;
+    }
+}
+
+void SpatialGrid::QuerySphere(Vector3 center, float radius, std::vector<Object*>& out, TypeMask types) {
+    out.clear();
+    BeginQuery();
+    auto accept = [&](const std::vector<Object*>& objects) {
+        for (Object* obj : objects) {
+            if ((obj->GetTypeMask() & types) && SphereTouches(obj, center, radius)) out.push_back(obj);
+        }
+    };
+    accept(large);
+
+    float r = radius + looseMargin;
+    ForEachCell({center.x - r, center.y - r, center.z - r}, {center.x + r, center.y + r, center.z + r}, accept);
+}
+
+void SpatialGrid::QueryCone(Vector3 origin, Vector3 direction, float range, float halfAngle,
+                            std::vector<Object*>& out, TypeMask types) {
+    out.clear();
+    BeginQuery();
+    auto accept = [&](const std::vector<Object*>& objects) {
+        for (Object* obj : objects) {
+            if ((obj->GetTypeMask() & types) && ConeTouches(obj, origin, direction, range, halfAngle)) out.push_back(obj);
+        }
+    };
+    accept(large);
+
+    if (halfAngle >= SPATIAL_WIDE_CONE) {
+        float r = range + looseMargin;
+        ForEachCell({origin.x - r, origin.y - r, origin.z - r}, {origin.x + r, origin.y + r, origin.z + r}, accept);
+        return;
+    }
+    float spread = tanf(halfAngle);
+    MarchCells(origin, direction, range, [spread](float t) { return t * spread; }, accept);
+}
+
+void SpatialGrid::QueryRay(Vector3 origin, Vector3 direction, float maxDistance, float radius,
+                           std::vector<Object*>& out, TypeMask types) {
+    out.clear();
+    BeginQuery();
+    auto accept = [&](const std::vector<Object*>& objects) {
+        for (Object* obj : objects) {
+            if ((obj->GetTypeMask() & types) && RayTouches(obj, origin, direction, maxDistance, radius)) out.push_back(obj);
+        }
+    };
+    accept(large);
+
+    MarchCells(origin, direction, maxDistance, [radius](float) { return radius; }, accept);
+}
+
+// ========== SHAPE TESTS ==========
+
+static float DistanceSqr(Vector3 a, Vector3 b) {
+    Vector3 d = Vector3Subtract(a, b);
+    return Vector3DotProduct(d, d);
+}
+
+bool SpatialGrid::SphereTouches(const Object* obj, Vector3 center, float radius) {
+    float reach = radius + obj->GetBoundingRadius();
+    return DistanceSqr(obj->position, center) <= reach * reach;
+}
+
+bool SpatialGrid::ConeTouches(const Object* obj, Vector3 origin, Vector3 direction, float range, float halfAngle) {
+    float r = obj->GetBoundingRadius();
+    Vector3 toObj = Vector3Subtract(obj->position, origin);
+    float dist = Vector3Length(toObj);
+    if (dist <= r) return true;
+    if (dist - r > range) return false;
+
+    // Sphere vs infinite cone: distance from the cone's surface along the perpendicular
+    float along = Vector3DotProduct(toObj, direction);
+    float across = sqrtf(std::max(0.0f, dist * dist - along * along));
+    return across * cosf(halfAngle) - along * sinf(halfAngle) <= r;
+}
+
+bool SpatialGrid::RayTouches(const Object* obj, Vector3 origin, Vector3 direction, float maxDistance, float radius) {
+    Vector3 toObj = Vector3Subtract(obj->position, origin);
+    float along = std::min(std::max(Vector3DotProduct(toObj, direction), 0.0f), maxDistance);
+    Vector3 closest = Vector3Add(origin, Vector3Scale(direction, along));
+    float reach = radius + obj->GetBoundingRadius();
+    return DistanceSqr(obj->position, closest) <= reach * reach;
+}
@@ -0,0 +1,89 @@
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include "core/object.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#define SPATIAL_CELL_SIZE 2.0f   // World units per grid cell edge
+
+// Uniform hash grid over object positions for proximity and ray queries
+// Objects whose bounding sphere fits in half a cell live in the cell holding their position;
+// bigger ones (walls, tables, people) go on a short list every query checks directly.
+// Positions are read at Insert/Refresh time - objects that move need a Refresh before they show up
+// in their new cells (DOM::UpdateSpatialIndex does that once per frame)
+class SpatialGrid {
+private:
+    struct Cell {
+        std::vector<Object*> objects;
+        uint32_t visited;   // Query stamp, so a ray/cone never checks one cell twice
+
+        Cell() : visited(0) {}
+    };
+
+    struct Entry {
+        Object* obj;
+        uint64_t key;
+        bool large;
+    };
+
+    float cellSize;
+    float looseMargin;   // Largest bounding radius of an object kept in a cell
+    std::unordered_map<uint64_t, Cell> cells;
+    std::vector<Entry> entries;                  // Dense, so RefreshAll is one linear pass
+    std::unordered_map<Object*, int> entryIndex;
+    std::vector<Object*> large;
+    uint32_t queryStamp;
+
+    // Cells any small object has ever touched, used to clip rays (grows only, reset by Clear)
+    int minCell[3];
+    int maxCell[3];
+    bool hasBounds;
+
+    int CellCoord(float v) const;
+    static uint64_t PackKey(int x, int y, int z);
+    uint64_t KeyFor(Vector3 pos) const;
+    bool IsLarge(const Object* obj) const;
+    void Link(const Entry& entry);
+    void Unlink(const Entry& entry);
+    void Rebucket(Entry& entry);
+    void BeginQuery();
+
+    // Visit every cell overlapping [lo, hi] once per query stamp
+    template <typename Visit>
+    void ForEachCell(Vector3 lo, Vector3 hi, Visit visit);
+
+    // Walk cells along origin + dir * [0, length], each step padded by pad(t)
+    template <typename Pad, typename Visit>
+    void MarchCells(Vector3 origin, Vector3 dir, float length, Pad pad, Visit visit);
+
+public:
+    explicit SpatialGrid(float cellSize = SPATIAL_CELL_SIZE);
+
+    void Insert(Object* obj);
+    void Remove(Object* obj);
+    void Refresh(Object* obj);   // Re-bucket obj if it moved to another cell or changed size
+    void RefreshAll();
+    void Clear();
+
+    int GetCount() const { return entries.size(); }
+    int GetCellCount() const { return cells.size(); }
+    float GetCellSize() const { return cellSize; }
+
+    // Each query clears out and appends objects matching `types` whose bounding sphere touches the shape
+    void QuerySphere(Vector3 center, float radius, std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+    // Cone from origin along direction (normalized), out to range, with the given half angle in radians
+    void QueryCone(Vector3 origin, Vector3 direction, float range, float halfAngle,
+                   std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+    // Segment origin + direction * [0, maxDistance] thickened by radius (a capsule)
+    void QueryRay(Vector3 origin, Vector3 direction, float maxDistance, float radius,
+                  std::vector<Object*>& out, TypeMask types = TYPE_MASK_ANY);
+
+    // Exact shape tests, shared with DOM's linear fallback
+    static bool SphereTouches(const Object* obj, Vector3 center, float radius);
+    static bool ConeTouches(const Object* obj, Vector3 origin, Vector3 direction, float range, float halfAngle);
+    static bool RayTouches(const Object* obj, Vector3 origin, Vector3 direction, float maxDistance, float radius);
+};
+
+#endif
@@ -0,0 +1,117 @@
+#include "core/thread_pool.hpp"
+#include <chrono>
+
+// Which pool (and queue) the current thread works for, so nested submits stay local
+static thread_local ThreadPool* currentPool = nullptr;
+static thread_local int currentIndex = -1;
+
+ThreadPool::ThreadPool(int threadCount) : pending(0), queued(0), nextQueue(0), stopping(false) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) threadCount = 1;
+    }
+
+    // Queues must all exist before any worker starts stealing
+    for (int i = 0; i < threadCount; i++) {
+        queues.emplace_back(new WorkQueue());
+    }
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    int count = static_cast<int>(queues.size());
+    int index = (currentPool == this) ? currentIndex : static_cast<int>(nextQueue++ % count);
+
+    // Count the task before it becomes visible so Wait() can't see zero in between
+    pending++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queued++;
+    }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::Wait() {
+    while (pending > 0) {
+        if (TryRunOne(currentPool == this ? currentIndex : -1)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        allDone.wait_for(lock, std::chrono::milliseconds(1), [this] { return pending == 0; });
+    }
+}
+
+bool ThreadPool::TryRunOne(int home) {
+    std::function<void()> task;
+    int count = static_cast<int>(queues.size());
+
+    // Own queue first, newest task (still warm in cache)
+    if (home >= 0) {
+        WorkQueue& own = *queues[home];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+
+    // Otherwise steal the oldest task from someone else
+    for (int n = 1; !task && n <= count; n++) {
+        int victim = (home + n + count) % count;
+        if (victim == home) continue;
+
+        WorkQueue& other = *queues[victim];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+    queued--;
+
+    task();
+
+    if (--pending == 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        allDone.notify_all();
+    }
+    return true;
+}
+
+void ThreadPool::WorkerLoop(int index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        if (TryRunOne(index)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        taskAvailable.wait(lock, [this] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+ThreadPool* ThreadPool::GetGlobal() {
+    // Function-local static: thread-safe construction, joined at program exit
+    static ThreadPool pool;
+    return &pool;
+}
@@ -0,0 +1,53 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size work-stealing pool for CPU-bound jobs (equity simulations, table simulations etc.)
+// Each worker owns a deque: it pops its own newest task and steals the oldest task from the others
+// when it runs dry, so uneven jobs (tables that bust out early) keep every core busy
+class ThreadPool {
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // One per worker
+    std::mutex sleepMutex;
+    std::condition_variable taskAvailable;   // Signals idle workers that a task was queued
+    std::condition_variable allDone;         // Signals Wait() that every task finished
+    std::atomic<int> pending;                // Submitted but not yet finished
+    std::atomic<int> queued;                 // Sitting in a queue, not yet picked up
+    std::atomic<unsigned> nextQueue;         // Round-robin target for submits from outside the pool
+    std::atomic<bool> stopping;
+
+    bool TryRunOne(int home);  // Run one task from queue `home` or steal one (-1 = steal only)
+    void WorkerLoop(int index);
+
+public:
+    explicit ThreadPool(int threadCount = 0);  // 0 = one worker per hardware thread
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> task);  // From a worker, goes to that worker's own queue
+    void Wait();  // Block until every submitted task (nested ones too) has finished; call from outside tasks
+
+    // Accessors
+    int GetThreadCount() const { return workers.size(); }
+
+    // Shared pool, created on first use
+    static ThreadPool* GetGlobal();
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TYPE_ID_HPP
+#define TYPE_ID_HPP
+
+#include <cstdint>
+
+// One ID per Object class. Each class also carries a mask with its own bit and all of its
+// ancestors' bits, so "is this a Person?" is a single AND instead of a GetType() string search
+enum ObjectTypeId {
+    TYPE_OBJECT = 0,
+    TYPE_INTERACTABLE,
+    TYPE_ITEM,
+    TYPE_CARD,
+    TYPE_CHIP,
+    TYPE_WEAPON,
+    TYPE_PISTOL,
+    TYPE_SUBSTANCE,
+    TYPE_SALVIA,
+    TYPE_WEED,
+    TYPE_VODKA,
+    TYPE_SHROOMS,
+    TYPE_ADRENALINE,
+    TYPE_COCAINE,
+    TYPE_MOLLY,
+    TYPE_POKER_TABLE,
+    TYPE_PERSON,
+    TYPE_PLAYER,
+    TYPE_ENEMY,
+    TYPE_DEALER,
+    TYPE_LIGHT,
+    TYPE_LIGHT_BULB,
+    TYPE_FLOOR,
+    TYPE_WALL,
+    TYPE_CEILING,
+    TYPE_SPAWNER,
+    TYPE_CHIP_STACK,
+    TYPE_DECK,
+    TYPE_RIGIDBODY,
+    TYPE_COUNT
+};
+
+typedef uint64_t TypeMask;
+
+static_assert(TYPE_COUNT <= 64, "TypeMask has one bit per ObjectTypeId");
+
+constexpr TypeMask TypeBit(ObjectTypeId id) {
+    return TypeMask(1) << id;
+}
+
+constexpr TypeMask TYPE_MASK_ANY = ~TypeMask(0);   // Filter that matches every type
+
+// Put in the public section of every Object subclass, naming its direct parent:
+//   class Chip : public Item {
+//   public:
+//       DECLARE_OBJECT_TYPE(TYPE_CHIP, Item)
+#define DECLARE_OBJECT_TYPE(id, Parent)                                       \
+    static constexpr ObjectTypeId TYPE_ID = id;                               \
+    static constexpr TypeMask TYPE_MASK = Parent::TYPE_MASK | TypeBit(id);    \
+    ObjectTypeId GetTypeId() const override { return TYPE_ID; }               \
+    TypeMask GetTypeMask() const override { return TYPE_MASK; }
+
+#endif
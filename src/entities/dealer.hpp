@@ -7,6 +7,8 @@ class PhysicsWorld;
 
 class Dealer : public Person {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_DEALER, Person)
+
     Dealer(Vector3 pos, const std::string& name = "Dealer");
     ~Dealer();
     
@@ -1,5 +1,7 @@
 #include "entities/enemy.hpp"
 #include "items/chip.hpp"
+#include "gameplay/equity_engine.hpp"
+#include "gameplay/preflop_table.hpp"
 #include <cstdlib>
 
 Enemy::Enemy(Vector3 pos, const std::string& enemyName)
@@ -7,7 +9,7 @@ Enemy::Enemy(Vector3 pos, const std::string& enemyName)
       thinkingTimer(0.0f),
       thinkingDuration(0.0f),
       isThinking(false),
-      pendingAction(-1) {
+      lastEquity(0.0) {
 }
 
 std::string Enemy::GetType() const {
@@ -21,72 +23,113 @@ void Enemy::Update(float deltaTime) {
     // Update thinking timer if currently thinking
     if (isThinking) {
         thinkingTimer += deltaTime;
+
+        // Done thinking - hand the decision to whoever asked (a no-op poll while it's still running)
+        if (thinkingTimer >= thinkingDuration) {
+            ResolveBet();
+        }
     }
 }
 
-int Enemy::PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) {
-    (void)currentBet;  // Suppress unused warning
-    
+void Enemy::CancelBet() {
+    Person::CancelBet();
+    isThinking = false;
+    thinkingTimer = 0.0f;
+    decision.Reset();  // The job still finishes on its worker; nobody reads the result
+}
 
-    
-    // First call: Start thinking
+int Enemy::PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) {
+    // First call: snapshot what we can see and hand the decision to a worker
     if (!isThinking) {
+        DecisionSnapshot snapshot;
+        snapshot.hole = inventory.GetCardMask();
+        snapshot.chips = inventory.GetTotalChipValue();
+        snapshot.view = GetTableView();
+        snapshot.bet.currentBet = currentBet;
+        snapshot.bet.callAmount = callAmount;
+        snapshot.bet.minRaise = minRaise;
+        snapshot.bet.maxRaise = maxRaise;
+        snapshot.roll = rand() % STRATEGY_QUANT;
+        decision = DecisionService::GetGlobal()->Submit([snapshot] { return Decide(snapshot); });
+
         isThinking = true;
         thinkingTimer = 0.0f;
         // Random thinking time between 2 and 4 seconds
-        thinkingDuration = 2.0f + ((rand() % 200) / 100.0f);
-        pendingAction = -1;
-        
+        thinkingDuration = ENEMY_MIN_THINK_SECONDS + ((rand() % ENEMY_THINK_SPREAD) / 100.0f);
         return -1;  // Still thinking
     }
     
-    // Still thinking...
-    if (thinkingTimer < thinkingDuration) {
+    // The delay is only for show; a slow decision keeps us thinking past it
+    if (thinkingTimer < thinkingDuration || !decision.IsReady()) {
         return -1;  // Still thinking
     }
     
-    // Done thinking - make decision (only once)
-    if (pendingAction == -1) {
-        // AI logic: Random decision between fold, call, raise
-        int decision = rand() % 3;  // 0=fold, 1=call, 2=raise
-        
-        // Count total chip value in inventory
-        Inventory* inv = GetInventory();
-        if (!inv) {
-            pendingAction = 0;  // Fold if no inventory
-            isThinking = false;
-            return 0;
-        }
-        
-        int totalChipValue = inv->GetTotalChipValue();
-        
-        // If we can't afford to call, must fold
-        if (callAmount > totalChipValue && decision != 0) {
-            pendingAction = 0;  // Fold
-        }
-        else if (decision == 2) {  // Raise
-            // Can we afford minimum raise?
-            if (minRaise > maxRaise) {
-                pendingAction = 1;  // Call instead
-            } else {
-                // Choose random raise amount between minRaise and maxRaise
-                int raiseRange = maxRaise - minRaise;
-                raiseAmount = minRaise + (rand() % (raiseRange + 1));
-                
-                pendingAction = 2;  // Raise
-            }
-        } else if (decision == 1) {
-            pendingAction = 1;  // Call
-        } else {
-            pendingAction = 0;  // Fold
-        }
-    }
-    
     // Reset for next time and return decision
+    DecisionResult result = decision.Take();
+    lastEquity = result.equity;
+    raiseAmount = result.raiseAmount;
     isThinking = false;
     thinkingTimer = 0.0f;
-    int action = pendingAction;
-    pendingAction = -1;
-    
+    return result.action;
+}
+
+DecisionResult Enemy::Decide(const DecisionSnapshot& snapshot) {
+    DecisionResult result;
+    const TableView& view = snapshot.view;
+    const BetRequest& bet = snapshot.bet;
+    int opponents = view.liveOpponents > 0 ? view.liveOpponents : 1;
+
+    if (view.board.IsEmpty() && PreflopTable::GetGlobal()->Lookup(snapshot.hole, opponents, result.equity)) {
+        // Preflop equity comes straight from the precomputed table
+    } else if (snapshot.hole.Count() >= 2) {
+        EquityRequest request;
+        request.hole = snapshot.hole;
+        request.board = view.board;
+        request.opponents = opponents;
+        request.maxSamples = ENEMY_EQUITY_SAMPLES;
+        request.maxSeconds = ENEMY_EQUITY_SECONDS;
+        // On this worker only - other decisions run alongside, and nobody waits on the shared pool
+        result.equity = EquityEngine::Calculate(request, nullptr).equity;
+    } else {
+        result.equity = 1.0 / (opponents + 1);  // No cards to go on - assume a fair share
+    }
+
+    const StrategyTable* strategy = StrategyTable::GetGlobal();
+    if (ENEMY_STRATEGY_ENABLED && strategy->IsLoaded() && bet.callAmount <= snapshot.chips) {
+        result.action = ChooseStrategyAction(*strategy, result.equity, view, bet.currentBet, bet.callAmount,
+                                             bet.minRaise, bet.maxRaise, snapshot.roll, result.raiseAmount);
+    } else {
+        // Whatever the table has learned about the players still in (lock-free reads of counters)
+        BettingAIParams params;
+        if (view.stats) {
+            params = BettingAI::Exploit(view.stats->Profile(view.opponentIds, view.opponentIdCount));
+        }
+
+        result.action = ChooseAction(result.equity, opponents, view.pot, bet.callAmount, snapshot.chips,
+                                     bet.minRaise, bet.maxRaise, result.raiseAmount, params);
+    }
+    return result;
+}
+
+int Enemy::ChooseStrategyAction(const StrategyTable& table, double equity, const TableView& view,
+                                int currentBet, int callAmount, int minRaise, int maxRaise,
+                                uint32_t roll, int& raiseAmount) {
+    int street = StrategyTable::StreetOf(view.board.Count());
+    int infoset = StrategyTable::InfosetIndex(street, view.streetRaises, callAmount > 0,
+                                              StrategyTable::PotBucket(view.pot, view.bigBlind),
+                                              StrategyTable::EquityBucket(equity));
+    int action = table.SampleAction(infoset, roll);
+
+    // Never fold when checking is free
+    if (action == 0 && callAmount == 0) action = 1;
+
+    if (action == 2) {
+        if (minRaise > maxRaise) return 1;
+
+        // Pot-sized: call, then raise by the whole pot
+        raiseAmount = currentBet + view.pot + callAmount;
+        if (raiseAmount < minRaise) raiseAmount = minRaise;
+        if (raiseAmount > maxRaise) raiseAmount = maxRaise;
+    }
     return action;
 }
@@ -3,25 +3,71 @@
 
 #include "raylib.h"
 #include "entities/person.hpp"
+#include "gameplay/betting_ai.hpp"
+#include "gameplay/decision_service.hpp"
+#include "gameplay/strategy_table.hpp"
+
+// AI tuning
+#define ENEMY_EQUITY_SAMPLES 4000      // Monte Carlo sample budget per decision
+#define ENEMY_EQUITY_SECONDS 0.004f    // Time budget per decision (caps slow machines - it runs on a decision worker)
+#define ENEMY_MIN_THINK_SECONDS 2.0f   // Shortest time an enemy appears to think before acting
+#define ENEMY_THINK_SPREAD 200         // Plus up to this many hundredths of a second
+#define ENEMY_STRATEGY_ENABLED true    // Play the trained strategy table when one is loaded
+
+// Everything a betting decision is made from, copied on the main thread so the job never touches live objects
+struct DecisionSnapshot {
+    CardMask hole;
+    int chips;
+    TableView view;
+    BetRequest bet;
+    uint32_t roll;          // Strategy table roll in [0, STRATEGY_QUANT) (rand() stays on the main thread)
+
+    DecisionSnapshot() : hole(), chips(0), view(), bet(), roll(0) {}
+};
 
 class Enemy : public Person {
 private:
-    float thinkingTimer;    // Timer for AI delay
-    float thinkingDuration; // How long to "think" before acting
+    float thinkingTimer;    // Time since the decision was asked for
+    float thinkingDuration; // Minimum time to look like it's thinking (the decision itself may take longer)
     bool isThinking;        // Whether currently thinking about a bet
-    int pendingAction;      // Cached betting decision
+    PendingDecision decision;   // Running on the decision service
+    double lastEquity;      // Equity estimate behind the last decision
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_ENEMY, Person)
+
     Enemy(Vector3 pos, const std::string& enemyName = "Enemy");
     virtual ~Enemy() = default;
 
     // Override GetType for identification
     std::string GetType() const override;
     
-    // Override PromptBet for AI logic (random decision with delay)
+    // Override PromptBet for AI logic: the first call submits Decide() to DecisionService::GetGlobal(),
+    // later calls return -1 until both the thinking delay has passed and the decision is ready
     int PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) override;
+
+    // The whole decision as a pure function of a snapshot (safe on any thread)
+    static DecisionResult Decide(const DecisionSnapshot& snapshot);
+
+    // Pick fold/call/raise from hand equity and pot odds (0=fold, 1=call, 2=raise)
+    static int ChooseAction(double equity, int opponents, int pot, int callAmount, int chips,
+                            int minRaise, int maxRaise, int& raiseAmount,
+                            const BettingAIParams& params = BettingAIParams()) {
+        return BettingAI::ChooseAction(equity, opponents, pot, callAmount, chips, minRaise, maxRaise, raiseAmount, params);
+    }
+
+    // Sample fold/call/raise from a trained strategy table (roll in [0, STRATEGY_QUANT))
+    // Raises are pot-sized like the training game; actions that aren't available fall back to a call
+    static int ChooseStrategyAction(const StrategyTable& table, double equity, const TableView& view,
+                                    int currentBet, int callAmount, int minRaise, int maxRaise,
+                                    uint32_t roll, int& raiseAmount);
+
+    void CancelBet() override;
+
+    double GetLastEquity() const { return lastEquity; }
+    bool IsThinking() const { return isThinking; }
     
-    // Override Update to handle thinking timer
+    // Override Update to handle thinking timer (polls for the decision once it runs out)
     void Update(float deltaTime) override;
 };
 
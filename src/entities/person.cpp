@@ -210,3 +210,30 @@ void Person::StandUp() {
     isSeated = false;
     // Position remains where the seat was, person can move freely from there
 }
+
+// ========== BETTING ==========
+
+void Person::RequestBet(const BetRequest& request, BetCallback onDecided) {
+    betRequest = request;
+    betCallback = std::move(onDecided);
+    ResolveBet();
+}
+
+void Person::CancelBet() {
+    betCallback = nullptr;
+}
+
+bool Person::ResolveBet() {
+    if (!betCallback) return false;
+
+    int raiseAmount = 0;
+    int action = PromptBet(betRequest.currentBet, betRequest.callAmount, betRequest.minRaise,
+                           betRequest.maxRaise, raiseAmount);
+    if (action == -1) return false;  // Still deciding
+
+    // Clear first - the callback may immediately ask this person again
+    BetCallback callback = std::move(betCallback);
+    betCallback = nullptr;
+    callback(action, raiseAmount);
+    return true;
+}
@@ -4,8 +4,37 @@
 #include "raylib.h"
 #include "core/object.hpp"
 #include "items/inventory.hpp"
+#include "gameplay/opponent_stats.hpp"
+#include <functional>
 #include <string>
 
+// Public table state a seated person can see (set by PokerTable before PromptBet)
+struct TableView {
+    CardMask board;       // Community cards dealt so far
+    int liveOpponents;    // Players still in the hand besides this one
+    int pot;              // Chips in the pot (including this round's bets)
+    int bigBlind;
+    int streetRaises;     // Raises made on this street so far
+    const OpponentStatsTracker* stats;      // Who to look the opponents up in (nullptr = no reads)
+    uint32_t opponentIds[MAX_SEATS];        // Live opponents' player ids
+    int opponentIdCount;
+
+    TableView() : board(), liveOpponents(0), pot(0), bigBlind(0), streetRaises(0), stats(nullptr), opponentIds(), opponentIdCount(0) {}
+};
+
+// What the table is asking a seated person to decide (same arguments PromptBet receives)
+struct BetRequest {
+    int currentBet;
+    int callAmount;
+    int minRaise;
+    int maxRaise;
+
+    BetRequest() : currentBet(0), callAmount(0), minRaise(0), maxRaise(0) {}
+};
+
+// Called once with the decision (0=fold, 1=call, 2=raise) and the raise-to amount
+typedef std::function<void(int action, int raiseAmount)> BetCallback;
+
 class Person : public Object {
 protected:
     Inventory inventory;
@@ -16,8 +45,19 @@ protected:
     // Seating
     bool isSeated;          // Whether person is seated at a table
     Vector3 seatPosition;   // Position where person is seated
+    TableView tableView;    // What this person can see of the current hand
+
+    // Outstanding bet request (the table waits on the callback instead of polling PromptBet)
+    BetRequest betRequest;
+    BetCallback betCallback;
+
+    // Ask PromptBet again with the stored request; delivers the decision and returns true once there is one
+    // Subclasses call this when something changed (thinking timer ran out, a button was pressed)
+    bool ResolveBet();
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_PERSON, Object)
+
     Person(Vector3 pos, const std::string& personName, float personHeight = 1.0f);
     virtual ~Person() = default;
 
@@ -38,6 +78,16 @@ public:
         return 0; // Default: fold
     }
     
+    // Event-driven betting: the table asks once and is called back when the decision is made
+    // The default asks PromptBet right away, so a person who decides instantly answers inside the call
+    virtual void RequestBet(const BetRequest& request, BetCallback onDecided);
+    virtual void CancelBet();   // Table no longer wants an answer (hand ended, seat left)
+    bool HasPendingBet() const { return static_cast<bool>(betCallback); }
+
+    // Table state for betting decisions
+    void SetTableView(const TableView& view) { tableView = view; }
+    const TableView& GetTableView() const { return tableView; }
+
     // Body rotation
     void SetBodyYaw(float yaw) { bodyYaw = yaw; }
     float GetBodyYaw() const { return bodyYaw; }
@@ -50,6 +100,7 @@ public:
     void SetHeight(float newHeight) { height = newHeight; }
 
     std::string GetType() const override;
+    float GetBoundingRadius() const override { return 2.4f * height + 0.5f; }  // Feet to top of head, plus hitbox radius
 };
 
 #endif
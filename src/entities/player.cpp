@@ -5,6 +5,7 @@
 #include "world/wall.hpp"
 #include "weapons/weapon.hpp"
 #include "entities/person.hpp"
+#include "entities/dealer.hpp"
 #include "core/dom.hpp"
 #include "rendering/inventory_ui.hpp"
 #include "core/debug.hpp"
@@ -74,11 +75,8 @@ void Player::HandleInteraction() {
     Interactable* closestInteractable = GetClosestInteractable();
     if (!closestInteractable) return;
 
-    std::string typeStr = closestInteractable->GetType();
-
     // Handle poker table interaction (sit down or stand up)
-    if (typeStr.find("poker_table") != std::string::npos) {
-        PokerTable* table = static_cast<PokerTable*>(closestInteractable);
+    if (PokerTable* table = closestInteractable->As<PokerTable>()) {
 
         // Check if we're already seated at this table
         int seatIndex = table->FindSeatIndex(this);
@@ -96,8 +94,7 @@ void Player::HandleInteraction() {
         }
     }
     // Handle item pickup (any object that inherits from Item)
-    else if (typeStr.find("item") != std::string::npos) {
-        Item* item = static_cast<Item*>(closestInteractable);
+    else if (Item* item = closestInteractable->As<Item>()) {
 
         // Add to inventory
         inventory.AddItem(item);
@@ -202,18 +199,24 @@ void Player::Update(float deltaTime) {
         if (body != nullptr && geom != nullptr) {
             // Helper lambda to extract geometry from any object type
             auto getGeomFromObject = [](Object* obj) -> dGeomID {
-                std::string typeStr = obj->GetType();
-                if (typeStr.find("poker_table") != std::string::npos) {
-                    PokerTable* table = static_cast<PokerTable*>(obj);
+                if (PokerTable* table = obj->As<PokerTable>()) {
                     return table->GetCollider() ? table->GetCollider()->GetGeom() : nullptr;
-                } else if (typeStr.find("wall") != std::string::npos) {
-                    Wall* wall = static_cast<Wall*>(obj);
+                } else if (Wall* wall = obj->As<Wall>()) {
                     return wall->GetCollider() ? wall->GetCollider()->GetGeom() : nullptr;
                 }
                 // Add more collider types here as needed
                 return nullptr;
             };
 
+            // Only walls and tables near the destination can block this move
+            DOM* dom = DOM::GetGlobal();
+            if (dom) {
+                dom->QuerySphere(newPos, PLAYER_COLLISION_QUERY_RADIUS, nearbyObjects,
+                                 TypeBit(TYPE_WALL) | TypeBit(TYPE_POKER_TABLE));
+            } else {
+                nearbyObjects.clear();
+            }
+
             Vector3 finalPos = newPos;
             const int maxIterations = 3;  // Handle corners and complex geometry
 
@@ -224,24 +227,20 @@ void Player::Update(float deltaTime) {
                 // Check for collisions
                 bool collided = false;
                 Vector3 collisionNormal = {0.0f, 0.0f, 0.0f};
-                DOM* dom = DOM::GetGlobal();
-
-                if (dom) {
-                    for (int i = 0; i < dom->GetCount(); i++) {
-                        Object* obj = dom->GetObject(i);
-                        dGeomID otherGeom = getGeomFromObject(obj);
-
-                        if (otherGeom != nullptr) {
-                            dContactGeom contacts[4];
-                            int numContacts = dCollide(geom, otherGeom, 4, contacts, sizeof(dContactGeom));
-                            if (numContacts > 0) {
-                                collided = true;
-                                // Use the first contact normal
-                                collisionNormal.x = contacts[0].normal[0];
-                                collisionNormal.y = contacts[0].normal[1];
-                                collisionNormal.z = contacts[0].normal[2];
-                                break;
-                            }
+
+                for (Object* obj : nearbyObjects) {
+                    dGeomID otherGeom = getGeomFromObject(obj);
+
+                    if (otherGeom != nullptr) {
+                        dContactGeom contacts[4];
+                        int numContacts = dCollide(geom, otherGeom, 4, contacts, sizeof(dContactGeom));
+                        if (numContacts > 0) {
+                            collided = true;
+                            // Use the first contact normal
+                            collisionNormal.x = contacts[0].normal[0];
+                            collisionNormal.y = contacts[0].normal[1];
+                            collisionNormal.z = contacts[0].normal[2];
+                            break;
                         }
                     }
                 }
@@ -286,6 +285,16 @@ void Player::Update(float deltaTime) {
         }
     }
 
+    // Hand the table any choice made in the betting / card selection UI since last frame
+    if (bettingUIActive && bettingChoice != -1) {
+        ResolveBet();
+    }
+    if (cardSelectionCallback && !cardSelectionUIActive) {
+        std::function<void()> callback = std::move(cardSelectionCallback);
+        cardSelectionCallback = nullptr;
+        callback();
+    }
+
     // Update insanity system
     bool isTripping = PsychedelicManager::IsTripping();
     float tripIntensity = isTripping ? PsychedelicManager::GetCurrentIntensity() : 0.0f;
@@ -407,18 +416,15 @@ Interactable* Player::GetClosestInteractable() {
     Interactable* closestInteractable = nullptr;
     float closestDistance = 999999.0f;
     float maxInteractDistance = 5.0f;
+    float crosshairThreshold = 1.0f;
 
-    for (int i = 0; i < dom->GetCount(); i++) {
-        Object* obj = dom->GetObject(i);
-        std::string typeStr = obj->GetType();
-
-        // Check if this object is an interactable
-        if (typeStr.find("interactable") == std::string::npos) continue;
+    // Interactables whose bounds come near the crosshair ray
+    dom->QueryRay(rayOrigin, rayDirection, maxInteractDistance, crosshairThreshold, nearbyObjects,
+                  TypeBit(TYPE_INTERACTABLE));
 
+    for (Object* obj : nearbyObjects) {
         Interactable* interactable = static_cast<Interactable*>(obj);
 
-
-
         Vector3 objPos = interactable->position;
         Vector3 toObj = Vector3Subtract(objPos, rayOrigin);
 
@@ -429,8 +435,6 @@ Interactable* Player::GetClosestInteractable() {
         Vector3 closestPointOnRay = Vector3Add(rayOrigin, Vector3Scale(rayDirection, projection));
         float distanceToRay = Vector3Distance(objPos, closestPointOnRay);
 
-        float crosshairThreshold = 1.0f;
-
         // Only consider interactables that have canInteract enabled
         if (distanceToRay < crosshairThreshold && projection < closestDistance && interactable->canInteract) {
             closestDistance = projection;
@@ -468,9 +472,7 @@ void Player::HandleUseItem() {
     stack->item->Use();
 
     // Handle weapon-specific logic (raycast and ammo management)
-    std::string itemType = stack->item->GetType();
-    if (itemType.find("weapon") != std::string::npos) {
-        Weapon* weapon = static_cast<Weapon*>(stack->item);
+    if (Weapon* weapon = stack->item->As<Weapon>()) {
 
         // Get camera ray for weapon raycast
         Camera3D* cam = GetCamera();
@@ -492,34 +494,20 @@ void Player::HandleUseItem() {
             OnKillPerson();
 
             // Check if we killed a dealer
-            bool killedDealer = (hitPerson->GetType().find("dealer") != std::string::npos);
+            bool killedDealer = hitPerson->IsA<Dealer>();
 
-            // If person is sitting, unseat them from all poker tables
+            // Tell every poker table: seated people are unseated, a dead dealer stops that table's game
             DOM* dom = DOM::GetGlobal();
-            if (dom && hitPerson->IsSeated()) {
-                for (int j = 0; j < dom->GetCount(); j++) {
-                    Object* tableObj = dom->GetObject(j);
-                    if (tableObj) {
-                        std::string tableType = tableObj->GetType();
-                        if (tableType.find("poker_table") != std::string::npos) {
-                            PokerTable* table = static_cast<PokerTable*>(tableObj);
-                            table->UnseatPerson(hitPerson);
-                        }
-                    }
+            if (dom) {
+                for (Object* tableObj : dom->GetCategory(CATEGORY_POKER_TABLES)) {
+                    static_cast<PokerTable*>(tableObj)->OnPersonKilled(hitPerson);
                 }
             }
 
             // If we killed a dealer, make all pot items interactable
             if (dom && killedDealer) {
-                for (int j = 0; j < dom->GetCount(); j++) {
-                    Object* tableObj = dom->GetObject(j);
-                    if (tableObj) {
-                        std::string tableType = tableObj->GetType();
-                        if (tableType.find("poker_table") != std::string::npos) {
-                            PokerTable* table = static_cast<PokerTable*>(tableObj);
-                            table->MakePotItemsInteractable();
-                        }
-                    }
+                for (Object* tableObj : dom->GetCategory(CATEGORY_POKER_TABLES)) {
+                    static_cast<PokerTable*>(tableObj)->MakePotItemsInteractable();
                 }
             }
 
@@ -541,7 +529,7 @@ void Player::HandleUseItem() {
         }
     }
     // Handle substance consumption (remove from inventory after use)
-    else if (itemType.find("substance") != std::string::npos) {
+    else if (stack->item->IsA(TYPE_SUBSTANCE)) {
         // Check if this is the last one in the stack before removing
         bool wasLastInStack = (stack->count <= 1);
         Item* substancePtr = stack->item;  // Save pointer before RemoveItem
@@ -670,6 +658,12 @@ int Player::PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise
     return choice;
 }
 
+void Player::CancelBet() {
+    Person::CancelBet();
+    bettingUIActive = false;
+    bettingChoice = -1;
+}
+
 void Player::DrawBettingUI() {
     if (!bettingUIActive) return;
 
@@ -764,6 +758,21 @@ void Player::DrawBettingUI() {
     }
 }
 
+void Player::RequestCardSelection(std::function<void()> onSelected) {
+    cardSelectionUIActive = true;
+    cardSelectionCallback = std::move(onSelected);
+}
+
+void Player::CancelCardSelection() {
+    cardSelectionCallback = nullptr;
+
+    // A pick still in progress is dropped; a confirmed one stays for the next showdown to use
+    if (cardSelectionUIActive) {
+        cardSelectionUIActive = false;
+        selectedCardIndices.clear();
+    }
+}
+
 void Player::DrawCardSelectionUI() {
     if (!cardSelectionUIActive) return;
 
@@ -774,7 +783,7 @@ void Player::DrawCardSelectionUI() {
     std::vector<int> cardIndices;
     for (int i = 0; i < inventory.GetStackCount(); i++) {
         ItemStack* stack = inventory.GetStack(i);
-        if (stack && stack->item && stack->item->GetType().find("card") != std::string::npos) {
+        if (stack && stack->item && stack->item->IsA<Card>()) {
             cardIndices.push_back(i);
         }
     }
@@ -787,6 +796,20 @@ void Player::DrawCardSelectionUI() {
     DrawText(TextFormat("Selected: %d/2", (int)selectedCardIndices.size()), screenWidth / 2 - 80, screenHeight / 2 - 110, 20, WHITE);
     DrawText("Click on cards to select/deselect. Press ENTER when done.", screenWidth / 2 - 240, screenHeight / 2 - 85, 16, LIGHTGRAY);
 
+    // Best pick against the board, outlined and selectable with H
+    const HandChoice* hint = nullptr;
+    if (CARD_SELECTION_HINT_ENABLED && cardIndices.size() > 2) {
+        hint = &GetCardHint();
+        if (hint->cards[1] >= 0) {
+            DrawText(TextFormat("Hint: %s (press H)", HandEvaluator::GetRankName(HandEvaluator::GetRank(hint->strength))),
+                     screenWidth / 2 - 100, screenHeight / 2 - 62, 16, SKYBLUE);
+        }
+    }
+    bool takeHint = hint && hint->cards[1] >= 0 && IsKeyPressed(KEY_H);
+    if (takeHint) {
+        selectedCardIndices.clear();
+    }
+
     // Draw cards as clickable boxes
     int cardWidth = 80;
     int cardHeight = 120;
@@ -805,6 +828,10 @@ void Player::DrawCardSelectionUI() {
         int y = startY;
 
         Rectangle cardRect = {(float)x, (float)y, (float)cardWidth, (float)cardHeight};
+        bool isHinted = hint && (card->GetIndex() == hint->cards[0] || card->GetIndex() == hint->cards[1]);
+        if (takeHint && isHinted && selectedCardIndices.size() < 2) {
+            selectedCardIndices.push_back(invIndex);
+        }
 
         // Check if this card is selected
         bool isSelected = false;
@@ -839,6 +866,9 @@ void Player::DrawCardSelectionUI() {
 
         DrawRectangleRec(cardRect, WHITE);
         DrawRectangleLinesEx(cardRect, borderWidth, borderColor);
+        if (isHinted && !isSelected) {
+            DrawRectangleLinesEx({cardRect.x - 4, cardRect.y - 4, cardRect.width + 8, cardRect.height + 8}, 2, SKYBLUE);
+        }
 
         // Draw card icon (simplified - just show rank and suit)
         const char* rankStr = Card::GetRankString(card->rank);
@@ -869,7 +899,7 @@ std::vector<Card*> Player::GetSelectedCards() {
     if (!cardSelectionUIActive && selectedCardIndices.empty()) {
         for (int i = 0; i < inventory.GetStackCount(); i++) {
             ItemStack* stack = inventory.GetStack(i);
-            if (stack && stack->item && stack->item->GetType().find("card") != std::string::npos) {
+            if (stack && stack->item && stack->item->IsA<Card>()) {
                 cards.push_back(static_cast<Card*>(stack->item));
             }
         }
@@ -879,7 +909,7 @@ std::vector<Card*> Player::GetSelectedCards() {
     // Return only selected cards
     for (int idx : selectedCardIndices) {
         ItemStack* stack = inventory.GetStack(idx);
-        if (stack && stack->item && stack->item->GetType().find("card") != std::string::npos) {
+        if (stack && stack->item && stack->item->IsA<Card>()) {
             cards.push_back(static_cast<Card*>(stack->item));
         }
     }
@@ -887,6 +917,17 @@ std::vector<Card*> Player::GetSelectedCards() {
     return cards;
 }
 
+const HandChoice& Player::GetCardHint() {
+    CardMask held = inventory.GetCardMask();
+    CardMask board = tableView.board;
+    if (held != cardHintHeld || board != cardHintBoard) {
+        cardHint = HandOptimizer::BestTwo(held, board);
+        cardHintHeld = held;
+        cardHintBoard = board;
+    }
+    return cardHint;
+}
+
 void Player::OnKillPerson() {
     insanityManager.OnKill();
 }
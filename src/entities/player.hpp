@@ -6,7 +6,9 @@
 #include "rendering/camera.hpp"
 #include "core/physics.hpp"
 #include "gameplay/insanity_manager.hpp"
+#include "gameplay/hand_optimizer.hpp"
 #include <ode/ode.h>
+#include <functional>
 #include <vector>
 
 // Forward declarations
@@ -18,6 +20,11 @@ class Card;
 #define COLLISION_CATEGORY_ITEM     (1 << 1)  // 0010
 #define COLLISION_CATEGORY_TABLE    (1 << 2)  // 0100
 
+#define PLAYER_COLLISION_QUERY_RADIUS 2.0f   // Colliders within this of the next position are tested each move
+
+// Show the best two cards (HandOptimizer) as a hint in the showdown card selection UI
+#define CARD_SELECTION_HINT_ENABLED true
+
 class Player : public Person {
 private:
     GameCamera camera;
@@ -42,8 +49,18 @@ private:
     int raiseMax;           // Maximum raise
     int storedCurrentBet;   // Stored for UI display
     int storedCallAmount;   // Stored for UI display
+    std::function<void()> cardSelectionCallback;   // Pending showdown pick (see RequestCardSelection)
+
+    // Card selection hint, recomputed only when the held cards or the board change
+    HandChoice cardHint;
+    CardMask cardHintHeld;
+    CardMask cardHintBoard;
+
+    std::vector<Object*> nearbyObjects;   // Reused DOM query results (interaction ray, movement collision)
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_PLAYER, Person)
+
     // Card selection UI state (for cheating with 3+ cards) - public so poker table can access
     bool cardSelectionUIActive;     // Is card selection UI shown
     std::vector<int> selectedCardIndices;  // Indices of selected cards (max 2)
@@ -71,13 +88,18 @@ public:
     
     // Override PromptBet for UI-based betting
     int PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) override;
+    void CancelBet() override;
     
     // Betting UI
     void DrawBettingUI();
     
     // Card selection UI (for cheating with 3+ cards)
+    // RequestCardSelection shows the UI and calls back once the pick is confirmed
+    void RequestCardSelection(std::function<void()> onSelected);
+    void CancelCardSelection();             // Table no longer wants the pick (seat left, table gone)
     void DrawCardSelectionUI();
     std::vector<Card*> GetSelectedCards();  // Returns the 2 selected cards for hand evaluation
+    const HandChoice& GetCardHint();        // Best two held cards against the board in the table view
     
     // Insanity management
     void OnKillPerson();  // Called when player kills someone
@@ -0,0 +1,47 @@
+#include "gameplay/betting_ai.hpp"
+
+int BettingAI::ChooseAction(double equity, int opponents, int pot, int callAmount, int chips,
+                            int minRaise, int maxRaise, int& raiseAmount, const BettingAIParams& params) {
+    // If we can't afford to call, must fold
+    if (callAmount > chips) {
+        return 0;
+    }
+
+    if (opponents < 1) opponents = 1;
+
+    // Pot odds: share of the final pot we have to put in to continue
+    double potOdds = (callAmount > 0) ? (double)callAmount / (pot + callAmount) : 0.0;
+    double raiseEquity = params.raiseFactor / (opponents + 1);
+
+    // Strong hand - raise, sizing up with the edge over the raise threshold
+    if (equity >= raiseEquity && equity > potOdds && minRaise <= maxRaise) {
+        double edge = (raiseEquity < 1.0) ? (equity - raiseEquity) / (1.0 - raiseEquity) : 0.0;
+        if (edge < 0.0) edge = 0.0;
+        if (edge > 1.0) edge = 1.0;
+        raiseAmount = minRaise + (int)((maxRaise - minRaise) * edge * params.raiseFraction);
+        return 2;
+    }
+
+    // Free to check, or the price is right
+    if (callAmount == 0 || equity >= potOdds * params.callFactor) {
+        return 1;
+    }
+
+    return 0;
+}
+
+BettingAIParams BettingAI::Exploit(const OpponentStats& opponents, const BettingAIParams& base) {
+    BettingAIParams params = base;
+    if (opponents.GetHands() < OPPONENT_STATS_MIN_HANDS) return params;
+
+    // Each stat is measured against a middle-of-the-road baseline, so an average table plays as before
+    if (opponents.Get(STAT_CBETS_FACED) > 0) {
+        params.raiseFactor *= 1.0 - AI_EXPLOIT_WEIGHT * (opponents.FoldToCBet() - 0.5);
+    }
+    if (opponents.Get(STAT_AGGRESSIVE) + opponents.Get(STAT_PASSIVE) > 0) {
+        params.callFactor *= 1.0 - AI_EXPLOIT_WEIGHT * (opponents.AggressionFrequency() - 0.5);
+    }
+    params.raiseFraction *= 1.0 + AI_EXPLOIT_WEIGHT * (opponents.VPIP() - 0.3);
+    if (params.raiseFraction > 1.0) params.raiseFraction = 1.0;
+    return params;
+}
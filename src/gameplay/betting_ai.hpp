@@ -0,0 +1,34 @@
+#ifndef BETTING_AI_HPP
+#define BETTING_AI_HPP
+
+#include "gameplay/opponent_stats.hpp"
+
+#define AI_RAISE_FACTOR 1.5         // Raise when equity beats a fair share by this factor
+#define AI_RAISE_FRACTION 0.5       // Portion of the raise range used at maximum strength
+#define AI_EXPLOIT_WEIGHT 0.5       // How far opponent stats move the knobs away from their defaults
+
+// Tunable knobs for the equity-based betting rule
+struct BettingAIParams {
+    double raiseFactor;
+    double raiseFraction;
+    double callFactor;          // Scales the pot odds a call needs (below 1 calls lighter)
+
+    BettingAIParams() : raiseFactor(AI_RAISE_FACTOR), raiseFraction(AI_RAISE_FRACTION), callFactor(1.0) {}
+};
+
+// Static utility class for turning hand equity into a betting decision
+// Shared by Enemy and the headless simulator so both play the same way
+class BettingAI {
+public:
+    // Pick fold/call/raise from hand equity and pot odds (0=fold, 1=call, 2=raise)
+    static int ChooseAction(double equity, int opponents, int pot, int callAmount, int chips,
+                            int minRaise, int maxRaise, int& raiseAmount,
+                            const BettingAIParams& params = BettingAIParams());
+
+    // Shift the knobs against the merged stats of the live opponents (unchanged until they have a sample):
+    // raise lighter into players who fold to continuation bets, call lighter against aggressive ones,
+    // and size value raises up against loose ones
+    static BettingAIParams Exploit(const OpponentStats& opponents, const BettingAIParams& base = BettingAIParams());
+};
+
+#endif
@@ -0,0 +1,50 @@
+#include "gameplay/blind_structure.hpp"
+#include <climits>
+
+BlindStructure::BlindStructure() : handsPerLevel(0), doubleAfterLast(false) {
+    levels.push_back(BlindLevel());
+}
+
+BlindStructure BlindStructure::Fixed(int smallBlind, int bigBlind, int ante) {
+    BlindStructure structure;
+    structure.levels[0] = BlindLevel(smallBlind, bigBlind, ante);
+    return structure;
+}
+
+BlindStructure BlindStructure::Doubling(int smallBlind, int bigBlind, int ante, int handsPerLevel) {
+    BlindStructure structure = Fixed(smallBlind, bigBlind, ante);
+    structure.handsPerLevel = handsPerLevel;
+    structure.doubleAfterLast = true;
+    return structure;
+}
+
+void BlindStructure::AddLevel(const BlindLevel& level) {
+    levels.push_back(level);
+}
+
+BlindLevel BlindStructure::GetLevel(int handNumber) const {
+    if (handsPerLevel <= 0 || handNumber < 0) return levels[0];
+
+    int index = handNumber / handsPerLevel;
+    int last = static_cast<int>(levels.size()) - 1;
+    if (index <= last) return levels[index];
+
+    BlindLevel level = levels[last];
+    if (!doubleAfterLast) return level;
+
+    // Stop doubling before anything could overflow - no stack gets that deep anyway
+    for (int i = last; i < index && level.bigBlind <= INT_MAX / 4; i++) {
+        level.smallBlind *= 2;
+        level.bigBlind *= 2;
+        level.ante *= 2;
+    }
+    return level;
+}
+
+bool BlindStructure::IsValid() const {
+    if (handsPerLevel < 0) return false;
+    for (const BlindLevel& level : levels) {
+        if (!level.IsValid()) return false;
+    }
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef BLIND_STRUCTURE_HPP
+#define BLIND_STRUCTURE_HPP
+
+#include <vector>
+
+#define SMALL_BLIND_AMOUNT 5
+#define BIG_BLIND_AMOUNT 10
+
+// Forced bets for one hand
+struct BlindLevel {
+    int smallBlind;
+    int bigBlind;
+    int ante;           // Posted by every seat dealt in, before the blinds (0 = none)
+
+    BlindLevel(int small = SMALL_BLIND_AMOUNT, int big = BIG_BLIND_AMOUNT, int a = 0)
+        : smallBlind(small), bigBlind(big), ante(a) {}
+
+    bool IsValid() const { return smallBlind >= 0 && bigBlind >= smallBlind && ante >= 0; }
+};
+
+// Blind and ante schedule for a table, picked at runtime (the seat count is the engine's template argument)
+// Levels move up every handsPerLevel hands; past the last level the blinds either stay put or keep doubling
+class BlindStructure {
+private:
+    std::vector<BlindLevel> levels;
+    int handsPerLevel;          // 0 = stay on the first level
+    bool doubleAfterLast;
+
+public:
+    BlindStructure();           // SMALL_BLIND_AMOUNT / BIG_BLIND_AMOUNT, no ante, never changes
+
+    static BlindStructure Fixed(int smallBlind, int bigBlind, int ante = 0);
+    static BlindStructure Doubling(int smallBlind, int bigBlind, int ante, int handsPerLevel);
+
+    // Building a schedule: Fixed(...) then AddLevel() for each later level and SetHandsPerLevel()
+    void AddLevel(const BlindLevel& level);
+    void SetHandsPerLevel(int hands) { handsPerLevel = hands; }
+    void SetDoubleAfterLast(bool enabled) { doubleAfterLast = enabled; }
+
+    BlindLevel GetLevel(int handNumber) const;    // Hand numbers count from 0
+    int GetLevelCount() const { return static_cast<int>(levels.size()); }
+    int GetHandsPerLevel() const { return handsPerLevel; }
+    bool IsValid() const;
+};
+
+#endif
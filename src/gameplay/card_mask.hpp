@@ -0,0 +1,71 @@
+#ifndef CARD_MASK_HPP
+#define CARD_MASK_HPP
+
+#include <cstdint>
+
+#define NUM_RANKS 13     // Rank index 0 = two ... 12 = ace
+#define NUM_SUITS 4
+#define NUM_CARDS 52     // Card index = suit * NUM_RANKS + rank index
+
+#define CARD_MASK_SUIT_BITS 16       // Bits reserved per suit (13 used)
+#define CARD_MASK_RANK_BITS 0x1FFF   // The 13 used bits of a suit
+
+// Compact value type for a set of cards: one uint64 with a 16-bit lane per suit
+// Bit (suit * 16 + rank index) is set when the card is present, so copying a hand is free
+// and flush/straight checks become popcount and shift-and-mask on a single lane
+struct CardMask {
+    uint64_t bits;
+
+    constexpr CardMask() : bits(0) {}
+    explicit constexpr CardMask(uint64_t b) : bits(b) {}
+
+    // Card index helpers (suit = Suit enum value, rank = Rank enum value where ace is 1)
+    static constexpr int RankIndex(int rank) { return (rank == 1) ? NUM_RANKS - 1 : rank - 2; }
+    static constexpr int CardIndex(int suit, int rank) { return suit * NUM_RANKS + RankIndex(rank); }
+    static constexpr int SuitOf(int cardIndex) { return cardIndex / NUM_RANKS; }
+    static constexpr int RankOf(int cardIndex) { return cardIndex % NUM_RANKS; }
+
+    static constexpr uint64_t BitOf(int cardIndex) {
+        return 1ULL << (SuitOf(cardIndex) * CARD_MASK_SUIT_BITS + RankOf(cardIndex));
+    }
+    static constexpr CardMask FromIndex(int cardIndex) { return CardMask(BitOf(cardIndex)); }
+    static constexpr CardMask FullDeck() {
+        return CardMask(0x1FFF1FFF1FFF1FFFULL);
+    }
+
+    // Set operations
+    void Add(int cardIndex) { bits |= BitOf(cardIndex); }
+    void Remove(int cardIndex) { bits &= ~BitOf(cardIndex); }
+    bool Has(int cardIndex) const { return (bits & BitOf(cardIndex)) != 0; }
+    bool IsEmpty() const { return bits == 0; }
+    int Count() const { return __builtin_popcountll(bits); }
+
+    // Per-suit and combined 13-bit rank masks
+    uint32_t SuitMask(int suit) const {
+        return static_cast<uint32_t>(bits >> (suit * CARD_MASK_SUIT_BITS)) & CARD_MASK_RANK_BITS;
+    }
+    uint32_t RankMask() const {
+        return SuitMask(0) | SuitMask(1) | SuitMask(2) | SuitMask(3);
+    }
+
+    // Iterate cards lowest-bit first: while (!m.IsEmpty()) { int c = m.PopFirst(); ... }
+    int First() const {
+        int bit = __builtin_ctzll(bits);
+        return (bit / CARD_MASK_SUIT_BITS) * NUM_RANKS + (bit % CARD_MASK_SUIT_BITS);
+    }
+    int PopFirst() {
+        int card = First();
+        bits &= bits - 1;
+        return card;
+    }
+
+    CardMask operator|(CardMask other) const { return CardMask(bits | other.bits); }
+    CardMask operator&(CardMask other) const { return CardMask(bits & other.bits); }
+    CardMask operator~() const { return CardMask(~bits & FullDeck().bits); }
+    CardMask& operator|=(CardMask other) { bits |= other.bits; return *this; }
+    CardMask& operator&=(CardMask other) { bits &= other.bits; return *this; }
+    bool operator==(CardMask other) const { return bits == other.bits; }
+    bool operator!=(CardMask other) const { return bits != other.bits; }
+};
+
+#endif
@@ -0,0 +1,514 @@
+#include "gameplay/cfr_trainer.hpp"
+#include "core/thread_pool.hpp"
+#include "gameplay/equity_engine.hpp"
+#include "gameplay/fast_deck.hpp"
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/poker_engine.hpp"
+#include "gameplay/preflop_table.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#define CFR_TABLE_SIZE (STRATEGY_INFOSETS * STRATEGY_ACTIONS)
+
+// Seed for one job, fixed by its position rather than by scheduling
+static uint64_t JobSeed(uint64_t base, uint64_t job) {
+    uint64_t state = base + job * 0x9E3779B97F4A7C15ULL;
+    return Rng::SplitMix64(state) | 1u;
+}
+
+// Runs jobs [0, count) on the pool, or inline without one
+template <class Job>
+static void RunJobs(int count, ThreadPool* pool, Job job) {
+    if (!pool) {
+        for (int i = 0; i < count; i++) job(i);
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        pool->Submit([&job, i] { job(i); });
+    }
+    pool->Wait();
+}
+
+// ========== ABSTRACT GAME ==========
+
+enum CfrStep {
+    STEP_CONTINUE,
+    STEP_FOLD,
+    STEP_SHOWDOWN
+};
+
+// Betting state of the heads-up abstract game (seat 0 = small blind)
+struct CfrNode {
+    int street;
+    int toAct;
+    int raises;             // This street
+    int bet[2];             // This street
+    int committed[2];       // This hand
+    uint8_t raisedMask;     // Seats that raised this street
+    uint8_t actedMask;      // Seats that acted since the last raise
+
+    CfrNode() : street(0), toAct(0), raises(0), raisedMask(0), actedMask(0) {
+        bet[0] = committed[0] = CFR_SMALL_BLIND;
+        bet[1] = committed[1] = CFR_BIG_BLIND;
+    }
+
+    int Stack(int seat) const { return CFR_STACK - committed[seat]; }
+    int Pot() const { return committed[0] + committed[1]; }
+    int CallAmount() const { return bet[1 - toAct] - bet[toAct]; }
+
+    bool CanRaise() const {
+        int seat = toAct;
+        return !((raisedMask >> seat) & 1u) && Stack(1 - seat) > 0 && Stack(seat) > CallAmount();
+    }
+
+    int Infoset(const CfrDeal& deal) const {
+        return StrategyTable::InfosetIndex(street, raises, CallAmount() > 0,
+                                           StrategyTable::PotBucket(Pot(), CFR_BIG_BLIND),
+                                           deal.buckets[toAct][street]);
+    }
+
+    // Legal actions as a mask over STRATEGY_ACTIONS (folding is only offered when facing a bet)
+    int LegalMask() const {
+        return (CallAmount() > 0 ? 1 : 0) | 2 | (CanRaise() ? 4 : 0);
+    }
+
+    void Commit(int seat, int amount) {
+        amount = std::min(amount, Stack(seat));
+        bet[seat] += amount;
+        committed[seat] += amount;
+    }
+
+    CfrStep Apply(int action) {
+        int seat = toAct;
+        if (action == 0) return STEP_FOLD;
+
+        if (action == 2) {
+            // Pot-sized: call, then raise by the whole pot
+            int call = CallAmount();
+            Commit(seat, call + Pot() + call);
+            raisedMask |= 1u << seat;
+            actedMask = 0;
+            raises++;
+        } else {
+            Commit(seat, CallAmount());
+        }
+        actedMask |= 1u << seat;
+
+        // A raise clears the acted bits, so the other seat acts again unless it is all-in
+        int other = 1 - seat;
+        uint8_t active = (Stack(0) > 0 ? 1u : 0u) | (Stack(1) > 0 ? 2u : 0u);
+        if ((active & ~actedMask) & (1u << other)) {
+            toAct = other;
+            return STEP_CONTINUE;
+        }
+
+        // Street over: run the board out once either seat is all-in
+        if (street == STRATEGY_STREETS - 1 || active != 3) return STEP_SHOWDOWN;
+        street++;
+        toAct = 1;   // Heads-up the big blind leads after the flop (as PokerEngine does)
+        raises = 0;
+        bet[0] = bet[1] = 0;
+        raisedMask = actedMask = 0;
+        return STEP_CONTINUE;
+    }
+
+    // Seat 0's winnings once the hand is over
+    double Payoff(CfrStep step, int folder, const CfrDeal& deal) const {
+        if (step == STEP_FOLD) return folder == 0 ? -committed[0] : committed[1];
+        if (deal.result > 0) return committed[1];
+        if (deal.result < 0) return -committed[0];
+        return (committed[1] - committed[0]) / 2.0;
+    }
+};
+
+// Regret matching over the legal actions of a node (uniform when nothing is positive)
+static void MatchLegal(const double* weights, int legal, double* out) {
+    double total = 0.0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        out[a] = ((legal >> a) & 1) ? std::max(weights[a], 0.0) : 0.0;
+        total += out[a];
+    }
+    if (total > 0.0) {
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) out[a] /= total;
+        return;
+    }
+    int count = __builtin_popcount(legal);
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) out[a] = ((legal >> a) & 1) ? 1.0 / count : 0.0;
+}
+
+// ========== CFR ==========
+
+namespace {
+
+// One job's share of an iteration: walks its deals against the iteration's fixed strategy
+struct CfrWalker {
+    const double* strategy;     // Current strategies, [infoset][action]
+    double* regretDelta;
+    double* strategyDelta;
+
+    // Expected winnings of seat 0; reach[] are each seat's own probability of playing to this node
+    double Walk(const CfrNode& node, const CfrDeal& deal, double reach0, double reach1) {
+        int seat = node.toAct;
+        int infoset = node.Infoset(deal);
+        int legal = node.LegalMask();
+
+        double probs[STRATEGY_ACTIONS];
+        MatchLegal(strategy + infoset * STRATEGY_ACTIONS, legal, probs);
+
+        double values[STRATEGY_ACTIONS] = {0.0, 0.0, 0.0};
+        double nodeValue = 0.0;
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+            if (!((legal >> a) & 1)) continue;
+
+            CfrNode child = node;
+            CfrStep step = child.Apply(a);
+            if (step == STEP_CONTINUE) {
+                values[a] = Walk(child, deal, seat == 0 ? reach0 * probs[a] : reach0,
+                                 seat == 1 ? reach1 * probs[a] : reach1);
+            } else {
+                values[a] = child.Payoff(step, seat, deal);
+            }
+            nodeValue += probs[a] * values[a];
+        }
+
+        // Regrets from the acting seat's side, weighted by how often the other seat gets here
+        double sign = (seat == 0) ? 1.0 : -1.0;
+        double otherReach = (seat == 0) ? reach1 : reach0;
+        double ownReach = (seat == 0) ? reach0 : reach1;
+        double* regret = regretDelta + infoset * STRATEGY_ACTIONS;
+        double* average = strategyDelta + infoset * STRATEGY_ACTIONS;
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+            if (!((legal >> a) & 1)) continue;
+            regret[a] += otherReach * sign * (values[a] - nodeValue);
+            average[a] += ownReach * probs[a];
+        }
+        return nodeValue;
+    }
+};
+
+// Best response for one seat against a fixed strategy, limited to the abstraction's infosets
+struct CfrResponder {
+    int seat;
+    const double* average;      // The strategy being exploited, [infoset][action]
+    const int8_t* policy;       // Responder's action per infoset
+    double* actionValues;       // Accumulated per [infoset][action] (nullptr = just evaluate)
+
+    // Responder's winnings; otherReach = the exploited seat's probability of playing to this node
+    double Walk(const CfrNode& node, const CfrDeal& deal, double otherReach) {
+        int infoset = node.Infoset(deal);
+        int legal = node.LegalMask();
+        int acting = node.toAct;
+        double sign = (seat == 0) ? 1.0 : -1.0;
+
+        double probs[STRATEGY_ACTIONS];
+        if (acting != seat) MatchLegal(average + infoset * STRATEGY_ACTIONS, legal, probs);
+
+        double values[STRATEGY_ACTIONS] = {0.0, 0.0, 0.0};
+        double nodeValue = 0.0;
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+            if (!((legal >> a) & 1)) continue;
+            if (acting != seat && probs[a] == 0.0) continue;
+
+            CfrNode child = node;
+            CfrStep step = child.Apply(a);
+            double reach = (acting == seat) ? otherReach : otherReach * probs[a];
+            values[a] = (step == STEP_CONTINUE) ? Walk(child, deal, reach)
+                                                : sign * child.Payoff(step, acting, deal);
+            if (acting != seat) nodeValue += probs[a] * values[a];
+        }
+        if (acting != seat) return nodeValue;
+
+        if (actionValues) {
+            for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+                if ((legal >> a) & 1) actionValues[infoset * STRATEGY_ACTIONS + a] += otherReach * values[a];
+            }
+        }
+
+        // The policy's action if it is legal here, otherwise this node's best
+        int choice = policy[infoset];
+        if (!((legal >> choice) & 1)) {
+            choice = 1;
+            for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+                if (((legal >> a) & 1) && values[a] > values[choice]) choice = a;
+            }
+        }
+        return values[choice];
+    }
+};
+
+}
+
+CfrTrainer::CfrTrainer(const CfrConfig& cfg)
+    : config(cfg), preflop(nullptr), regrets(CFR_TABLE_SIZE, 0.0), strategySums(CFR_TABLE_SIZE, 0.0),
+      iterations(0)
+{
+    config.jobs = std::max(1, config.jobs);
+    config.jobDeals = std::max(1, config.jobDeals);
+    config.bucketSamples = std::max(1, config.bucketSamples);
+}
+
+void CfrTrainer::SampleDeal(Rng& rng, CfrDeal& deal) const {
+    FastDeck deck(rng.Next());
+    CardMask hole[2];
+    int board[BOARD_SIZE];
+    for (int seat = 0; seat < 2; seat++) {
+        hole[seat] = CardMask::FromIndex(deck.Deal()) | CardMask::FromIndex(deck.Deal());
+    }
+    CardMask boardMask;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        board[i] = deck.Deal();
+        boardMask.Add(board[i]);
+    }
+
+    // Buckets are each seat's equity against one random hand given the cards it can see on that street
+    for (int seat = 0; seat < 2; seat++) {
+        for (int street = 0; street < STRATEGY_STREETS; street++) {
+            EquityRequest request;
+            request.hole = hole[seat];
+            request.opponents = 1;
+            request.maxSamples = config.bucketSamples;
+            request.exactThreshold = 0;  // Buckets only need a rough equity; enumerating late streets would dominate training
+            request.seed = rng.Next() | 1u;
+            int visible = (street == 0) ? 0 : street + 2;
+            for (int i = 0; i < visible; i++) request.board.Add(board[i]);
+
+            double equity = 0.0;
+            if (street != 0 || !preflop || !preflop->Lookup(hole[seat], 1, equity)) {
+                equity = EquityEngine::Calculate(request, nullptr).equity;
+            }
+            deal.buckets[seat][street] = static_cast<uint8_t>(StrategyTable::EquityBucket(equity));
+        }
+    }
+
+    HandStrength first = HandEvaluator::Evaluate(hole[0] | boardMask);
+    HandStrength second = HandEvaluator::Evaluate(hole[1] | boardMask);
+    deal.result = (first > second) ? 1 : (first < second) ? -1 : 0;
+}
+
+void CfrTrainer::CurrentStrategies(std::vector<double>& out) const {
+    out.resize(CFR_TABLE_SIZE);
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        GetCurrentStrategy(infoset, &out[infoset * STRATEGY_ACTIONS]);
+    }
+}
+
+void CfrTrainer::AverageStrategies(std::vector<double>& out) const {
+    out.resize(CFR_TABLE_SIZE);
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        GetAverageStrategy(infoset, &out[infoset * STRATEGY_ACTIONS]);
+    }
+}
+
+void CfrTrainer::GetCurrentStrategy(int infoset, double* out) const {
+    MatchLegal(&regrets[infoset * STRATEGY_ACTIONS], 7, out);
+}
+
+void CfrTrainer::GetAverageStrategy(int infoset, double* out) const {
+    const double* sums = &strategySums[infoset * STRATEGY_ACTIONS];
+    double total = 0.0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) total += sums[a];
+
+    // Never reached in training - check or call
+    if (total <= 0.0) {
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) out[a] = (a == 1) ? 1.0 : 0.0;
+        return;
+    }
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) out[a] = sums[a] / total;
+}
+
+void CfrTrainer::Train(int count, ThreadPool* pool) {
+    std::vector<double> strategy;
+    std::vector<std::vector<double>> regretDeltas(config.jobs, std::vector<double>(CFR_TABLE_SIZE));
+    std::vector<std::vector<double>> strategyDeltas(config.jobs, std::vector<double>(CFR_TABLE_SIZE));
+
+    for (int n = 0; n < count; n++) {
+        CurrentStrategies(strategy);
+        uint64_t iteration = iterations;
+
+        RunJobs(config.jobs, pool, [&](int job) {
+            std::fill(regretDeltas[job].begin(), regretDeltas[job].end(), 0.0);
+            std::fill(strategyDeltas[job].begin(), strategyDeltas[job].end(), 0.0);
+
+            Rng rng(JobSeed(config.seed, iteration * config.jobs + job));
+            CfrWalker walker;
+            walker.strategy = strategy.data();
+            walker.regretDelta = regretDeltas[job].data();
+            walker.strategyDelta = strategyDeltas[job].data();
+
+            CfrDeal deal;
+            for (int d = 0; d < config.jobDeals; d++) {
+                SampleDeal(rng, deal);
+                walker.Walk(CfrNode(), deal, 1.0, 1.0);
+            }
+        });
+
+        // Fold the jobs in a fixed order, so the result doesn't depend on the thread count
+        double weight = static_cast<double>(iteration + 1);
+        double scale = 1.0 / (config.jobs * config.jobDeals);
+        for (int i = 0; i < CFR_TABLE_SIZE; i++) {
+            double regret = 0.0;
+            double average = 0.0;
+            for (int job = 0; job < config.jobs; job++) {
+                regret += regretDeltas[job][i];
+                average += strategyDeltas[job][i];
+            }
+            regrets[i] = std::max(0.0, regrets[i] + regret * scale);
+            strategySums[i] += weight * average * scale;
+        }
+        iterations++;
+    }
+}
+
+// ========== EXPLOITABILITY ==========
+
+double CfrTrainer::BestResponseValue(int seat, const std::vector<CfrDeal>& fitDeals,
+                                     const std::vector<CfrDeal>& evalDeals,
+                                     const std::vector<double>& average, ThreadPool* pool) const {
+    int jobs = std::max(1, config.jobs);
+    std::vector<std::vector<double>> jobValues(jobs, std::vector<double>(CFR_TABLE_SIZE));
+    std::vector<double> jobTotals(jobs);
+
+    // Start from the strategy's own most likely action, then keep switching each infoset to its best action
+    std::vector<int8_t> policy(STRATEGY_INFOSETS);
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        const double* probs = &average[infoset * STRATEGY_ACTIONS];
+        policy[infoset] = static_cast<int8_t>(std::max_element(probs, probs + STRATEGY_ACTIONS) - probs);
+    }
+
+    // Sweeps fit the policy on one set of deals; the last pass scores it on the other, so the
+    // response can't simply memorize how the fitted deals turned out
+    for (int sweep = 0; sweep <= CFR_BR_SWEEPS; sweep++) {
+        bool improve = sweep < CFR_BR_SWEEPS;
+        const std::vector<CfrDeal>& deals = improve ? fitDeals : evalDeals;
+        RunJobs(jobs, pool, [&](int job) {
+            std::fill(jobValues[job].begin(), jobValues[job].end(), 0.0);
+            CfrResponder responder;
+            responder.seat = seat;
+            responder.average = average.data();
+            responder.policy = policy.data();
+            responder.actionValues = improve ? jobValues[job].data() : nullptr;
+
+            double total = 0.0;
+            for (size_t d = job; d < deals.size(); d += jobs) {
+                total += responder.Walk(CfrNode(), deals[d], 1.0);
+            }
+            jobTotals[job] = total;
+        });
+        if (!improve) break;
+
+        for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+            double best = 0.0;
+            int choice = -1;
+            for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+                double sum = 0.0;
+                for (int job = 0; job < jobs; job++) sum += jobValues[job][infoset * STRATEGY_ACTIONS + a];
+                if (sum != 0.0 && (choice < 0 || sum > best)) {
+                    best = sum;
+                    choice = a;
+                }
+            }
+            if (choice >= 0) policy[infoset] = static_cast<int8_t>(choice);
+        }
+    }
+
+    double value = 0.0;
+    for (int job = 0; job < jobs; job++) value += jobTotals[job];
+    return value / evalDeals.size();
+}
+
+double CfrTrainer::Exploitability(int dealCount, uint64_t seed, ThreadPool* pool) const {
+    if (dealCount < 1) return 0.0;
+
+    // Two independent samples of deals: one to fit the best responses, one to score them
+    std::vector<CfrDeal> deals[2];
+    int jobs = std::max(1, config.jobs);
+    for (int set = 0; set < 2; set++) {
+        std::vector<CfrDeal>& out = deals[set];
+        out.resize(dealCount);
+        RunJobs(jobs, pool, [&](int job) {
+            Rng rng(JobSeed(seed, set * jobs + job));
+            for (int d = job; d < dealCount; d += jobs) SampleDeal(rng, out[d]);
+        });
+    }
+
+    std::vector<double> average;
+    AverageStrategies(average);
+
+    // Each seat's best-response winnings; against an unexploitable strategy they sum to zero
+    double gain = BestResponseValue(0, deals[0], deals[1], average, pool) +
+                  BestResponseValue(1, deals[0], deals[1], average, pool);
+    return gain / 2.0 / CFR_BIG_BLIND * 1000.0;
+}
+
+// ========== FILES ==========
+
+bool CfrTrainer::SaveCheckpoint(const std::string& path) const {
+    CfrCheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = CFR_CHECKPOINT_MAGIC;
+    header.version = CFR_CHECKPOINT_VERSION;
+    header.actionCount = STRATEGY_ACTIONS;
+    header.infosetCount = STRATEGY_INFOSETS;
+    header.bucketSamples = config.bucketSamples;
+    header.jobs = config.jobs;
+    header.jobDeals = config.jobDeals;
+    header.iterations = iterations;
+    header.seed = config.seed;
+
+    // Write beside the old checkpoint and swap it in, so a crash mid-write keeps the last good one
+    std::string temp = path + ".tmp";
+    FILE* f = fopen(temp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(regrets.data(), sizeof(double), CFR_TABLE_SIZE, f) == CFR_TABLE_SIZE &&
+              fwrite(strategySums.data(), sizeof(double), CFR_TABLE_SIZE, f) == CFR_TABLE_SIZE;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        std::remove(temp.c_str());
+        return false;
+    }
+    return std::rename(temp.c_str(), path.c_str()) == 0;
+}
+
+bool CfrTrainer::LoadCheckpoint(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    CfrCheckpointHeader header;
+    std::vector<double> loadedRegrets(CFR_TABLE_SIZE);
+    std::vector<double> loadedSums(CFR_TABLE_SIZE);
+    bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+              header.magic == CFR_CHECKPOINT_MAGIC && header.version == CFR_CHECKPOINT_VERSION &&
+              header.actionCount == STRATEGY_ACTIONS && header.infosetCount == STRATEGY_INFOSETS &&
+              header.jobs > 0 && header.jobDeals > 0 && header.bucketSamples > 0 &&
+              fread(loadedRegrets.data(), sizeof(double), CFR_TABLE_SIZE, f) == CFR_TABLE_SIZE &&
+              fread(loadedSums.data(), sizeof(double), CFR_TABLE_SIZE, f) == CFR_TABLE_SIZE;
+    fclose(f);
+    if (!ok) return false;
+
+    regrets.swap(loadedRegrets);
+    strategySums.swap(loadedSums);
+    iterations = header.iterations;
+    config.seed = header.seed;
+    config.bucketSamples = header.bucketSamples;
+    config.jobs = header.jobs;
+    config.jobDeals = header.jobDeals;
+    return true;
+}
+
+bool CfrTrainer::WriteTable(const std::string& path, float exploitability) const {
+    std::vector<uint8_t> quantized(CFR_TABLE_SIZE);
+    double probs[STRATEGY_ACTIONS];
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        GetAverageStrategy(infoset, probs);
+        StrategyTable::Quantize(probs, &quantized[infoset * STRATEGY_ACTIONS]);
+    }
+
+    StrategyTableHeader header;
+    memset(&header, 0, sizeof(header));
+    header.iterations = iterations;
+    header.seed = config.seed;
+    header.exploitability = exploitability;
+    return StrategyTable::Write(path, header, quantized.data());
+}
@@ -0,0 +1,110 @@
+#ifndef CFR_TRAINER_HPP
+#define CFR_TRAINER_HPP
+
+#include "core/rng.hpp"
+#include "gameplay/strategy_table.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+class PreflopTable;
+
+// Abstract game: heads-up, seat 0 posts the small blind and acts first preflop, seat 1 (the big blind) acts first
+// after the flop (as PokerEngine does), raises are pot-sized, and a seat raises at most once per street (PokerEngine's rule)
+#define CFR_SMALL_BLIND 1
+#define CFR_BIG_BLIND 2
+#define CFR_STACK (100 * CFR_BIG_BLIND)      // Both seats start 100 big blinds deep
+
+// Training defaults
+#define CFR_BUCKET_SAMPLES 64                // Monte Carlo samples behind each equity bucket
+#define CFR_ITERATION_JOBS 32                // Pool jobs per CFR iteration (fixed, so results don't depend on threads)
+#define CFR_JOB_DEALS 16                     // Sampled deals per job
+#define CFR_EXPLOIT_DEALS 2000               // Deals the exploitability estimate is measured on
+#define CFR_BR_SWEEPS 3                      // Best-response improvement passes per seat
+
+#define CFR_CHECKPOINT_MAGIC 0x4B434643u     // "CFCK"
+#define CFR_CHECKPOINT_VERSION 2
+
+// Checkpoint header, followed by double regrets[STRATEGY_INFOSETS][STRATEGY_ACTIONS]
+// and double strategySums[STRATEGY_INFOSETS][STRATEGY_ACTIONS]
+struct CfrCheckpointHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t actionCount;
+    uint32_t infosetCount;
+    int32_t bucketSamples;
+    int32_t jobs;
+    int32_t jobDeals;
+    uint64_t iterations;
+    uint64_t seed;
+    uint8_t reserved[24];
+};
+static_assert(sizeof(CfrCheckpointHeader) == 64, "CfrCheckpointHeader layout is part of the checkpoint format");
+
+// One sampled deal, reduced to what the abstraction sees
+struct CfrDeal {
+    uint8_t buckets[2][STRATEGY_STREETS];    // Each seat's equity bucket per street
+    int8_t result;                           // Showdown: 1 = seat 0 wins, -1 = seat 1 wins, 0 = split
+};
+
+struct CfrConfig {
+    uint64_t seed;
+    int bucketSamples;
+    int jobs;               // Per iteration
+    int jobDeals;           // Per job
+
+    CfrConfig()
+        : seed(1), bucketSamples(CFR_BUCKET_SAMPLES), jobs(CFR_ITERATION_JOBS), jobDeals(CFR_JOB_DEALS) {}
+};
+
+// Offline chance-sampled CFR+ over StrategyTable's abstraction
+// Each iteration plays jobs x jobDeals sampled deals against the strategy the regrets imply at its start,
+// then folds every job's regrets in (regret matching+) and adds to a linearly weighted average strategy
+class CfrTrainer {
+private:
+    CfrConfig config;
+    const PreflopTable* preflop;             // Optional: preflop buckets straight from the table
+    std::vector<double> regrets;             // [infoset][action], never negative
+    std::vector<double> strategySums;        // Average strategy numerators
+    uint64_t iterations;
+
+    void CurrentStrategies(std::vector<double>& out) const;
+    void AverageStrategies(std::vector<double>& out) const;
+    double BestResponseValue(int seat, const std::vector<CfrDeal>& fitDeals, const std::vector<CfrDeal>& evalDeals,
+                             const std::vector<double>& average, ThreadPool* pool) const;
+
+public:
+    explicit CfrTrainer(const CfrConfig& config = CfrConfig());
+
+    void SetPreflopTable(const PreflopTable* table) { preflop = table; }
+
+    // Run CFR iterations (pool = nullptr runs every job on this thread)
+    void Train(int count, ThreadPool* pool);
+
+    // Draw and bucket one deal
+    void SampleDeal(Rng& rng, CfrDeal& deal) const;
+
+    // Strategies for one infoset (all STRATEGY_ACTIONS, summing to 1)
+    void GetCurrentStrategy(int infoset, double* out) const;
+    void GetAverageStrategy(int infoset, double* out) const;
+
+    // Estimated exploitability of the average strategy in milli-big-blinds per hand: both seats'
+    // best-response gain (a response limited to the same buckets, fitted on one sample of `deals` deals
+    // and scored on another, so it is a noisy lower bound)
+    double Exploitability(int deals, uint64_t seed, ThreadPool* pool) const;
+
+    // Checkpoint/resume (loading takes the checkpoint's seed and job layout, so training continues exactly)
+    bool SaveCheckpoint(const std::string& path) const;
+    bool LoadCheckpoint(const std::string& path);
+
+    // Quantize the average strategy into a StrategyTable file
+    bool WriteTable(const std::string& path, float exploitability) const;
+
+    // Accessors
+    uint64_t GetIterations() const { return iterations; }
+    uint64_t GetDeals() const { return iterations * config.jobs * config.jobDeals; }
+    const CfrConfig& GetConfig() const { return config; }
+};
+
+#endif
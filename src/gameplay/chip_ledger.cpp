@@ -0,0 +1,78 @@
+#include "gameplay/chip_ledger.hpp"
+
+int ChipLedger::IndexOf(int value) {
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        if (DENOMINATIONS[d] == value) return d;
+    }
+    return -1;
+}
+
+ChipLedger ChipLedger::FromAmount(int amount) {
+    ChipLedger ledger;
+    if (amount <= 0) return ledger;
+
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        ledger.counts[d] = amount / DENOMINATIONS[d];
+        amount %= DENOMINATIONS[d];
+    }
+    return ledger;
+}
+
+int ChipLedger::Total() const {
+    int total = 0;
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        total += counts[d] * DENOMINATIONS[d];
+    }
+    return total;
+}
+
+int ChipLedger::GetCount(int value) const {
+    int d = IndexOf(value);
+    return (d >= 0) ? counts[d] : 0;
+}
+
+void ChipLedger::Add(int value, int count) {
+    int d = IndexOf(value);
+    if (d >= 0) counts[d] += count;
+}
+
+void ChipLedger::Add(const ChipLedger& other) {
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        counts[d] += other.counts[d];
+    }
+}
+
+bool ChipLedger::Withdraw(int amount, ChipLedger& paid) {
+    if (amount <= 0) return true;
+    if (amount > Total()) return false;
+
+    // Pay largest chips first without overpaying
+    int remaining = amount;
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        int take = remaining / DENOMINATIONS[d];
+        if (take > counts[d]) take = counts[d];
+        counts[d] -= take;
+        paid.counts[d] += take;
+        remaining -= take * DENOMINATIONS[d];
+    }
+
+    if (remaining > 0) {
+        // Every chip left is worth more than what's still owed - break the smallest one
+        for (int d = CHIP_DENOMINATION_COUNT - 1; d >= 0; d--) {
+            if (counts[d] == 0 || DENOMINATIONS[d] <= remaining) continue;
+
+            counts[d]--;
+            paid.Add(FromAmount(remaining));
+            Add(FromAmount(DENOMINATIONS[d] - remaining));  // Change comes back
+            break;
+        }
+    }
+    return true;
+}
+
+bool ChipLedger::operator==(const ChipLedger& other) const {
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        if (counts[d] != other.counts[d]) return false;
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef CHIP_LEDGER_HPP
+#define CHIP_LEDGER_HPP
+
+#define CHIP_DENOMINATION_COUNT 5   // BLACK=100, GREEN=25, BLUE=10, RED=5, WHITE=1
+
+// Money as integer chip counts per denomination (largest first)
+// Bankrolls, bets and the pot are plain arithmetic on this - Chip objects only exist for what is drawn
+struct ChipLedger {
+    static constexpr int DENOMINATIONS[CHIP_DENOMINATION_COUNT] = {100, 25, 10, 5, 1};  // Must match Chip::GetColorFromValue()
+
+    int counts[CHIP_DENOMINATION_COUNT];
+
+    ChipLedger() : counts{0, 0, 0, 0, 0} {}
+
+    static int IndexOf(int value);              // Denomination slot for a chip value (-1 if invalid)
+    static ChipLedger FromAmount(int amount);   // Fewest chips that make up amount
+
+    int Total() const;
+    int GetCount(int value) const;
+    void Add(int value, int count = 1);
+    void Add(const ChipLedger& other);
+
+    // Move amount into paid, breaking one larger chip for change if the exact chips aren't there
+    // Returns false (and changes nothing) if the ledger holds less than amount
+    bool Withdraw(int amount, ChipLedger& paid);
+
+    bool operator==(const ChipLedger& other) const;
+    bool operator!=(const ChipLedger& other) const { return !(*this == other); }
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "gameplay/decision_service.hpp"
+#include "core/thread_pool.hpp"
+#include <chrono>
+
+DecisionService* DecisionService::globalInstance = nullptr;
+
+// ========== PENDING DECISION ==========
+
+bool PendingDecision::IsReady() const {
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+DecisionResult PendingDecision::Take() {
+    return future.get();
+}
+
+// ========== SERVICE ==========
+
+DecisionService::DecisionService(int threadCount) {
+    if (threadCount > 0) pool.reset(new ThreadPool(threadCount));
+}
+
+DecisionService::~DecisionService() {
+    // Let running jobs finish so their results land before the pool goes away
+    Wait();
+}
+
+PendingDecision DecisionService::Submit(std::function<DecisionResult()> job) {
+    // Shared so the pool's copyable task wrapper can own it
+    auto promise = std::make_shared<std::promise<DecisionResult>>();
+    PendingDecision pending(promise->get_future());
+
+    auto run = [promise, job] { promise->set_value(job()); };
+    if (pool) pool->Submit(run);
+    else run();
+    return pending;
+}
+
+void DecisionService::Wait() {
+    if (pool) pool->Wait();
+}
+
+int DecisionService::GetThreadCount() const {
+    return pool ? pool->GetThreadCount() : 0;
+}
+
+void DecisionService::SetGlobal(DecisionService* service) {
+    globalInstance = service;
+}
+
+DecisionService* DecisionService::GetGlobal() {
+    if (globalInstance) return globalInstance;
+    static DecisionService service(DECISION_WORKERS);
+    return &service;
+}
@@ -0,0 +1,67 @@
+#ifndef DECISION_SERVICE_HPP
+#define DECISION_SERVICE_HPP
+
+#include <functional>
+#include <future>
+#include <memory>
+
+class ThreadPool;
+
+#define DECISION_WORKERS 2      // Worker threads in the global service (decisions are rare but can be slow)
+
+// What a betting decision came out as
+struct DecisionResult {
+    int action;         // 0=fold, 1=call, 2=raise
+    int raiseAmount;    // Raise-to amount when action is a raise
+    double equity;      // Equity estimate behind it
+
+    DecisionResult() : action(0), raiseAmount(0), equity(0.0) {}
+};
+
+// A submitted decision: poll IsReady() once a frame, then Take() the result
+// Dropping a pending decision is safe - the job finishes on its worker and the result is discarded
+class PendingDecision {
+private:
+    std::future<DecisionResult> future;
+
+public:
+    PendingDecision() = default;
+    explicit PendingDecision(std::future<DecisionResult>&& f) : future(std::move(f)) {}
+
+    bool IsValid() const { return future.valid(); }
+    bool IsReady() const;       // Never blocks
+    DecisionResult Take();      // Only once IsReady(); leaves this invalid
+    void Reset() { future = std::future<DecisionResult>(); }
+};
+
+// Runs AI decision jobs off the main thread on its own pool
+// Jobs get a snapshot of the game state (nothing live), so they never need the main thread's objects;
+// a service with no workers runs each job inside Submit, so the decision is ready straight away
+// (the pool is separate from ThreadPool::GetGlobal() so a slow decision never stalls someone's Wait())
+class DecisionService {
+private:
+    std::unique_ptr<ThreadPool> pool;   // nullptr = run inline
+    static DecisionService* globalInstance;
+
+public:
+    explicit DecisionService(int threadCount = DECISION_WORKERS);
+    ~DecisionService();
+
+    DecisionService(const DecisionService&) = delete;
+    DecisionService& operator=(const DecisionService&) = delete;
+
+    PendingDecision Submit(std::function<DecisionResult()> job);
+
+    // Block until every submitted job has finished (shutdown and tests)
+    void Wait();
+
+    // Accessors
+    int GetThreadCount() const;
+    bool IsInline() const { return !pool; }
+
+    // Global instance management (created with DECISION_WORKERS on first use unless one was set)
+    static void SetGlobal(DecisionService* service);
+    static DecisionService* GetGlobal();
+};
+
+#endif
@@ -0,0 +1,376 @@
+#include "gameplay/equity_engine.hpp"
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/fast_deck.hpp"
+#include "core/thread_pool.hpp"
+#include <algorithm>
+#include <climits>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Raw per-worker counts, merged after the pool drains
+struct EquityTally {
+    int samples;
+    int wins;
+    int ties;
+    double equitySum;
+    double equitySquares;
+
+    EquityTally() : samples(0), wins(0), ties(0), equitySum(0.0), equitySquares(0.0) {}
+};
+
+// ========== SIMULATION ==========
+
+static void RunSamples(const EquityRequest& request, int opponents, int sampleCount,
+                       uint64_t seed, bool timed, Clock::time_point deadline, EquityTally& tally) {
+    // Known cards are dead; everything else can still come out
+    FastDeck deck(seed);
+    deck.RemoveDead(request.hole | request.board);
+
+    int boardNeeded = 5 - request.board.Count();
+    int cardsNeeded = boardNeeded + 2 * opponents;
+
+    // Hands for a whole batch of samples: ours first, then each opponent's
+    int perSample = opponents + 1;
+    CardMask hands[EQUITY_BATCH_SAMPLES * (EQUITY_MAX_OPPONENTS + 1)];
+    HandStrength strengths[EQUITY_BATCH_SAMPLES * (EQUITY_MAX_OPPONENTS + 1)];
+
+    while (tally.samples < sampleCount) {
+        int chunkEnd = std::min(sampleCount, tally.samples + EQUITY_CHUNK_SAMPLES);
+
+        while (tally.samples < chunkEnd) {
+            int batch = std::min(EQUITY_BATCH_SAMPLES, chunkEnd - tally.samples);
+
+            for (int b = 0; b < batch; b++) {
+                // Partial Fisher-Yates: only the cardsNeeded cards we deal get shuffled
+                int dealt[NUM_CARDS];
+                deck.Reset();
+                for (int i = 0; i < cardsNeeded; i++) {
+                    dealt[i] = deck.Deal();
+                }
+
+                CardMask board = request.board;
+                for (int i = 0; i < boardNeeded; i++) {
+                    board.Add(dealt[i]);
+                }
+
+                CardMask* sampleHands = &hands[b * perSample];
+                sampleHands[0] = request.hole | board;
+                for (int o = 0; o < opponents; o++) {
+                    sampleHands[1 + o] = board;
+                    sampleHands[1 + o].Add(dealt[boardNeeded + 2 * o]);
+                    sampleHands[1 + o].Add(dealt[boardNeeded + 2 * o + 1]);
+                }
+            }
+
+            // One SIMD pass scores every hand the batch dealt
+            HandEvaluator::EvaluateBatch(hands, batch * perSample, strengths);
+
+            for (int b = 0; b < batch; b++) {
+                const HandStrength* sampleStrengths = &strengths[b * perSample];
+                HandStrength ours = sampleStrengths[0];
+                bool lost = false;
+                int tiedWith = 0;
+                for (int o = 1; o <= opponents && !lost; o++) {
+                    if (sampleStrengths[o] > ours) lost = true;
+                    else if (sampleStrengths[o] == ours) tiedWith++;
+                }
+
+                double share = 0.0;
+                if (!lost) {
+                    if (tiedWith == 0) {
+                        tally.wins++;
+                        share = 1.0;
+                    } else {
+                        tally.ties++;
+                        share = 1.0 / (tiedWith + 1);
+                    }
+                }
+                tally.equitySum += share;
+                tally.equitySquares += share * share;
+            }
+            tally.samples += batch;
+        }
+
+        if (timed && Clock::now() >= deadline) break;
+    }
+}
+
+// ========== ENUMERATION ==========
+
+#define EQUITY_MAX_PAIRS (NUM_CARDS * (NUM_CARDS - 1) / 2)
+#define EQUITY_SUIT_PERMUTATIONS 24
+
+// Exact counts, weighted by how many suit-isomorphic runouts each enumerated one stands for
+struct ExactTally {
+    double combos;
+    double wins;
+    double ties;
+    double equitySum;
+
+    ExactTally() : combos(0.0), wins(0.0), ties(0.0), equitySum(0.0) {}
+};
+
+// One canonical runout and the number of runouts it stands in for
+struct ExactRunout {
+    CardMask board;
+    double weight;
+};
+
+static double ChooseTwo(int n) {
+    return n < 2 ? 0.0 : n * (n - 1) / 2.0;
+}
+
+// Ordered ways to hand two cards each to `opponents` players from `cards` cards
+static double OrderedHoldings(int cards, int opponents) {
+    double count = 1.0;
+    for (int o = 0; o < opponents; o++) count *= ChooseTwo(cards - 2 * o);
+    return count;
+}
+
+static CardMask PermuteSuits(CardMask mask, const int* perm) {
+    uint64_t bits = 0;
+    for (int suit = 0; suit < NUM_SUITS; suit++) {
+        bits |= static_cast<uint64_t>(mask.SuitMask(suit)) << (perm[suit] * CARD_MASK_SUIT_BITS);
+    }
+    return CardMask(bits);
+}
+
+// Suit permutations that leave the known cards where they are (always includes the identity)
+static int KnownCardSymmetries(CardMask known, int perms[EQUITY_SUIT_PERMUTATIONS][NUM_SUITS]) {
+    int perm[NUM_SUITS] = {0, 1, 2, 3};
+    int count = 0;
+    do {
+        if (PermuteSuits(known, perm) == known) {
+            std::copy(perm, perm + NUM_SUITS, perms[count]);
+            count++;
+        }
+    } while (std::next_permutation(perm, perm + NUM_SUITS));
+    return count;
+}
+
+// Every runout of boardNeeded cards, keeping one per suit-isomorphism class (the lowest mask)
+static void CanonicalRunouts(CardMask known, CardMask board, int boardNeeded, std::vector<ExactRunout>& out) {
+    int perms[EQUITY_SUIT_PERMUTATIONS][NUM_SUITS];
+    int symmetries = KnownCardSymmetries(known, perms);
+
+    int cards[NUM_CARDS];
+    int cardCount = 0;
+    CardMask live = ~known;
+    while (!live.IsEmpty()) cards[cardCount++] = live.PopFirst();
+
+    int picks[5];
+    for (int i = 0; i < boardNeeded; i++) picks[i] = i;
+    while (true) {
+        CardMask runout;
+        for (int i = 0; i < boardNeeded; i++) runout.Add(cards[picks[i]]);
+
+        // Orbit size = symmetries / symmetries that map this runout onto itself
+        bool canonical = true;
+        int fixedBy = 0;
+        for (int g = 0; g < symmetries && canonical; g++) {
+            CardMask image = PermuteSuits(runout, perms[g]);
+            if (image.bits < runout.bits) canonical = false;
+            else if (image == runout) fixedBy++;
+        }
+        if (canonical) {
+            ExactRunout entry;
+            entry.board = board | runout;
+            entry.weight = static_cast<double>(symmetries) / fixedBy;
+            out.push_back(entry);
+        }
+
+        // Next combination in lexicographic order
+        int i = boardNeeded - 1;
+        while (i >= 0 && picks[i] == cardCount - boardNeeded + i) i--;
+        if (i < 0) break;
+        picks[i]++;
+        for (int j = i + 1; j < boardNeeded; j++) picks[j] = picks[j - 1] + 1;
+    }
+}
+
+// Walk every ordered assignment of the remaining holdings to opponentsLeft players
+// A holding that beats ours settles the rest without walking it - they all lose
+static void CountHoldings(const CardMask* pairs, const HandStrength* strengths, int pairCount, HandStrength ours,
+                          int opponentsLeft, CardMask used, int freeCards, int tiedWith, double weight,
+                          ExactTally& tally) {
+    if (opponentsLeft == 0) {
+        tally.combos += weight;
+        if (tiedWith == 0) tally.wins += weight;
+        else tally.ties += weight;
+        tally.equitySum += weight / (tiedWith + 1);
+        return;
+    }
+
+    for (int p = 0; p < pairCount; p++) {
+        if (!(pairs[p] & used).IsEmpty()) continue;
+        if (strengths[p] > ours) {
+            tally.combos += weight * OrderedHoldings(freeCards - 2, opponentsLeft - 1);
+            continue;
+        }
+        CountHoldings(pairs, strengths, pairCount, ours, opponentsLeft - 1, used | pairs[p], freeCards - 2,
+                      tiedWith + (strengths[p] == ours ? 1 : 0), weight, tally);
+    }
+}
+
+// Score every opponent holding once against the full board, then count the outcomes
+static void EnumerateRunout(CardMask hole, const ExactRunout& runout, int opponents, ExactTally& tally) {
+    CardMask live = ~(hole | runout.board);
+    int cards[NUM_CARDS];
+    int cardCount = 0;
+    while (!live.IsEmpty()) cards[cardCount++] = live.PopFirst();
+
+    CardMask pairs[EQUITY_MAX_PAIRS];
+    HandStrength strengths[EQUITY_MAX_PAIRS];
+    int pairCount = 0;
+    for (int i = 0; i < cardCount; i++) {
+        for (int j = i + 1; j < cardCount; j++) {
+            pairs[pairCount++] = CardMask::FromIndex(cards[i]) | CardMask::FromIndex(cards[j]);
+        }
+    }
+    HandEvaluator::EvaluateBatch(runout.board, pairs, pairCount, strengths);
+    HandStrength ours = HandEvaluator::Evaluate(hole | runout.board);
+
+    CountHoldings(pairs, strengths, pairCount, ours, opponents, CardMask(), cardCount, 0, runout.weight, tally);
+}
+
+// ========== PUBLIC API ==========
+
+// Opponents the remaining deck can actually seat; false when there is nothing left to work out
+static bool SeatOpponents(const EquityRequest& request, int& opponents, EquityResult& result) {
+    int known = (request.hole | request.board).Count();
+    int boardNeeded = 5 - request.board.Count();
+    if (boardNeeded < 0) return false;
+
+    opponents = std::min(request.opponents, EQUITY_MAX_OPPONENTS);
+    opponents = std::min(opponents, (NUM_CARDS - known - boardNeeded) / 2);
+    if (opponents <= 0) {
+        // Nobody left to beat
+        result.win = 1.0;
+        result.equity = 1.0;
+        return false;
+    }
+    return true;
+}
+
+double EquityEngine::CountCompletions(int unknownCards, int boardNeeded, int opponents) {
+    if (boardNeeded < 0 || unknownCards < boardNeeded) return 0.0;
+    double runouts = 1.0;
+    for (int i = 0; i < boardNeeded; i++) runouts = runouts * (unknownCards - i) / (i + 1);
+    return runouts * OrderedHoldings(unknownCards - boardNeeded, opponents);
+}
+
+EquityResult EquityEngine::Calculate(const EquityRequest& request) {
+    return Calculate(request, ThreadPool::GetGlobal());
+}
+
+EquityResult EquityEngine::Calculate(const EquityRequest& request, ThreadPool* pool) {
+    EquityResult result;
+    int opponents = 0;
+    if (!SeatOpponents(request, opponents, result)) return result;
+
+    // Few enough completions left that enumerating them is cheaper than sampling (and exact)
+    int unknown = NUM_CARDS - (request.hole | request.board).Count();
+    double completions = CountCompletions(unknown, 5 - request.board.Count(), opponents);
+    if (request.exactThreshold > 0 && completions <= request.exactThreshold) return Enumerate(request, pool);
+    return Sample(request, pool);
+}
+
+EquityResult EquityEngine::Enumerate(const EquityRequest& request, ThreadPool* pool) {
+    EquityResult result;
+    int opponents = 0;
+    if (!SeatOpponents(request, opponents, result)) return result;
+
+    CardMask known = request.hole | request.board;
+    std::vector<ExactRunout> runouts;
+    CanonicalRunouts(known, request.board, 5 - request.board.Count(), runouts);
+
+    // Contiguous slices of the runouts per worker, merged in order
+    int workerCount = pool ? pool->GetThreadCount() : 1;
+    workerCount = std::max(1, std::min(workerCount, static_cast<int>(runouts.size())));
+    std::vector<ExactTally> tallies(workerCount);
+    for (int w = 0; w < workerCount; w++) {
+        size_t begin = runouts.size() * w / workerCount;
+        size_t end = runouts.size() * (w + 1) / workerCount;
+        ExactTally* tally = &tallies[w];
+        auto work = [&request, &runouts, opponents, begin, end, tally] {
+            for (size_t r = begin; r < end; r++) EnumerateRunout(request.hole, runouts[r], opponents, *tally);
+        };
+        if (pool && workerCount > 1) pool->Submit(work);
+        else work();
+    }
+    if (pool && workerCount > 1) pool->Wait();
+
+    ExactTally total;
+    for (const ExactTally& tally : tallies) {
+        total.combos += tally.combos;
+        total.wins += tally.wins;
+        total.ties += tally.ties;
+        total.equitySum += tally.equitySum;
+    }
+    if (total.combos <= 0.0) return result;
+
+    result.exact = true;
+    result.samples = static_cast<int>(std::min(total.combos, static_cast<double>(INT_MAX)));
+    result.win = total.wins / total.combos;
+    result.tie = total.ties / total.combos;
+    result.equity = total.equitySum / total.combos;
+    return result;
+}
+
+EquityResult EquityEngine::Sample(const EquityRequest& request, ThreadPool* pool) {
+    EquityResult result;
+    int opponents = 0;
+    if (!SeatOpponents(request, opponents, result)) return result;
+    if (request.maxSamples <= 0) return result;
+
+    bool timed = request.maxSeconds > 0.0f;
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(request.maxSeconds));
+
+    uint64_t seed = (request.seed != 0) ? request.seed : Rng::RandomSeed();
+
+    int workerCount = pool ? pool->GetThreadCount() : 1;
+    workerCount = std::max(1, std::min(workerCount, request.maxSamples / EQUITY_CHUNK_SAMPLES));
+    std::vector<EquityTally> tallies(workerCount);
+
+    int perWorker = request.maxSamples / workerCount;
+    for (int w = 0; w < workerCount; w++) {
+        // Last worker picks up the remainder so the budget is hit exactly
+        int samples = (w == workerCount - 1) ? request.maxSamples - perWorker * w : perWorker;
+        uint64_t workerSeed = seed + 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(w);
+        EquityTally* tally = &tallies[w];
+
+        if (pool && workerCount > 1) {
+            pool->Submit([&request, opponents, samples, workerSeed, timed, deadline, tally] {
+                RunSamples(request, opponents, samples, workerSeed, timed, deadline, *tally);
+            });
+        } else {
+            RunSamples(request, opponents, samples, workerSeed, timed, deadline, *tally);
+        }
+    }
+    if (pool && workerCount > 1) pool->Wait();
+
+    EquityTally total;
+    for (const EquityTally& tally : tallies) {
+        total.samples += tally.samples;
+        total.wins += tally.wins;
+        total.ties += tally.ties;
+        total.equitySum += tally.equitySum;
+        total.equitySquares += tally.equitySquares;
+    }
+    if (total.samples == 0) return result;
+
+    double n = static_cast<double>(total.samples);
+    result.samples = total.samples;
+    result.win = total.wins / n;
+    result.tie = total.ties / n;
+    result.equity = total.equitySum / n;
+
+    double variance = std::max(0.0, total.equitySquares / n - result.equity * result.equity);
+    result.margin = EQUITY_Z_95 * std::sqrt(variance / n);
+
+    return result;
+}
@@ -0,0 +1,58 @@
+#ifndef EQUITY_ENGINE_HPP
+#define EQUITY_ENGINE_HPP
+
+#include "gameplay/card_mask.hpp"
+#include <cstdint>
+
+class ThreadPool;
+
+#define EQUITY_MAX_OPPONENTS 9      // MAX_SEATS - 1
+#define EQUITY_CHUNK_SAMPLES 256    // Samples between budget checks
+#define EQUITY_BATCH_SAMPLES 16     // Samples dealt per HandEvaluator::EvaluateBatch call
+#define EQUITY_Z_95 1.96            // z-score for a 95% confidence interval
+#define EQUITY_EXACT_THRESHOLD 50000 // Enumerate instead of sampling at or below this many completions (turn heads-up is 45,540)
+
+// What to simulate and how much work is allowed
+struct EquityRequest {
+    CardMask hole;        // Our hole cards
+    CardMask board;       // Visible community cards (0-5)
+    int opponents;        // Live opponents with unknown hole cards
+    int maxSamples;       // Sample budget
+    float maxSeconds;     // Time budget (0 = samples only)
+    uint64_t seed;        // Base seed (each worker derives its own stream, 0 = random)
+    int exactThreshold;   // Enumerate every completion when there are at most this many (0 = always sample)
+
+    EquityRequest()
+        : opponents(1), maxSamples(10000), maxSeconds(0.0f), seed(0), exactThreshold(EQUITY_EXACT_THRESHOLD) {}
+};
+
+// Equity for one hand (a Monte Carlo estimate, or exact when every completion was enumerated)
+struct EquityResult {
+    double win;         // P(we beat every opponent)
+    double tie;         // P(we split the pot)
+    double equity;      // Expected pot share (win + split shares)
+    double margin;      // 95% confidence half-width on equity (0 when exact)
+    int samples;        // Completions actually run (every completion when exact)
+    bool exact;         // Enumerated rather than sampled
+
+    EquityResult() : win(0.0), tie(0.0), equity(0.0), margin(0.0), samples(0), exact(false) {}
+};
+
+// Static utility class for estimating hand equity against random opponent holdings
+// Samples are split across a thread pool; every worker stops at the sample or time budget
+// Once few enough completions are left (late streets), Calculate enumerates them all instead: runouts
+// that only differ by swapping suits the known cards can't tell apart are evaluated once and weighted
+class EquityEngine {
+public:
+    static EquityResult Calculate(const EquityRequest& request, ThreadPool* pool);
+    static EquityResult Calculate(const EquityRequest& request);  // Uses ThreadPool::GetGlobal()
+
+    // Always sample / always enumerate, whatever the threshold says (budgets don't apply to Enumerate)
+    static EquityResult Sample(const EquityRequest& request, ThreadPool* pool);
+    static EquityResult Enumerate(const EquityRequest& request, ThreadPool* pool);
+
+    // Board runouts x ordered opponent holdings left to deal from unknownCards cards
+    static double CountCompletions(int unknownCards, int boardNeeded, int opponents);
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef FAST_DECK_HPP
+#define FAST_DECK_HPP
+
+#include "core/rng.hpp"
+#include "gameplay/card_mask.hpp"
+
+// Allocation-free 52-card deck of card indices for dealing in hot loops (engine, equity, simulator)
+// Each Deal() is one step of a partial Fisher-Yates, so only the cards actually dealt get shuffled
+// and Reset() is O(1). Known cards can be taken out as dead so they are never dealt.
+//
+// Layout of cards[]: [0, dealt) dealt | [dealt, liveCount) undealt | [liveCount, NUM_CARDS) dead
+class FastDeck {
+private:
+    int cards[NUM_CARDS];
+    int slot[NUM_CARDS];    // Where each card index currently sits in cards[]
+    int dealt;
+    int liveCount;
+    bool peeked;            // cards[dealt] has already been picked by Peek()
+    Rng rng;
+
+    void Swap(int a, int b) {
+        int cardA = cards[a];
+        int cardB = cards[b];
+        cards[a] = cardB;
+        cards[b] = cardA;
+        slot[cardB] = a;
+        slot[cardA] = b;
+    }
+
+    // Bring a random undealt card to the front of the undealt range
+    void Pick() {
+        int pick = dealt + static_cast<int>(rng.Below(static_cast<uint32_t>(liveCount - dealt)));
+        Swap(dealt, pick);
+    }
+
+public:
+    explicit FastDeck(uint64_t seed = 0) { Seed(seed); }
+
+    // Restart from the same ordered deck and generator state: same seed, same deals
+    void Seed(uint64_t seed) {
+        for (int i = 0; i < NUM_CARDS; i++) {
+            cards[i] = i;
+            slot[i] = i;
+        }
+        dealt = 0;
+        liveCount = NUM_CARDS;
+        peeked = false;
+        rng.Seed(seed);
+    }
+
+    // Put dealt cards back (dead cards stay out)
+    void Reset() {
+        dealt = 0;
+        peeked = false;
+    }
+
+    // Put every card back, dead ones included
+    void ResetAll() {
+        dealt = 0;
+        liveCount = NUM_CARDS;
+        peeked = false;
+    }
+
+    // Next random card index, or -1 if the deck is empty
+    int Deal() {
+        if (dealt >= liveCount) return -1;
+        if (!peeked) Pick();
+        peeked = false;
+        return cards[dealt++];
+    }
+
+    // The card Deal() will return next (fixed until then)
+    int Peek() {
+        if (dealt >= liveCount) return -1;
+        if (!peeked) {
+            Pick();
+            peeked = true;
+        }
+        return cards[dealt];
+    }
+
+    // Take an undealt card out of play; returns false if it was already dealt or dead
+    bool RemoveDead(int cardIndex) {
+        if (cardIndex < 0 || cardIndex >= NUM_CARDS) return false;
+        int at = slot[cardIndex];
+        if (at < dealt || at >= liveCount) return false;
+
+        if (at == dealt) peeked = false;
+        Swap(at, liveCount - 1);
+        liveCount--;
+        return true;
+    }
+
+    void RemoveDead(CardMask dead) {
+        while (!dead.IsEmpty()) {
+            RemoveDead(dead.PopFirst());
+        }
+    }
+
+    // Accessors
+    int GetRemaining() const { return liveCount - dealt; }
+    int GetDealtCount() const { return dealt; }
+    int GetUndealt(int i) const { return cards[dealt + i]; }   // i in [0, GetRemaining())
+    bool IsEmpty() const { return dealt >= liveCount; }
+    CardMask GetRemainingMask() const {
+        CardMask mask;
+        for (int i = dealt; i < liveCount; i++) mask.Add(cards[i]);
+        return mask;
+    }
+    Rng& GetRng() { return rng; }
+};
+
+#endif
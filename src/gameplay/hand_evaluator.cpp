@@ -0,0 +1,280 @@
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/hand_evaluator_simd.hpp"
+#include <array>
+#include <atomic>
+
+// ========== LOOKUP TABLES ==========
+// Indexed by a 13-bit rank mask (bit 0 = two ... bit 12 = ace)
+
+#define RANK_MASK_COUNT 8192
+
+struct EvaluatorTables {
+    std::array<uint32_t, RANK_MASK_COUNT> topFive;  // Five highest ranks packed into kicker slots
+    std::array<uint32_t, RANK_MASK_COUNT> flush;    // Full strength of a suit mask with 5+ cards (0 otherwise)
+};
+
+static constexpr EvaluatorTables BuildTables() {
+    EvaluatorTables tables = {};
+
+    for (int mask = 0; mask < RANK_MASK_COUNT; mask++) {
+        // Pack up to five highest ranks, most significant slot first
+        uint32_t slots = 0;
+        int taken = 0;
+        for (int r = NUM_RANKS - 1; r >= 0 && taken < 5; r--) {
+            if (mask & (1 << r)) {
+                slots |= static_cast<uint32_t>(r) << (16 - 4 * taken);
+                taken++;
+            }
+        }
+        tables.topFive[mask] = slots;
+
+        // Flush / straight flush / royal flush for this suit mask (the batch kernels look it up per suit)
+        if (taken == 5) {
+            uint32_t m = (static_cast<uint32_t>(mask) << 1) | (static_cast<uint32_t>(mask) >> (NUM_RANKS - 1));
+            uint32_t runs = m & (m >> 1) & (m >> 2) & (m >> 3) & (m >> 4);
+            int straightHigh = -1;
+            for (int bit = 31; bit >= 0 && runs; bit--) {
+                if (runs & (1u << bit)) {
+                    straightHigh = bit + 3;
+                    break;
+                }
+            }
+
+            if (straightHigh == NUM_RANKS - 1) {
+                tables.flush[mask] = (static_cast<uint32_t>(ROYAL_FLUSH) << HAND_RANK_SHIFT) | (static_cast<uint32_t>(straightHigh) << 16);
+            } else if (straightHigh >= 0) {
+                tables.flush[mask] = (static_cast<uint32_t>(STRAIGHT_FLUSH) << HAND_RANK_SHIFT) | (static_cast<uint32_t>(straightHigh) << 16);
+            } else {
+                tables.flush[mask] = (static_cast<uint32_t>(FLUSH) << HAND_RANK_SHIFT) | slots;
+            }
+        }
+    }
+
+    return tables;
+}
+
+// Built at compile time - nothing to initialize and no races between threads
+static constexpr EvaluatorTables tables = BuildTables();
+
+// ========== HELPERS ==========
+
+static inline HandStrength MakeStrength(HandRank rank, uint32_t slots) {
+    return (static_cast<uint32_t>(rank) << HAND_RANK_SHIFT) | slots;
+}
+
+static inline int HighestRank(uint32_t mask) {
+    return 31 - __builtin_clz(mask);
+}
+
+static inline int CountRanks(uint32_t mask) {
+    return __builtin_popcount(mask);
+}
+
+// Top rank index of the best straight in a rank mask, or -1 if there is none
+static inline int StraightHigh(uint32_t mask) {
+    // Shift everything up one and copy the ace into bit 0 so the wheel is a normal run
+    uint32_t m = (mask << 1) | (mask >> (NUM_RANKS - 1));
+    uint32_t runs = m & (m >> 1) & (m >> 2) & (m >> 3) & (m >> 4);
+    if (!runs) return -1;
+    // A run starting at bit j tops out at bit j + 4, which is rank index j + 3
+    return HighestRank(runs) + 3;
+}
+
+// ========== EVALUATION ==========
+
+HandStrength HandEvaluator::Evaluate(const int* cards, int count) {
+    CardMask hand;
+
+    for (int i = 0; i < count; i++) {
+        int card = cards[i];
+        if (card < 0 || card >= NUM_CARDS) continue;
+        hand.Add(card);
+    }
+
+    return Evaluate(hand);
+}
+
+HandStrength HandEvaluator::Evaluate(CardMask hand) {
+    uint32_t suitMasks[NUM_SUITS] = {
+        hand.SuitMask(0), hand.SuitMask(1), hand.SuitMask(2), hand.SuitMask(3)
+    };
+
+    // Flushes beat everything below a full house, so check them first
+    // (with more than seven cards several suits can qualify - keep the best)
+    HandStrength bestFlush = 0;
+    for (int s = 0; s < NUM_SUITS; s++) {
+        uint32_t mask = suitMasks[s];
+        if (CountRanks(mask) < 5) continue;
+
+        HandStrength flush;
+        int straightHigh = StraightHigh(mask);
+        if (straightHigh == NUM_RANKS - 1) {
+            flush = MakeStrength(ROYAL_FLUSH, static_cast<uint32_t>(straightHigh) << 16);
+        } else if (straightHigh >= 0) {
+            flush = MakeStrength(STRAIGHT_FLUSH, static_cast<uint32_t>(straightHigh) << 16);
+        } else {
+            flush = MakeStrength(FLUSH, tables.topFive[mask]);
+        }
+        if (flush > bestFlush) bestFlush = flush;
+    }
+    if (bestFlush >= MakeStrength(STRAIGHT_FLUSH, 0)) return bestFlush;
+
+    // Bit-sliced rank counters: count = b0 + 2*b1 + 4*b2 for every rank at once
+    uint32_t b0 = 0, b1 = 0, b2 = 0;
+    for (int s = 0; s < NUM_SUITS; s++) {
+        uint32_t x = suitMasks[s];
+        uint32_t carry0 = b0 & x;
+        b0 ^= x;
+        uint32_t carry1 = b1 & carry0;
+        b1 ^= carry0;
+        b2 |= carry1;
+    }
+
+    uint32_t all = hand.RankMask();
+    uint32_t quads = b2;
+    uint32_t trips = b1 & b0;
+    uint32_t pairs = b1 & ~b0;
+
+    if (quads) {
+        int q = HighestRank(quads);
+        uint32_t rest = all & ~(1u << q);
+        uint32_t slots = (static_cast<uint32_t>(q) << 16);
+        if (rest) slots |= static_cast<uint32_t>(HighestRank(rest)) << 12;
+        return MakeStrength(FOUR_OF_KIND, slots);
+    }
+
+    if (trips) {
+        int t = HighestRank(trips);
+        uint32_t others = (trips & ~(1u << t)) | pairs;
+        if (others) {
+            return MakeStrength(FULL_HOUSE, (static_cast<uint32_t>(t) << 16) |
+                                            (static_cast<uint32_t>(HighestRank(others)) << 12));
+        }
+    }
+
+    if (bestFlush) return bestFlush;
+
+    int straightHigh = StraightHigh(all);
+    if (straightHigh >= 0) {
+        return MakeStrength(STRAIGHT, static_cast<uint32_t>(straightHigh) << 16);
+    }
+
+    if (trips) {
+        int t = HighestRank(trips);
+        uint32_t kickers = (tables.topFive[all & ~(1u << t)] >> 4) & 0xFF00;
+        return MakeStrength(THREE_OF_KIND, (static_cast<uint32_t>(t) << 16) | kickers);
+    }
+
+    if (CountRanks(pairs) >= 2) {
+        int high = HighestRank(pairs);
+        int low = HighestRank(pairs & ~(1u << high));
+        uint32_t kickers = (tables.topFive[all & ~(1u << high) & ~(1u << low)] >> 8) & 0xF00;
+        return MakeStrength(TWO_PAIR, (static_cast<uint32_t>(high) << 16) |
+                                      (static_cast<uint32_t>(low) << 12) | kickers);
+    }
+
+    if (pairs) {
+        int p = HighestRank(pairs);
+        uint32_t kickers = (tables.topFive[all & ~(1u << p)] >> 4) & 0xFFF0;
+        return MakeStrength(PAIR, (static_cast<uint32_t>(p) << 16) | kickers);
+    }
+
+    return MakeStrength(HIGH_CARD, tables.topFive[all]);
+}
+
+// ========== BATCH EVALUATION ==========
+
+static_assert(sizeof(CardMask) == sizeof(uint64_t), "Batch kernels read CardMask arrays as uint64_t");
+
+static const EvaluatorLaneTables laneTables = { tables.topFive.data(), tables.flush.data() };
+
+// -1 until first use, then the kernel every batch call runs
+static std::atomic<int> activeKernel(-1);
+
+static EvaluatorKernel DetectKernel() {
+    if (HandEvaluator::IsKernelSupported(KERNEL_AVX2)) return KERNEL_AVX2;
+    if (HandEvaluator::IsKernelSupported(KERNEL_SSE4)) return KERNEL_SSE4;
+    return KERNEL_SCALAR;
+}
+
+bool HandEvaluator::IsKernelSupported(EvaluatorKernel kernel) {
+    switch (kernel) {
+        case KERNEL_SCALAR:
+            return true;
+#if defined(__x86_64__) || defined(__i386__)
+        case KERNEL_SSE4:
+            return EvaluatorKernels::HasSSE4() && __builtin_cpu_supports("sse4.1");
+        case KERNEL_AVX2:
+            return EvaluatorKernels::HasAVX2() && __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+EvaluatorKernel HandEvaluator::GetKernel() {
+    int kernel = activeKernel.load(std::memory_order_relaxed);
+    if (kernel < 0) {
+        kernel = DetectKernel();
+        activeKernel.store(kernel, std::memory_order_relaxed);
+    }
+    return static_cast<EvaluatorKernel>(kernel);
+}
+
+bool HandEvaluator::SetKernel(EvaluatorKernel kernel) {
+    if (!IsKernelSupported(kernel)) return false;
+    activeKernel.store(kernel, std::memory_order_relaxed);
+    return true;
+}
+
+void HandEvaluator::EvaluateBatch(const CardMask* hands, int count, HandStrength* out) {
+    EvaluateBatch(CardMask(), hands, count, out);
+}
+
+void HandEvaluator::EvaluateBatch(CardMask board, const CardMask* hands, int count, HandStrength* out) {
+    const uint64_t* bits = reinterpret_cast<const uint64_t*>(hands);
+    int done = 0;
+
+    switch (GetKernel()) {
+        case KERNEL_AVX2:
+            done = EvaluatorKernels::BatchAVX2(bits, board.bits, count, out, laneTables);
+            break;
+        case KERNEL_SSE4:
+            done = EvaluatorKernels::BatchSSE4(bits, board.bits, count, out, laneTables);
+            break;
+        default:
+            break;
+    }
+
+    // Scalar fallback, and the tail that doesn't fill a whole register
+    for (; done < count; done++) {
+        out[done] = Evaluate(hands[done] | board);
+    }
+}
+
+// ========== NAMES ==========
+
+const char* HandEvaluator::GetRankName(HandRank rank) {
+    switch (rank) {
+        case HIGH_CARD:      return "High Card";
+        case PAIR:           return "Pair";
+        case TWO_PAIR:       return "Two Pair";
+        case THREE_OF_KIND:  return "Three of a Kind";
+        case STRAIGHT:       return "Straight";
+        case FLUSH:          return "Flush";
+        case FULL_HOUSE:     return "Full House";
+        case FOUR_OF_KIND:   return "Four of a Kind";
+        case STRAIGHT_FLUSH: return "Straight Flush";
+        case ROYAL_FLUSH:    return "Royal Flush";
+        default:             return "Unknown";
+    }
+}
+
+const char* HandEvaluator::GetKernelName(EvaluatorKernel kernel) {
+    switch (kernel) {
+        case KERNEL_SCALAR: return "scalar";
+        case KERNEL_SSE4:   return "sse4";
+        case KERNEL_AVX2:   return "avx2";
+        default:            return "unknown";
+    }
+}
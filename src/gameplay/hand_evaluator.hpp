@@ -0,0 +1,60 @@
+#ifndef HAND_EVALUATOR_HPP
+#define HAND_EVALUATOR_HPP
+
+#include <cstdint>
+#include "gameplay/card_mask.hpp"
+
+// Hand rankings
+enum HandRank {
+    HIGH_CARD = 0,
+    PAIR = 1,
+    TWO_PAIR = 2,
+    THREE_OF_KIND = 3,
+    STRAIGHT = 4,
+    FLUSH = 5,
+    FULL_HOUSE = 6,
+    FOUR_OF_KIND = 7,
+    STRAIGHT_FLUSH = 8,
+    ROYAL_FLUSH = 9
+};
+
+// Comparable hand strength (higher wins, equal = split)
+// Layout: bits 20-23 = HandRank, bits 0-19 = five 4-bit rank slots (most significant first)
+typedef uint32_t HandStrength;
+
+#define HAND_RANK_SHIFT 20
+
+// Which implementation EvaluateBatch() runs (picked from the CPU at startup)
+enum EvaluatorKernel {
+    KERNEL_SCALAR = 0,
+    KERNEL_SSE4 = 1,    // 4 hands per pass
+    KERNEL_AVX2 = 2     // 8 hands per pass
+};
+
+// Static utility class for scoring 5-7 card poker hands with precomputed lookup tables
+// Does no allocation, so it is safe to call from any hot path
+class HandEvaluator {
+public:
+    // Score every card in the mask (5 or more cards)
+    static HandStrength Evaluate(CardMask hand);
+
+    // Score a set of card indices (duplicates are ignored)
+    static HandStrength Evaluate(const int* cards, int count);
+
+    // Score many hands in one call with the fastest kernel the CPU supports
+    // Results are identical to Evaluate() for every hand; the shared-board form scores hands[i] | board
+    static void EvaluateBatch(const CardMask* hands, int count, HandStrength* out);
+    static void EvaluateBatch(CardMask board, const CardMask* hands, int count, HandStrength* out);
+
+    // Kernel selection (SetKernel is for tests and benchmarks; returns false if the CPU can't run it)
+    static EvaluatorKernel GetKernel();
+    static bool SetKernel(EvaluatorKernel kernel);
+    static bool IsKernelSupported(EvaluatorKernel kernel);
+    static const char* GetKernelName(EvaluatorKernel kernel);
+
+    // Strength helpers
+    static HandRank GetRank(HandStrength strength) { return static_cast<HandRank>(strength >> HAND_RANK_SHIFT); }
+    static const char* GetRankName(HandRank rank);
+};
+
+#endif
@@ -0,0 +1,61 @@
+#include "gameplay/hand_evaluator_simd.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#include "gameplay/hand_evaluator_lanes.hpp"
+
+// Eight hands per register
+struct LanesAVX2 {
+    typedef __m256i Reg;
+    static const int LANES = 8;
+
+    static Reg Load(const uint32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void Store(uint32_t* p, Reg a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+    static Reg Set(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+    static Reg And(Reg a, Reg b) { return _mm256_and_si256(a, b); }
+    static Reg Or(Reg a, Reg b) { return _mm256_or_si256(a, b); }
+    static Reg Xor(Reg a, Reg b) { return _mm256_xor_si256(a, b); }
+    static Reg AndNot(Reg a, Reg b) { return _mm256_andnot_si256(b, a); }
+    template <int N> static Reg Shl(Reg a) { return _mm256_slli_epi32(a, N); }
+    template <int N> static Reg Shr(Reg a) { return _mm256_srli_epi32(a, N); }
+    static Reg Add(Reg a, Reg b) { return _mm256_add_epi32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_epu32(a, b); }
+    static Reg Eq(Reg a, Reg b) { return _mm256_cmpeq_epi32(a, b); }
+    static Reg Select(Reg mask, Reg a, Reg b) { return _mm256_blendv_epi8(b, a, mask); }
+    static Reg Bit(Reg n) { return _mm256_sllv_epi32(Set(1), n); }   // Out-of-range counts give 0
+
+    // Rank masks fit in a float mantissa, so the exponent is the top bit index
+    static Reg Highest(Reg x) {
+        Reg exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(x)), 23);
+        return _mm256_sub_epi32(exponent, Set(127));
+    }
+
+    static Reg Gather(const uint32_t* table, Reg index) {
+        return _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+    }
+};
+
+bool EvaluatorKernels::HasAVX2() {
+    return true;
+}
+
+int EvaluatorKernels::BatchAVX2(const uint64_t* hands, uint64_t board, int count, uint32_t* out,
+                                const EvaluatorLaneTables& tables) {
+    int done = 0;
+    for (; done + LanesAVX2::LANES <= count; done += LanesAVX2::LANES) {
+        EvaluateLanes<LanesAVX2>(hands + done, board, out + done, tables);
+    }
+    return done;
+}
+
+#else
+
+bool EvaluatorKernels::HasAVX2() {
+    return false;
+}
+
+int EvaluatorKernels::BatchAVX2(const uint64_t*, uint64_t, int, uint32_t*, const EvaluatorLaneTables&) {
+    return 0;
+}
+
+#endif
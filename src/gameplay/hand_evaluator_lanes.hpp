@@ -0,0 +1,120 @@
+#ifndef HAND_EVALUATOR_LANES_HPP
+#define HAND_EVALUATOR_LANES_HPP
+
+// Branch-free version of HandEvaluator::Evaluate over V::LANES hands at once
+// Only included by the per-instruction-set kernel files. V wraps one register type:
+//   Reg, LANES, Load, Store, Set, And, Or, Xor, AndNot (a & ~b), Shl<N>, Shr<N>, Add, Max (unsigned),
+//   Eq, Select (mask ? a : b), Bit (1 << n per lane), Highest (top set bit of a non-zero lane), Gather
+//
+// Every category's strength is built for every lane, then picked in ascending order so the best
+// category that applies wins - the same priority as the scalar evaluator, so results match bit for bit.
+
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/hand_evaluator_simd.hpp"
+
+template <class V>
+static inline typename V::Reg NonZero(typename V::Reg x) {
+    return V::Xor(V::Eq(x, V::Set(0)), V::Set(0xFFFFFFFFu));
+}
+
+template <class V>
+static inline typename V::Reg Category(HandRank rank) {
+    return V::Set(static_cast<uint32_t>(rank) << HAND_RANK_SHIFT);
+}
+
+template <class V>
+static inline void EvaluateLanes(const uint64_t* hands, uint64_t board, uint32_t* out,
+                                 const EvaluatorLaneTables& tables) {
+    typedef typename V::Reg Reg;
+
+    // Split each hand into its four 13-bit suit masks, one register per suit
+    alignas(32) uint32_t staged[NUM_SUITS][V::LANES];
+    for (int i = 0; i < V::LANES; i++) {
+        uint64_t bits = hands[i] | board;
+        for (int s = 0; s < NUM_SUITS; s++) {
+            staged[s][i] = static_cast<uint32_t>(bits >> (s * CARD_MASK_SUIT_BITS)) & CARD_MASK_RANK_BITS;
+        }
+    }
+    Reg suits[NUM_SUITS];
+    for (int s = 0; s < NUM_SUITS; s++) {
+        suits[s] = V::Load(staged[s]);
+    }
+
+    // Best flush of any suit (0 if none)
+    Reg flush = V::Gather(tables.flush, suits[0]);
+    for (int s = 1; s < NUM_SUITS; s++) {
+        flush = V::Max(flush, V::Gather(tables.flush, suits[s]));
+    }
+
+    // Bit-sliced rank counters, exactly as in the scalar evaluator
+    Reg b0 = V::Set(0), b1 = V::Set(0), b2 = V::Set(0);
+    for (int s = 0; s < NUM_SUITS; s++) {
+        Reg carry0 = V::And(b0, suits[s]);
+        b0 = V::Xor(b0, suits[s]);
+        Reg carry1 = V::And(b1, carry0);
+        b1 = V::Xor(b1, carry0);
+        b2 = V::Or(b2, carry1);
+    }
+
+    Reg all = V::Or(V::Or(suits[0], suits[1]), V::Or(suits[2], suits[3]));
+    Reg quads = b2;
+    Reg trips = V::And(b1, b0);
+    Reg pairs = V::AndNot(b1, b0);
+
+    Reg hasQuads = NonZero<V>(quads);
+    Reg hasTrips = NonZero<V>(trips);
+    Reg hasPair = NonZero<V>(pairs);
+    Reg hasTwoPair = NonZero<V>(V::And(pairs, V::Add(pairs, V::Set(0xFFFFFFFFu))));  // 2+ bits set
+
+    // Four of a kind: quad rank plus the best other rank
+    Reg quadRank = V::Highest(quads);
+    Reg quadRest = V::AndNot(all, V::Bit(quadRank));
+    Reg quadKicker = V::And(V::template Shl<12>(V::Highest(quadRest)), NonZero<V>(quadRest));
+    Reg fourOfKind = V::Or(Category<V>(FOUR_OF_KIND), V::Or(V::template Shl<16>(quadRank), quadKicker));
+
+    // Full house: best trips plus the best other trips or pair
+    Reg tripRank = V::Highest(trips);
+    Reg fullOthers = V::Or(V::AndNot(trips, V::Bit(tripRank)), pairs);
+    Reg hasFullHouse = V::And(hasTrips, NonZero<V>(fullOthers));
+    Reg fullHouse = V::Or(Category<V>(FULL_HOUSE),
+                          V::Or(V::template Shl<16>(tripRank), V::template Shl<12>(V::Highest(fullOthers))));
+
+    // Straight: ace copied below the two so the wheel is an ordinary run
+    Reg wrapped = V::Or(V::template Shl<1>(all), V::template Shr<NUM_RANKS - 1>(all));
+    Reg runs = V::And(V::And(wrapped, V::template Shr<1>(wrapped)),
+                      V::And(V::template Shr<2>(wrapped), V::template Shr<3>(wrapped)));
+    runs = V::And(runs, V::template Shr<4>(wrapped));
+    Reg hasStraight = NonZero<V>(runs);
+    Reg straight = V::Or(Category<V>(STRAIGHT), V::template Shl<16>(V::Add(V::Highest(runs), V::Set(3))));
+
+    // One table lookup serves every kicker-based category: drop the made ranks first
+    Reg pairHigh = V::Highest(pairs);
+    Reg pairLow = V::Highest(V::AndNot(pairs, V::Bit(pairHigh)));
+    Reg kickerMask = V::Select(hasPair, V::AndNot(all, V::Bit(pairHigh)), all);
+    kickerMask = V::Select(hasTwoPair, V::AndNot(kickerMask, V::Bit(pairLow)), kickerMask);
+    kickerMask = V::Select(hasTrips, V::AndNot(all, V::Bit(tripRank)), kickerMask);
+    Reg top = V::Gather(tables.topFive, kickerMask);
+
+    Reg threeOfKind = V::Or(Category<V>(THREE_OF_KIND),
+                            V::Or(V::template Shl<16>(tripRank), V::And(V::template Shr<4>(top), V::Set(0xFF00))));
+    Reg twoPair = V::Or(Category<V>(TWO_PAIR),
+                        V::Or(V::Or(V::template Shl<16>(pairHigh), V::template Shl<12>(pairLow)),
+                              V::And(V::template Shr<8>(top), V::Set(0xF00))));
+    Reg pair = V::Or(Category<V>(PAIR),
+                     V::Or(V::template Shl<16>(pairHigh), V::And(V::template Shr<4>(top), V::Set(0xFFF0))));
+
+    // Lowest category first; each better one that applies overrides
+    Reg result = top;  // High card
+    result = V::Select(hasPair, pair, result);
+    result = V::Select(hasTwoPair, twoPair, result);
+    result = V::Select(hasTrips, threeOfKind, result);
+    result = V::Select(hasStraight, straight, result);
+    result = V::Select(NonZero<V>(flush), flush, result);
+    result = V::Select(hasFullHouse, fullHouse, result);
+    result = V::Select(hasQuads, fourOfKind, result);
+    result = V::Select(V::Eq(V::Max(flush, Category<V>(STRAIGHT_FLUSH)), flush), flush, result);
+
+    V::Store(out, result);
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef HAND_EVALUATOR_SIMD_HPP
+#define HAND_EVALUATOR_SIMD_HPP
+
+#include <cstdint>
+
+// Lookup tables the lane kernels share with the scalar evaluator (indexed by a 13-bit rank mask)
+struct EvaluatorLaneTables {
+    const uint32_t* topFive;
+    const uint32_t* flush;
+};
+
+// Static utility class for the SIMD kernels behind HandEvaluator::EvaluateBatch
+// Each instruction set lives in its own translation unit built with only that flag (see the Makefile),
+// so nothing else in the program can pick up AVX2/SSE4 code. A kernel that wasn't built reports false
+// from Has*() and evaluates nothing. Batch*() scores whole groups of lanes over (hands[i] | board) and
+// returns how many hands it did; HandEvaluator finishes the tail with the scalar path.
+class EvaluatorKernels {
+public:
+    static bool HasAVX2();
+    static bool HasSSE4();
+
+    static int BatchAVX2(const uint64_t* hands, uint64_t board, int count, uint32_t* out, const EvaluatorLaneTables& tables);
+    static int BatchSSE4(const uint64_t* hands, uint64_t board, int count, uint32_t* out, const EvaluatorLaneTables& tables);
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "gameplay/hand_evaluator_simd.hpp"
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#include "gameplay/hand_evaluator_lanes.hpp"
+
+// Four hands per register (SSE4.1 has no gathers or per-lane shifts - those are emulated)
+struct LanesSSE4 {
+    typedef __m128i Reg;
+    static const int LANES = 4;
+
+    static Reg Load(const uint32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void Store(uint32_t* p, Reg a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+    static Reg Set(uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+    static Reg And(Reg a, Reg b) { return _mm_and_si128(a, b); }
+    static Reg Or(Reg a, Reg b) { return _mm_or_si128(a, b); }
+    static Reg Xor(Reg a, Reg b) { return _mm_xor_si128(a, b); }
+    static Reg AndNot(Reg a, Reg b) { return _mm_andnot_si128(b, a); }
+    template <int N> static Reg Shl(Reg a) { return _mm_slli_epi32(a, N); }
+    template <int N> static Reg Shr(Reg a) { return _mm_srli_epi32(a, N); }
+    static Reg Add(Reg a, Reg b) { return _mm_add_epi32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm_max_epu32(a, b); }
+    static Reg Eq(Reg a, Reg b) { return _mm_cmpeq_epi32(a, b); }
+    static Reg Select(Reg mask, Reg a, Reg b) { return _mm_blendv_epi8(b, a, mask); }
+
+    // 1 << n by building the float 2^n (n outside 0..30 gives 0 or garbage that callers mask off)
+    static Reg Bit(Reg n) {
+        Reg exponent = _mm_slli_epi32(_mm_add_epi32(n, Set(127)), 23);
+        Reg inRange = _mm_and_si128(_mm_cmpgt_epi32(n, Set(0xFFFFFFFFu)), _mm_cmplt_epi32(n, Set(31)));
+        return _mm_and_si128(_mm_cvttps_epi32(_mm_castsi128_ps(exponent)), inRange);
+    }
+
+    // Rank masks fit in a float mantissa, so the exponent is the top bit index
+    static Reg Highest(Reg x) {
+        Reg exponent = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(x)), 23);
+        return _mm_sub_epi32(exponent, Set(127));
+    }
+
+    static Reg Gather(const uint32_t* table, Reg index) {
+        return _mm_set_epi32(static_cast<int>(table[_mm_extract_epi32(index, 3)]),
+                             static_cast<int>(table[_mm_extract_epi32(index, 2)]),
+                             static_cast<int>(table[_mm_extract_epi32(index, 1)]),
+                             static_cast<int>(table[_mm_extract_epi32(index, 0)]));
+    }
+};
+
+bool EvaluatorKernels::HasSSE4() {
+    return true;
+}
+
+int EvaluatorKernels::BatchSSE4(const uint64_t* hands, uint64_t board, int count, uint32_t* out,
+                                const EvaluatorLaneTables& tables) {
+    int done = 0;
+    for (; done + LanesSSE4::LANES <= count; done += LanesSSE4::LANES) {
+        EvaluateLanes<LanesSSE4>(hands + done, board, out + done, tables);
+    }
+    return done;
+}
+
+#else
+
+bool EvaluatorKernels::HasSSE4() {
+    return false;
+}
+
+int EvaluatorKernels::BatchSSE4(const uint64_t*, uint64_t, int, uint32_t*, const EvaluatorLaneTables&) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,191 @@
+#include "gameplay/hand_history.hpp"
+#include <cerrno>
+#include <cstring>
+
+// ========== RECORDER ==========
+
+HandHistoryRecorder::HandHistoryRecorder()
+    : file(nullptr), segment(0), segmentBytes(0), segmentLimit(HAND_HISTORY_SEGMENT_BYTES),
+      handCount(0), handOpen(false)
+{
+    memset(&record, 0, sizeof(record));
+}
+
+HandHistoryRecorder::~HandHistoryRecorder() {
+    Close();
+}
+
+bool HandHistoryRecorder::Open(const std::string& base, size_t maxSegmentBytes) {
+    Close();
+    basePath = base;
+    segmentLimit = maxSegmentBytes;
+    handCount = 0;
+
+    // Never overwrite earlier history - continue after the last existing segment
+    return OpenSegment(static_cast<int>(HandHistoryReader::ListSegments(base).size()));
+}
+
+void HandHistoryRecorder::Close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    handOpen = false;
+}
+
+bool HandHistoryRecorder::OpenSegment(int index) {
+    if (file) fclose(file);
+
+    // Only ever create new files - another recorder on the same base may already own this index
+    segmentBytes = 0;
+    for (segment = index;; segment++) {
+        file = fopen(SegmentPath(basePath, segment).c_str(), "wbx");
+        if (file || errno != EEXIST) break;
+    }
+    return file != nullptr;
+}
+
+template <int Seats>
+void HandHistoryRecorder::BeginHand(const PokerEngineT<Seats>& engine, const uint32_t* playerIds) {
+    if (!file) return;
+
+    memset(&record, 0, sizeof(record));
+    record.magic = HAND_HISTORY_MAGIC;
+    record.version = HAND_HISTORY_VERSION;
+    record.handId = handCount;
+    record.deckSeed = engine.GetHandSeed();
+    record.smallBlind = engine.GetSmallBlind();
+    record.bigBlind = engine.GetBigBlind();
+    record.ante = engine.GetAnte();
+    record.seatCount = static_cast<uint8_t>(Seats);
+    record.smallBlindSeat = static_cast<int8_t>(engine.GetSmallBlindSeat());
+    record.bigBlindSeat = static_cast<int8_t>(engine.GetBigBlindSeat());
+
+    for (int i = 0; i < MAX_SEATS; i++) {
+        record.holeCards[i][0] = record.holeCards[i][1] = -1;
+    }
+    for (int i = 0; i < Seats; i++) {
+        const EngineSeat& s = engine.GetSeat(i);
+        if (!s.inHand) continue;
+
+        // Antes and blinds are already posted - add them back to get the stack the hand started with
+        record.seatMask |= 1u << i;
+        record.startStacks[i] = s.stack + s.totalBet;
+        record.holeCards[i][0] = static_cast<int8_t>(s.holeCards[0]);
+        record.holeCards[i][1] = static_cast<int8_t>(s.holeCards[1]);
+        record.playerIds[i] = playerIds ? playerIds[i] : 0;
+    }
+    handOpen = true;
+}
+
+void HandHistoryRecorder::RecordAction(int seat, HandPhase phase, const PokerAction& action) {
+    if (!handOpen || record.actionCount >= HAND_HISTORY_MAX_ACTIONS) return;
+
+    HandActionRecord& a = actions[record.actionCount++];
+    a.amount = action.amount;
+    a.seat = static_cast<uint8_t>(seat);
+    a.type = static_cast<uint8_t>(action.type);
+    a.phase = static_cast<uint8_t>(phase);
+    a.reserved = 0;
+}
+
+void HandHistoryRecorder::RecordStandUp(int seat, HandPhase phase) {
+    if (!handOpen || record.actionCount >= HAND_HISTORY_MAX_ACTIONS) return;
+    RecordAction(seat, phase, PokerAction(ACTION_FOLD));
+    actions[record.actionCount - 1].type = HAND_ACTION_STAND_UP;
+}
+
+template <int Seats>
+void HandHistoryRecorder::EndHand(const PokerEngineT<Seats>& engine) {
+    if (!handOpen) return;
+    handOpen = false;
+
+    record.boardCount = static_cast<uint8_t>(engine.GetBoardCount());
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        record.board[i] = (i < engine.GetBoardCount()) ? static_cast<int8_t>(engine.GetBoardCard(i)) : -1;
+    }
+
+    for (int i = 0; i < Seats; i++) {
+        const EngineSeat& s = engine.GetSeat(i);
+        record.payouts[i] = s.winnings;
+        record.endStacks[i] = s.inHand ? s.stack : 0;
+
+        // Only hands that were evaluated at showdown have a strength
+        if (s.inHand && !s.folded && s.strength != 0) {
+            record.showdownMask |= 1u << i;
+            record.shownHands[i] = s.hand.bits;
+        }
+    }
+
+    size_t bytes = sizeof(HandRecord) + record.actionCount * sizeof(HandActionRecord);
+    if (segmentBytes > 0 && segmentBytes + bytes > segmentLimit) {
+        if (!OpenSegment(segment + 1)) return;
+    }
+
+    fwrite(&record, sizeof(HandRecord), 1, file);
+    fwrite(actions, sizeof(HandActionRecord), record.actionCount, file);
+    segmentBytes += bytes;
+    handCount++;
+}
+
+#define HAND_HISTORY_INSTANTIATE(n) \
+    template void HandHistoryRecorder::BeginHand<n>(const PokerEngineT<n>&, const uint32_t*); \
+    template void HandHistoryRecorder::EndHand<n>(const PokerEngineT<n>&);
+POKER_ENGINE_SEAT_COUNTS(HAND_HISTORY_INSTANTIATE)
+#undef HAND_HISTORY_INSTANTIATE
+
+std::string HandHistoryRecorder::SegmentPath(const std::string& base, int index) {
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%04d" HAND_HISTORY_EXTENSION, index);
+    return base + suffix;
+}
+
+// ========== READER ==========
+
+HandHistoryReader::HandHistoryReader() : offset(0) {}
+
+HandHistoryReader::~HandHistoryReader() {
+    Close();
+}
+
+bool HandHistoryReader::Open(const std::string& path) {
+    Close();
+    return file.Open(path, true);
+}
+
+void HandHistoryReader::Close() {
+    file.Close();
+    offset = 0;
+}
+
+bool HandHistoryReader::Next(HandView& hand) {
+    const unsigned char* data = file.GetData();
+    size_t size = file.GetSize();
+    if (!data || offset + sizeof(HandRecord) > size) return false;
+
+    const HandRecord* header = reinterpret_cast<const HandRecord*>(data + offset);
+    if (header->magic != HAND_HISTORY_MAGIC || header->version != HAND_HISTORY_VERSION ||
+        header->actionCount > HAND_HISTORY_MAX_ACTIONS) {
+        return false;
+    }
+
+    size_t bytes = sizeof(HandRecord) + header->actionCount * sizeof(HandActionRecord);
+    if (offset + bytes > size) return false;  // Truncated tail
+
+    hand.header = header;
+    hand.actions = reinterpret_cast<const HandActionRecord*>(data + offset + sizeof(HandRecord));
+    offset += bytes;
+    return true;
+}
+
+std::vector<std::string> HandHistoryReader::ListSegments(const std::string& base) {
+    std::vector<std::string> paths;
+    for (int index = 0;; index++) {
+        std::string path = HandHistoryRecorder::SegmentPath(base, index);
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) break;
+        fclose(f);
+        paths.push_back(path);
+    }
+    return paths;
+}
@@ -0,0 +1,129 @@
+#ifndef HAND_HISTORY_HPP
+#define HAND_HISTORY_HPP
+
+#include "core/mapped_file.hpp"
+#include "gameplay/poker_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define HAND_HISTORY_MAGIC 0x48484B50u          // "PKHH"
+#define HAND_HISTORY_VERSION 5
+#define HAND_HISTORY_MAX_ACTIONS (4 * MAX_SEATS * (MAX_SEATS + 1))   // 4 streets x seats x (first action + one per raise)
+#define HAND_HISTORY_SEGMENT_BYTES (64 << 20)   // Start a new segment file past this size
+#define HAND_HISTORY_EXTENSION ".phh"
+#define HAND_ACTION_STAND_UP 3                  // HandActionRecord type for a seat leaving mid-hand (PokerEngine::StandUp)
+
+// One betting action as it was handed to PokerEngine::ApplyAction (8 bytes)
+struct HandActionRecord {
+    int32_t amount;     // Requested raise-to (the engine clamps it the same way on replay)
+    uint8_t seat;
+    uint8_t type;       // PokerActionType or HAND_ACTION_STAND_UP
+    uint8_t phase;      // HandPhase the action was taken in
+    uint8_t reserved;
+};
+
+// Fixed-width header for one hand, followed in the file by actionCount HandActionRecords
+// Plain little-endian PODs with every field naturally aligned, so a reader can point straight into a mapping
+struct HandRecord {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t actionCount;
+    uint64_t handId;                        // Counts up per recorder
+    uint64_t deckSeed;                      // PokerEngine::GetHandSeed() - redeals the exact cards
+    int32_t smallBlind;
+    int32_t bigBlind;
+    int32_t ante;
+    int8_t smallBlindSeat;
+    int8_t bigBlindSeat;
+    uint8_t seatCount;                      // Seats of the engine that played it (PokerEngineT<seatCount>)
+    uint8_t boardCount;
+    uint16_t seatMask;                      // Bit per seat dealt into the hand
+    uint16_t showdownMask;                  // Bit per seat whose hand is in shownHands
+    int8_t board[BOARD_SIZE];
+    int8_t holeCards[MAX_SEATS][HOLE_CARDS];
+    uint8_t reserved[3];
+    int32_t startStacks[MAX_SEATS];         // Before blinds
+    int32_t payouts[MAX_SEATS];
+    int32_t endStacks[MAX_SEATS];           // After payouts
+    uint32_t playerIds[MAX_SEATS];          // OpponentStatsTracker::PlayerId of each seat (0 = unknown)
+    uint64_t shownHands[MAX_SEATS];         // CardMask bits each seat showed down with (may differ from hole cards)
+};
+
+static_assert(sizeof(HandActionRecord) == 8, "HandActionRecord must stay 8 bytes");
+static_assert(sizeof(HandRecord) == 312, "HandRecord layout changed - bump HAND_HISTORY_VERSION");
+static_assert(MAX_SEATS <= 16, "HandRecord seat masks are 16 bits");
+
+// Appends one record per hand to segmented files (<base>.0000.phh, <base>.0001.phh, ...)
+// Keep one recorder per table: nothing is shared, so tables on different threads never contend
+class HandHistoryRecorder {
+private:
+    std::string basePath;
+    FILE* file;
+    int segment;
+    size_t segmentBytes;
+    size_t segmentLimit;
+    uint64_t handCount;
+    bool handOpen;              // BeginHand() called, EndHand() not yet
+    HandRecord record;
+    HandActionRecord actions[HAND_HISTORY_MAX_ACTIONS];
+
+    bool OpenSegment(int index);   // First segment from index on that doesn't exist yet
+
+public:
+    HandHistoryRecorder();
+    ~HandHistoryRecorder();
+
+    bool Open(const std::string& base, size_t maxSegmentBytes = HAND_HISTORY_SEGMENT_BYTES);
+    void Close();
+
+    // Call right after a successful StartHand(), for every ApplyAction() (with the phase it was made in)
+    // and once the hand is PHASE_COMPLETE (built for every POKER_ENGINE_SEAT_COUNTS engine)
+    // playerIds (one per seat, optional) say who sat where, so stats can be rebuilt from the files
+    template <int Seats> void BeginHand(const PokerEngineT<Seats>& engine, const uint32_t* playerIds = nullptr);
+    void RecordAction(int seat, HandPhase phase, const PokerAction& action);
+    void RecordStandUp(int seat, HandPhase phase);
+    template <int Seats> void EndHand(const PokerEngineT<Seats>& engine);
+
+    // Accessors
+    bool IsOpen() const { return file != nullptr; }
+    uint64_t GetHandCount() const { return handCount; }
+    int GetSegment() const { return segment; }
+
+    static std::string SegmentPath(const std::string& base, int index);
+};
+
+// One hand inside a mapped file (valid while the reader stays open)
+struct HandView {
+    const HandRecord* header;
+    const HandActionRecord* actions;
+
+    HandView() : header(nullptr), actions(nullptr) {}
+};
+
+// Memory-maps one segment and walks its records in place - no parsing or copying
+// A truncated or corrupt tail (e.g. a crash mid-write) just ends the iteration
+class HandHistoryReader {
+private:
+    MappedFile file;
+    size_t offset;
+
+public:
+    HandHistoryReader();
+    ~HandHistoryReader();
+
+    bool Open(const std::string& path);
+    void Close();
+    bool Next(HandView& hand);          // False at the end of the segment
+    void Rewind() { offset = 0; }
+
+    bool IsOpen() const { return file.IsOpen(); }
+    size_t GetSize() const { return file.GetSize(); }
+
+    // Existing segment paths for a base, in order
+    static std::vector<std::string> ListSegments(const std::string& base);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#include "gameplay/hand_optimizer.hpp"
+#include <algorithm>
+
+HandChoice HandOptimizer::BestTwo(CardMask held, CardMask board) {
+    HandChoice choice;
+    held &= ~board;
+
+    // Nothing to choose between
+    int count = held.Count();
+    if (count <= 2) {
+        CardMask rest = held;
+        for (int k = 0; k < count; k++) {
+            choice.cards[k] = rest.PopFirst();
+        }
+        choice.strength = HandEvaluator::Evaluate(held | board);
+        return choice;
+    }
+
+    // Strongest cards first, so a good pair turns up early and prunes the rest
+    int cards[NUM_CARDS];
+    HandStrength alone[NUM_CARDS];
+    CardMask rest = held;
+    for (int k = 0; k < count; k++) {
+        cards[k] = rest.PopFirst();
+        alone[k] = HandEvaluator::Evaluate(board | CardMask::FromIndex(cards[k]));
+    }
+    int order[NUM_CARDS];
+    for (int k = 0; k < count; k++) order[k] = k;
+    std::sort(order, order + count, [&](int a, int b) {
+        if (alone[a] != alone[b]) return alone[a] > alone[b];
+        return CardMask::RankOf(cards[a]) > CardMask::RankOf(cards[b]);
+    });
+
+    // Any two held cards are a subset of all of them, so nothing can beat the best five of everything
+    HandStrength ceiling = HandEvaluator::Evaluate(held | board);
+
+    CardMask partners[NUM_CARDS];
+    HandStrength strengths[NUM_CARDS];
+    CardMask suffix = held;
+    for (int i = 0; i + 1 < count && choice.strength < ceiling; i++) {
+        int first = cards[order[i]];
+        suffix.Remove(first);
+
+        // Bound for every pair starting with `first`: the best five of it plus all cards still to come
+        if (HandEvaluator::Evaluate(board | suffix | CardMask::FromIndex(first)) <= choice.strength) continue;
+
+        int partnerCount = count - i - 1;
+        for (int j = 0; j < partnerCount; j++) {
+            partners[j] = CardMask::FromIndex(cards[order[i + 1 + j]]);
+        }
+        HandEvaluator::EvaluateBatch(board | CardMask::FromIndex(first), partners, partnerCount, strengths);
+        choice.evaluated += partnerCount;
+
+        for (int j = 0; j < partnerCount; j++) {
+            if (strengths[j] > choice.strength) {
+                choice.strength = strengths[j];
+                choice.cards[0] = first;
+                choice.cards[1] = cards[order[i + 1 + j]];
+            }
+        }
+    }
+    return choice;
+}
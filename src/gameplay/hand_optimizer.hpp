@@ -0,0 +1,32 @@
+#ifndef HAND_OPTIMIZER_HPP
+#define HAND_OPTIMIZER_HPP
+
+#include "gameplay/card_mask.hpp"
+#include "gameplay/hand_evaluator.hpp"
+
+// Best legal showdown hand for someone holding more than two cards
+struct HandChoice {
+    int cards[2];               // Card indices to show (-1 when fewer than two are held)
+    HandStrength strength;      // Strength of the two cards plus the board
+    int evaluated;              // Pairs actually scored (the rest were pruned)
+
+    HandChoice() : cards{-1, -1}, strength(0), evaluated(0) {}
+
+    CardMask GetMask() const {
+        CardMask mask;
+        if (cards[0] >= 0) mask.Add(cards[0]);
+        if (cards[1] >= 0) mask.Add(cards[1]);
+        return mask;
+    }
+};
+
+// Static utility class for picking the best two of N held cards against a board
+// Cards are tried strongest-first; each first card is skipped when even the best five of it plus every
+// card after it can't beat the current best, and the search stops outright at the best five of
+// everything held. The pairs for one first card are scored in a single shared-board batch.
+class HandOptimizer {
+public:
+    static HandChoice BestTwo(CardMask held, CardMask board);   // Held cards on the board are ignored
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include "gameplay/hand_replay.hpp"
+
+template <int Seats>
+void HandReplay::Prepare(PokerEngineT<Seats>& engine, const HandRecord& record) {
+    for (int i = 0; i < Seats; i++) {
+        if (record.seatMask & (1u << i)) {
+            engine.SitDown(i, record.startStacks[i]);
+            engine.SetStack(i, record.startStacks[i]);
+        }
+    }
+    engine.SetBlinds(record.smallBlind, record.bigBlind, record.ante);
+    engine.SetNextHand(record.smallBlindSeat, record.deckSeed);
+}
+
+template <int Seats>
+bool HandReplay::ApplyAction(PokerEngineT<Seats>& engine, const HandActionRecord& action) {
+    if (action.seat >= Seats) return false;
+
+    if (action.type == HAND_ACTION_STAND_UP) {
+        engine.StandUp(action.seat);
+        return true;
+    }
+
+    if (!engine.IsBetting() || engine.GetCurrentSeat() != action.seat) return false;
+    if (engine.GetPhase() != static_cast<HandPhase>(action.phase)) return false;
+    return engine.ApplyAction(PokerAction(static_cast<PokerActionType>(action.type), action.amount));
+}
+
+template <int Seats>
+void HandReplay::ApplyShownHands(PokerEngineT<Seats>& engine, const HandRecord& record) {
+    for (int i = 0; i < Seats; i++) {
+        if (record.showdownMask & (1u << i)) {
+            engine.SetHand(i, CardMask(record.shownHands[i]));
+        }
+    }
+}
+
+template <int Seats>
+void HandReplay::Check(const PokerEngineT<Seats>& engine, const HandRecord& record, ReplayResult& result) {
+    result.matched = result.failedAction < 0 && engine.GetPhase() == PHASE_COMPLETE;
+    result.mismatchSeat = -1;
+
+    for (int i = 0; i < Seats; i++) {
+        const EngineSeat& s = engine.GetSeat(i);
+        result.endStacks[i] = s.inHand ? s.stack : 0;
+
+        if (result.mismatchSeat < 0 &&
+            (result.endStacks[i] != record.endStacks[i] || s.winnings != record.payouts[i])) {
+            result.mismatchSeat = i;
+            result.matched = false;
+        }
+    }
+}
+
+template <int Seats>
+ReplayResult HandReplay::ReplayOn(const HandView& hand) {
+    ReplayResult result;
+    const HandRecord& record = *hand.header;
+
+    PokerEngineT<Seats> engine;
+    Prepare(engine, record);
+    if (!engine.StartHand() || engine.GetHandSeed() != record.deckSeed ||
+        engine.GetSmallBlindSeat() != record.smallBlindSeat) {
+        result.failedAction = 0;
+        return result;
+    }
+
+    for (int a = 0; a < record.actionCount; a++) {
+        if (!ApplyAction(engine, hand.actions[a])) {
+            result.failedAction = a;
+            break;
+        }
+    }
+
+    if (engine.GetPhase() == PHASE_SHOWDOWN) {
+        ApplyShownHands(engine, record);
+        engine.ResolveShowdown();
+    }
+
+    Check(engine, record, result);
+    return result;
+}
+
+ReplayResult HandReplay::Replay(const HandView& hand) {
+    switch (hand.header->seatCount) {
+#define HAND_REPLAY_CASE(n) case n: return ReplayOn<n>(hand);
+    POKER_ENGINE_SEAT_COUNTS(HAND_REPLAY_CASE)
+#undef HAND_REPLAY_CASE
+    default: {
+        // Not a table size this build knows
+        ReplayResult result;
+        result.failedAction = 0;
+        return result;
+    }
+    }
+}
+
+#define HAND_REPLAY_INSTANTIATE(n) \
+    template void HandReplay::Prepare<n>(PokerEngineT<n>&, const HandRecord&); \
+    template bool HandReplay::ApplyAction<n>(PokerEngineT<n>&, const HandActionRecord&); \
+    template void HandReplay::ApplyShownHands<n>(PokerEngineT<n>&, const HandRecord&); \
+    template void HandReplay::Check<n>(const PokerEngineT<n>&, const HandRecord&, ReplayResult&);
+POKER_ENGINE_SEAT_COUNTS(HAND_REPLAY_INSTANTIATE)
+#undef HAND_REPLAY_INSTANTIATE
@@ -0,0 +1,43 @@
+#ifndef HAND_REPLAY_HPP
+#define HAND_REPLAY_HPP
+
+#include "gameplay/hand_history.hpp"
+
+// What replaying one recorded hand produced
+struct ReplayResult {
+    bool matched;                   // Every action applied and the end stacks agree with the record
+    int mismatchSeat;               // First seat whose stack differs (-1 if none)
+    int failedAction;               // Index of the action that could not be applied (-1 if none)
+    int endStacks[MAX_SEATS];       // What the replay ended with
+
+    ReplayResult() : matched(false), mismatchSeat(-1), failedAction(-1), endStacks{} {}
+};
+
+// Static utility class for re-running a HandHistoryRecorder record through PokerEngineT
+// The record's deck seed redeals the same cards and its action stream replaces every decision,
+// so nothing random or frame-timed is involved and a hand replays in microseconds.
+// PokerTable uses the same steps for its replay mode. The steps are built for every
+// POKER_ENGINE_SEAT_COUNTS engine; Replay() picks the one the record was played on.
+class HandReplay {
+public:
+    // Seat the recorded stacks and pin the blinds, button and deck for the next StartHand()
+    template <int Seats> static void Prepare(PokerEngineT<Seats>& engine, const HandRecord& record);
+
+    // Apply one recorded action; false if it doesn't fit the engine's state (wrong seat, hand over)
+    template <int Seats> static bool ApplyAction(PokerEngineT<Seats>& engine, const HandActionRecord& action);
+
+    // Give showdown seats the cards they showed (they may have swapped in extra cards)
+    template <int Seats> static void ApplyShownHands(PokerEngineT<Seats>& engine, const HandRecord& record);
+
+    // Compare the finished hand against the record
+    template <int Seats>
+    static void Check(const PokerEngineT<Seats>& engine, const HandRecord& record, ReplayResult& result);
+
+    // Whole hand on a fresh engine of the recorded size
+    static ReplayResult Replay(const HandView& hand);
+
+private:
+    template <int Seats> static ReplayResult ReplayOn(const HandView& hand);
+};
+
+#endif
@@ -0,0 +1,292 @@
+#include "gameplay/opponent_stats.hpp"
+#include "gameplay/hand_history.hpp"
+
+OpponentStatsTracker::OpponentStatsTracker() {
+    for (Slot& slot : slots) {
+        slot.id.store(0, std::memory_order_relaxed);
+        slot.sequence.store(0, std::memory_order_relaxed);
+        for (auto& count : slot.counts) count.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint32_t OpponentStatsTracker::PlayerId(const std::string& name) {
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : name) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash ? hash : 1u;
+}
+
+OpponentStatsTracker* OpponentStatsTracker::GetGlobal() {
+    static OpponentStatsTracker tracker;
+    return &tracker;
+}
+
+// ========== SLOTS ==========
+
+int OpponentStatsTracker::FindSlot(uint32_t id) const {
+    if (id == 0) return -1;
+
+    // Open addressing with linear probing; slots are never freed, so the first empty one ends the search
+    for (int n = 0; n < OPPONENT_STATS_CAPACITY; n++) {
+        int index = (id + n) & (OPPONENT_STATS_CAPACITY - 1);
+        uint32_t slotId = slots[index].id.load(std::memory_order_acquire);
+        if (slotId == id) return index;
+        if (slotId == 0) return -1;
+    }
+    return -1;
+}
+
+int OpponentStatsTracker::ClaimSlot(uint32_t id) {
+    if (id == 0) return -1;
+
+    for (int n = 0; n < OPPONENT_STATS_CAPACITY; n++) {
+        int index = (id + n) & (OPPONENT_STATS_CAPACITY - 1);
+        Slot& slot = slots[index];
+        uint32_t slotId = slot.id.load(std::memory_order_relaxed);
+        if (slotId == id) return index;
+        if (slotId == 0) {
+            // Counters are already zero; publishing the id makes the slot visible to readers
+            slot.id.store(id, std::memory_order_release);
+            return index;
+        }
+    }
+    return -1;  // Full - this player just isn't tracked
+}
+
+void OpponentStatsTracker::Add(int slot, OpponentStat first, OpponentStat second) {
+    if (slot < 0) return;
+
+    Slot& s = slots[slot];
+    uint32_t sequence = s.sequence.load(std::memory_order_relaxed);
+    s.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s.counts[first].store(s.counts[first].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (second != OPPONENT_STAT_COUNT) {
+        s.counts[second].store(s.counts[second].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    s.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool OpponentStatsTracker::Lookup(uint32_t playerId, OpponentStats& out) const {
+    int index = FindSlot(playerId);
+    if (index < 0) return false;
+
+    const Slot& s = slots[index];
+    for (;;) {
+        uint32_t before = s.sequence.load(std::memory_order_acquire);
+        if (before & 1u) continue;  // Writer is mid-update (a couple of stores - just spin)
+
+        for (int i = 0; i < OPPONENT_STAT_COUNT; i++) {
+            out.counts[i] = s.counts[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (s.sequence.load(std::memory_order_relaxed) == before) return true;
+    }
+}
+
+OpponentStats OpponentStatsTracker::Profile(const uint32_t* playerIds, int count) const {
+    OpponentStats profile;
+    OpponentStats stats;
+    for (int i = 0; i < count; i++) {
+        if (Lookup(playerIds[i], stats)) profile.Merge(stats);
+    }
+    return profile;
+}
+
+void OpponentStatsTracker::Clear() {
+    for (Slot& slot : slots) {
+        slot.id.store(0, std::memory_order_relaxed);
+        for (auto& count : slot.counts) count.store(0, std::memory_order_relaxed);
+    }
+}
+
+int OpponentStatsTracker::GetPlayerCount() const {
+    int count = 0;
+    for (const Slot& slot : slots) {
+        if (slot.id.load(std::memory_order_relaxed) != 0) count++;
+    }
+    return count;
+}
+
+// ========== HAND EVENTS ==========
+
+OpponentStatsHand::OpponentStatsHand(OpponentStatsTracker* target)
+    : tracker(target), handMask(0), bigBlindSeat(-1), preflopRaises(0), preflopAggressor(-1),
+      street(PHASE_WAITING), streetBet(false), cbetOpen(false)
+{}
+
+void OpponentStatsHand::SetTracker(OpponentStatsTracker* target) {
+    tracker = target;
+    handMask = 0;   // Slots belong to the old tracker
+}
+
+void OpponentStatsHand::StartTracking(const uint32_t* playerIds, uint32_t seatMask, int bigBlind) {
+    handMask = 0;
+    bigBlindSeat = bigBlind;
+    preflopRaises = 0;
+    preflopAggressor = -1;
+    street = PHASE_PREFLOP;
+    streetBet = true;
+    cbetOpen = false;
+    if (!tracker) return;
+
+    for (uint32_t m = seatMask; m; m &= m - 1) {
+        int seat = __builtin_ctz(m);
+        if (seat >= MAX_SEATS) break;
+
+        int slot = playerIds ? tracker->ClaimSlot(playerIds[seat]) : -1;
+        if (slot < 0) continue;
+
+        hand[seat] = HandSeat();
+        hand[seat].slot = slot;
+        handMask |= 1u << seat;
+        tracker->Add(slot, STAT_HANDS);
+    }
+}
+
+template <int Seats>
+void OpponentStatsHand::BeginHand(const PokerEngineT<Seats>& engine, const uint32_t* playerIds) {
+    uint32_t seatMask = 0;
+    for (int i = 0; i < Seats; i++) {
+        if (engine.GetSeat(i).inHand) seatMask |= 1u << i;
+    }
+    StartTracking(playerIds, seatMask, engine.GetBigBlindSeat());
+}
+
+void OpponentStatsHand::RecordAction(int seat, HandPhase phase, PokerActionType type) {
+    if (seat < 0 || seat >= MAX_SEATS) return;
+
+    // The street state follows every seat, tracked or not
+    if (phase != street) {
+        street = phase;
+        streetBet = false;
+        cbetOpen = false;
+    }
+
+    bool tracked = (handMask >> seat) & 1u;
+    HandSeat& h = hand[seat];
+    bool preflop = (phase == PHASE_PREFLOP);
+
+    // Preflop, facing exactly one raise from someone else is a chance to 3-bet
+    bool threeBetSpot = preflop && preflopRaises == 1 && seat != preflopAggressor;
+    bool cbetSpot = cbetOpen && seat != preflopAggressor;
+
+    if (type == ACTION_RAISE) {
+        if (tracked) {
+            bool threeBet = threeBetSpot && !h.threeBetChance;
+            tracker->Add(h.slot, STAT_AGGRESSIVE, threeBet ? STAT_THREE_BET_CHANCES : OPPONENT_STAT_COUNT);
+            if (threeBet) tracker->Add(h.slot, STAT_THREE_BETS);
+            if (preflop && !h.vpip) tracker->Add(h.slot, STAT_VPIP);
+            if (preflop && !h.pfr) tracker->Add(h.slot, STAT_PFR);
+            if (cbetSpot && !h.cbetFaced) tracker->Add(h.slot, STAT_CBETS_FACED);
+            if (threeBetSpot) h.threeBetChance = true;
+            if (preflop) h.vpip = h.pfr = true;
+            if (cbetSpot) h.cbetFaced = true;
+        }
+
+        // Leading the flop after raising preflop is a continuation bet; any other raise ends it
+        cbetOpen = (phase == PHASE_FLOP && !streetBet && seat == preflopAggressor);
+        if (preflop) {
+            preflopRaises++;
+            preflopAggressor = seat;
+        }
+        streetBet = true;
+        return;
+    }
+
+    if (!tracked) return;
+
+    if (threeBetSpot && !h.threeBetChance) {
+        tracker->Add(h.slot, STAT_THREE_BET_CHANCES);
+        h.threeBetChance = true;
+    }
+    if (cbetSpot && !h.cbetFaced) {
+        tracker->Add(h.slot, STAT_CBETS_FACED, type == ACTION_FOLD ? STAT_CBET_FOLDS : OPPONENT_STAT_COUNT);
+        h.cbetFaced = true;
+    }
+
+    if (type == ACTION_CALL) {
+        // Checks (nothing to call, or the big blind's option) aren't passive plays or VPIP
+        bool check = !streetBet || (preflop && preflopRaises == 0 && seat == bigBlindSeat);
+        if (check) return;
+
+        bool vpip = preflop && !h.vpip;
+        tracker->Add(h.slot, STAT_PASSIVE, vpip ? STAT_VPIP : OPPONENT_STAT_COUNT);
+        if (vpip) h.vpip = true;
+    }
+}
+
+void OpponentStatsHand::RecordStandUp(int seat) {
+    if (seat < 0 || seat >= MAX_SEATS) return;
+    handMask &= ~(1u << seat);
+}
+
+void OpponentStatsHand::FinishTracking(uint32_t showdownMask, const int32_t* payouts) {
+    for (uint32_t m = showdownMask & handMask; m; m &= m - 1) {
+        int seat = __builtin_ctz(m);
+        tracker->Add(hand[seat].slot, STAT_SHOWDOWNS, payouts[seat] > 0 ? STAT_SHOWDOWN_WINS : OPPONENT_STAT_COUNT);
+    }
+    handMask = 0;
+}
+
+template <int Seats>
+void OpponentStatsHand::EndHand(const PokerEngineT<Seats>& engine) {
+    // Same showdown rule as HandHistoryRecorder: only hands evaluated at showdown have a strength
+    uint32_t showdownMask = 0;
+    int32_t payouts[MAX_SEATS] = {0};
+    for (int i = 0; i < Seats; i++) {
+        const EngineSeat& s = engine.GetSeat(i);
+        payouts[i] = s.winnings;
+        if (s.inHand && !s.folded && s.strength != 0) showdownMask |= 1u << i;
+    }
+    FinishTracking(showdownMask, payouts);
+}
+
+#define OPPONENT_STATS_INSTANTIATE(n) \
+    template void OpponentStatsHand::BeginHand<n>(const PokerEngineT<n>&, const uint32_t*); \
+    template void OpponentStatsHand::EndHand<n>(const PokerEngineT<n>&);
+POKER_ENGINE_SEAT_COUNTS(OPPONENT_STATS_INSTANTIATE)
+#undef OPPONENT_STATS_INSTANTIATE
+
+// ========== HISTORY ==========
+
+void OpponentStatsTracker::AddHand(const HandView& view) {
+    OpponentStatsHand hand(this);
+    hand.AddHand(view);
+}
+
+void OpponentStatsHand::AddHand(const HandView& view) {
+    const HandRecord* header = view.header;
+    if (!header) return;
+
+    // The recorded stream is exactly what the live feed saw
+    StartTracking(header->playerIds, header->seatMask, header->bigBlindSeat);
+    for (int i = 0; i < header->actionCount; i++) {
+        const HandActionRecord& a = view.actions[i];
+        if (a.type == HAND_ACTION_STAND_UP) {
+            RecordStandUp(a.seat);
+        } else {
+            RecordAction(a.seat, static_cast<HandPhase>(a.phase), static_cast<PokerActionType>(a.type));
+        }
+    }
+    FinishTracking(header->showdownMask, header->payouts);
+}
+
+int OpponentStatsTracker::LoadHistory(const std::string& base) {
+    int hands = 0;
+    for (const std::string& path : HandHistoryReader::ListSegments(base)) {
+        HandHistoryReader reader;
+        if (!reader.Open(path)) continue;
+
+        HandView view;
+        while (reader.Next(view)) {
+            AddHand(view);
+            hands++;
+        }
+    }
+    return hands;
+}
@@ -0,0 +1,148 @@
+#ifndef OPPONENT_STATS_HPP
+#define OPPONENT_STATS_HPP
+
+#include "gameplay/poker_engine.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#define OPPONENT_STATS_CAPACITY 256     // Players one tracker remembers (power of two)
+#define OPPONENT_STATS_MIN_HANDS 20     // Hands seen before a profile is worth playing against
+
+struct HandView;
+
+// Running counters behind each stat - everything is a count, so updates are single increments
+enum OpponentStat {
+    STAT_HANDS,             // Dealt in
+    STAT_VPIP,              // Voluntarily put chips in preflop
+    STAT_PFR,               // Raised preflop
+    STAT_THREE_BET_CHANCES, // Acted preflop facing exactly one raise
+    STAT_THREE_BETS,        // ...and re-raised
+    STAT_CBETS_FACED,       // Acted on the flop facing the preflop raiser's lead
+    STAT_CBET_FOLDS,        // ...and folded
+    STAT_SHOWDOWNS,
+    STAT_SHOWDOWN_WINS,     // Showdowns that paid anything (split pots count)
+    STAT_AGGRESSIVE,        // Bets and raises, every street
+    STAT_PASSIVE,           // Calls that cost chips, every street
+    OPPONENT_STAT_COUNT
+};
+
+// One player's (or several players' merged) counters with the usual ratios on top
+struct OpponentStats {
+    uint32_t counts[OPPONENT_STAT_COUNT];
+
+    OpponentStats() : counts() {}
+
+    uint32_t Get(OpponentStat stat) const { return counts[stat]; }
+    uint32_t GetHands() const { return counts[STAT_HANDS]; }
+
+    float VPIP() const { return Ratio(STAT_VPIP, STAT_HANDS); }
+    float PFR() const { return Ratio(STAT_PFR, STAT_HANDS); }
+    float ThreeBet() const { return Ratio(STAT_THREE_BETS, STAT_THREE_BET_CHANCES); }
+    float FoldToCBet() const { return Ratio(STAT_CBET_FOLDS, STAT_CBETS_FACED); }
+    float ShowdownWin() const { return Ratio(STAT_SHOWDOWN_WINS, STAT_SHOWDOWNS); }
+    float AggressionFrequency() const {   // Share of chip-moving actions that were bets or raises
+        uint32_t total = counts[STAT_AGGRESSIVE] + counts[STAT_PASSIVE];
+        return total ? (float)counts[STAT_AGGRESSIVE] / total : 0.0f;
+    }
+
+    void Merge(const OpponentStats& other) {
+        for (int i = 0; i < OPPONENT_STAT_COUNT; i++) counts[i] += other.counts[i];
+    }
+
+private:
+    float Ratio(OpponentStat part, OpponentStat whole) const {
+        return counts[whole] ? (float)counts[part] / counts[whole] : 0.0f;
+    }
+};
+
+// Per-player stats fed by the tables' action events (or rebuilt from hand history files)
+// Only the per-player counters live here; each table follows its own hand with an OpponentStatsHand,
+// so any number of tables can share one tracker.
+// One thread writes (the thread driving the hands); any thread may Lookup() at the same time -
+// each slot is a seqlock, so readers never block the writer and never see a half-applied action
+class OpponentStatsTracker {
+private:
+    friend class OpponentStatsHand;
+
+    struct Slot {
+        std::atomic<uint32_t> id;           // 0 = free; set once, never cleared while readers run
+        std::atomic<uint32_t> sequence;     // Odd while the writer is mid-update
+        std::atomic<uint32_t> counts[OPPONENT_STAT_COUNT];
+    };
+
+    Slot slots[OPPONENT_STATS_CAPACITY];
+
+    int FindSlot(uint32_t id) const;
+    int ClaimSlot(uint32_t id);
+    void Add(int slot, OpponentStat first, OpponentStat second = OPPONENT_STAT_COUNT);
+
+public:
+    OpponentStatsTracker();
+
+    // Stable id for a player name (FNV-1a, never 0)
+    static uint32_t PlayerId(const std::string& name);
+
+    // Rebuild from history: one recorded hand, or every segment under a recorder base (returns hands read)
+    void AddHand(const HandView& hand);
+    int LoadHistory(const std::string& base);
+
+    // Lock-free snapshot of one player (false if never seen)
+    bool Lookup(uint32_t playerId, OpponentStats& out) const;
+
+    // Merged snapshot of several players (unknown ids add nothing)
+    OpponentStats Profile(const uint32_t* playerIds, int count) const;
+
+    // Forget everyone - writer only, with no readers running and no hands being tracked
+    void Clear();
+    int GetPlayerCount() const;
+
+    // Shared tracker for the tables in the room (written on the main thread)
+    static OpponentStatsTracker* GetGlobal();
+};
+
+// One table's view of the hand in progress: which seats are tracked, the street, the preflop
+// aggressor... Counts go into the tracker's shared per-player slots. Keep one per table
+class OpponentStatsHand {
+private:
+    // What the current hand has already counted, so the once-per-hand stats stay once per hand
+    struct HandSeat {
+        int slot;
+        bool vpip;
+        bool pfr;
+        bool threeBetChance;
+        bool cbetFaced;
+    };
+
+    OpponentStatsTracker* tracker;
+    HandSeat hand[MAX_SEATS];
+    uint32_t handMask;          // Seats being tracked this hand
+    int bigBlindSeat;
+    int preflopRaises;
+    int preflopAggressor;       // Last preflop raiser (-1 = none)
+    int street;                 // HandPhase of the last action
+    bool streetBet;             // Something to call on this street (preflop starts with the blind)
+    bool cbetOpen;              // The preflop raiser led the flop and nobody has raised since
+
+    void StartTracking(const uint32_t* playerIds, uint32_t seatMask, int bigBlind);
+    void FinishTracking(uint32_t showdownMask, const int32_t* payouts);
+
+public:
+    explicit OpponentStatsHand(OpponentStatsTracker* tracker = nullptr);
+
+    // Where the counts go (nullptr = nowhere); takes effect from the next BeginHand()
+    void SetTracker(OpponentStatsTracker* target);
+    OpponentStatsTracker* GetTracker() const { return tracker; }
+
+    // Live feed - same call points as HandHistoryRecorder (built for every POKER_ENGINE_SEAT_COUNTS engine)
+    // Seats with a 0 id aren't tracked. Record the action the engine applied, not the one requested
+    template <int Seats> void BeginHand(const PokerEngineT<Seats>& engine, const uint32_t* playerIds);
+    void RecordAction(int seat, HandPhase phase, PokerActionType type);
+    void RecordStandUp(int seat);
+    template <int Seats> void EndHand(const PokerEngineT<Seats>& engine);
+
+    // One recorded hand, start to finish
+    void AddHand(const HandView& hand);
+};
+
+#endif
@@ -0,0 +1,373 @@
+#include "gameplay/poker_engine.hpp"
+#include <algorithm>
+
+template <int Seats>
+PokerEngineT<Seats>::PokerEngineT(uint64_t seed)
+    : boardCount(0), pot(0), currentBet(0), currentSeat(-1), smallBlindSeat(-1), bigBlindSeat(-1),
+      phase(PHASE_WAITING), handMask(0), liveMask(0), activeMask(0), actedMask(0), raisedMask(0), lastAction(ACTION_FOLD),
+      blinds(), level(), handNumber(0),
+      seeder(seed != 0 ? seed : Rng::RandomSeed()), handSeed(0), deck(),
+      nextSmallBlindSeat(-1), nextHandSeed(0), nextHandSet(false)
+{
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        board[i] = -1;
+    }
+}
+
+// ========== SEATING ==========
+
+template <int Seats>
+bool PokerEngineT<Seats>::SitDown(int seat, int stack) {
+    if (seat < 0 || seat >= Seats) return false;
+    if (seats[seat].occupied) return false;
+
+    seats[seat] = EngineSeat();
+    seats[seat].occupied = true;
+    seats[seat].stack = stack;
+    return true;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::StandUp(int seat) {
+    if (seat < 0 || seat >= Seats) return;
+    if (!seats[seat].occupied) return;
+
+    // Leaving mid-hand forfeits whatever is already in the pot
+    if (IsBetting() && IsInHand(seat)) {
+        Fold(seat);
+        AfterAction(seat);
+    } else if (phase == PHASE_SHOWDOWN && IsInHand(seat)) {
+        Fold(seat);
+        if (CountLive() <= 1) AwardUncontested();
+    }
+
+    uint32_t bit = 1u << seat;
+    handMask &= ~bit;
+    liveMask &= ~bit;
+    activeMask &= ~bit;
+    seats[seat].occupied = false;
+    seats[seat].inHand = false;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::SetStack(int seat, int stack) {
+    if (seat < 0 || seat >= Seats) return;
+    if (IsBetting() || phase == PHASE_SHOWDOWN) return;
+    seats[seat].stack = stack;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::SetBlinds(int small, int big, int ante) {
+    SetBlindStructure(BlindStructure::Fixed(small, big, ante));
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::SetBlindStructure(const BlindStructure& structure) {
+    if (IsBetting() || phase == PHASE_SHOWDOWN) return;
+    if (!structure.IsValid()) return;
+    blinds = structure;
+    handNumber = 0;
+    level = blinds.GetLevel(0);
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::SetNextHand(int smallBlindSeat, uint64_t seed) {
+    if (IsBetting() || phase == PHASE_SHOWDOWN) return;
+    if (smallBlindSeat < 0 || smallBlindSeat >= Seats) return;
+    nextSmallBlindSeat = smallBlindSeat;
+    nextHandSeed = seed;
+    nextHandSet = true;
+}
+
+// ========== HAND FLOW ==========
+
+template <int Seats>
+bool PokerEngineT<Seats>::StartHand() {
+    uint32_t funded = 0;
+    for (int i = 0; i < Seats; i++) {
+        if (seats[i].occupied && seats[i].stack > 0) funded |= 1u << i;
+    }
+    int fundedCount = __builtin_popcount(funded);
+    if (fundedCount < 2) return false;
+
+    for (int i = 0; i < Seats; i++) {
+        EngineSeat& s = seats[i];
+        s.inHand = (funded >> i) & 1u;
+        s.folded = !s.inHand;
+        s.allIn = false;
+        s.roundBet = 0;
+        s.totalBet = 0;
+        s.winnings = 0;
+        s.holeCards[0] = s.holeCards[1] = -1;
+        s.hand = CardMask();
+        s.strength = 0;
+    }
+    handMask = liveMask = activeMask = funded;
+    actedMask = raisedMask = 0;
+
+    boardCount = 0;
+    boardMask = CardMask();
+    pot = 0;
+    currentBet = 0;
+    handSeed = seeder.Next();
+    level = blinds.GetLevel(handNumber++);
+
+    // Rotate blinds (first hand starts from the lowest funded seat)
+    smallBlindSeat = NextSeatInHand(smallBlindSeat);
+
+    // A pinned hand (replay) starts from the recorded button and deck instead
+    if (nextHandSet) {
+        if (seats[nextSmallBlindSeat].inHand) smallBlindSeat = nextSmallBlindSeat;
+        handSeed = nextHandSeed;
+        nextHandSet = false;
+    }
+
+    deck.Seed(handSeed);
+    bigBlindSeat = NextSeatInHand(smallBlindSeat);
+
+    // Deal two rounds starting with the small blind
+    for (int round = 0; round < HOLE_CARDS; round++) {
+        int seat = smallBlindSeat;
+        for (int n = 0; n < fundedCount; n++) {
+            int card = deck.Deal();
+            seats[seat].holeCards[round] = card;
+            seats[seat].hand.Add(card);
+            seat = NextSeatInHand(seat);
+        }
+    }
+
+    // Antes, then blinds (short stacks go all-in for what they have)
+    if (level.ante > 0) {
+        for (uint32_t m = handMask; m; m &= m - 1) {
+            int seat = __builtin_ctz(m);
+            PostAnte(seat, level.ante);
+        }
+    }
+    Commit(smallBlindSeat, level.smallBlind);
+    Commit(bigBlindSeat, level.bigBlind);
+    currentBet = level.bigBlind;
+
+    phase = PHASE_PREFLOP;
+    currentSeat = NextSeatToAct(bigBlindSeat);
+
+    // Blinds alone can put everyone all-in
+    if (currentSeat == -1) {
+        AdvanceStreet();
+    }
+
+    return true;
+}
+
+template <int Seats>
+bool PokerEngineT<Seats>::ApplyAction(const PokerAction& action) {
+    if (!IsBetting() || currentSeat < 0) return false;
+
+    int seat = currentSeat;
+    EngineSeat& s = seats[seat];
+
+    PokerActionType type = action.type;
+    int raiseTo = action.amount;
+
+    // Raises that aren't allowed or don't top the current bet become calls
+    if (type == ACTION_RAISE) {
+        if (!CanRaise(seat)) {
+            type = ACTION_CALL;
+        } else {
+            raiseTo = std::max(raiseTo, GetMinRaise());
+            raiseTo = std::min(raiseTo, GetMaxRaise(seat));
+            if (raiseTo <= currentBet) type = ACTION_CALL;
+        }
+    }
+
+    lastAction = type;
+    if (type == ACTION_FOLD) {
+        Fold(seat);
+    } else if (type == ACTION_CALL) {
+        Commit(seat, currentBet - s.roundBet);
+    } else {
+        Commit(seat, raiseTo - s.roundBet);
+        currentBet = s.roundBet;
+        raisedMask |= 1u << seat;
+
+        // Everyone else has to respond to the raise
+        actedMask = 0;
+    }
+
+    actedMask |= 1u << seat;
+    AfterAction(seat);
+    return true;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::SetHand(int seat, CardMask hand) {
+    if (seat < 0 || seat >= Seats) return;
+    seats[seat].hand = hand;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::ResolveShowdown() {
+    if (phase != PHASE_SHOWDOWN) return;
+
+    // Main and side pots each go to the best hand that covered them
+    HandStrength strengths[MAX_SEATS] = {0};
+    int winnings[MAX_SEATS] = {0};
+    for (uint32_t m = liveMask; m; m &= m - 1) {
+        int i = __builtin_ctz(m);
+        seats[i].strength = HandEvaluator::Evaluate(seats[i].hand | boardMask);
+        strengths[i] = seats[i].strength;
+    }
+
+    PotSettlement::Settle(GetContributions(), strengths, smallBlindSeat, winnings);
+    for (int i = 0; i < Seats; i++) {
+        seats[i].winnings += winnings[i];
+        seats[i].stack += winnings[i];
+    }
+
+    pot = 0;
+    currentSeat = -1;
+    phase = PHASE_COMPLETE;
+}
+
+// ========== BETTING QUERIES ==========
+
+template <int Seats>
+PotContributions PokerEngineT<Seats>::GetContributions() const {
+    PotContributions contributions;
+    for (int i = 0; i < Seats; i++) {
+        contributions.committed[i] = seats[i].totalBet;
+        contributions.live[i] = (liveMask >> i) & 1u;
+    }
+    return contributions;
+}
+
+template <int Seats>
+int PokerEngineT<Seats>::GetPots(SidePot* pots) const {
+    return PotSettlement::BuildPots(GetContributions(), pots);
+}
+
+template <int Seats>
+int PokerEngineT<Seats>::GetCallAmount(int seat) const {
+    if (seat < 0 || seat >= Seats) return 0;
+    return std::max(0, currentBet - seats[seat].roundBet);
+}
+
+template <int Seats>
+int PokerEngineT<Seats>::GetMaxRaise(int seat) const {
+    if (seat < 0 || seat >= Seats) return 0;
+    return seats[seat].roundBet + seats[seat].stack;
+}
+
+template <int Seats>
+bool PokerEngineT<Seats>::CanRaise(int seat) const {
+    if (seat < 0 || seat >= Seats) return false;
+    return !seats[seat].allIn && !((raisedMask >> seat) & 1u) && GetMaxRaise(seat) > currentBet;
+}
+
+// ========== HELPERS ==========
+
+template <int Seats>
+int PokerEngineT<Seats>::NextInMask(uint32_t mask, int index) {
+    // index may be -1 (start from seat 0)
+    uint32_t after = (index + 1 >= Seats) ? 0u : mask & (~0u << (index + 1));
+    if (after) return __builtin_ctz(after);
+    return mask ? __builtin_ctz(mask) : -1;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::Commit(int seat, int amount) {
+    EngineSeat& s = seats[seat];
+    amount = std::min(amount, s.stack);
+    if (amount <= 0) return;
+
+    s.stack -= amount;
+    s.roundBet += amount;
+    s.totalBet += amount;
+    pot += amount;
+    if (s.stack == 0) {
+        s.allIn = true;
+        activeMask &= ~(1u << seat);
+    }
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::PostAnte(int seat, int amount) {
+    Commit(seat, amount);
+    seats[seat].roundBet = 0;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::Fold(int seat) {
+    uint32_t bit = 1u << seat;
+    seats[seat].folded = true;
+    liveMask &= ~bit;
+    activeMask &= ~bit;
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::AfterAction(int seat) {
+    if (CountLive() <= 1) {
+        AwardUncontested();
+        return;
+    }
+
+    // A raise clears everyone else's acted bit and a call always matches the bet (or goes all-in),
+    // so once every seat that can act has acted, the bets are level
+    if (IsRoundComplete()) {
+        AdvanceStreet();
+    } else if (seat == currentSeat) {
+        currentSeat = NextSeatToAct(seat);
+    }
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::AdvanceStreet() {
+    for (int i = 0; i < Seats; i++) {
+        seats[i].roundBet = 0;
+    }
+    actedMask = raisedMask = 0;
+    currentBet = 0;
+
+    // Keep dealing while at most one seat can still bet (everyone else is all-in)
+    do {
+        switch (phase) {
+            case PHASE_PREFLOP:
+                for (int i = 0; i < 3; i++) {
+                    board[boardCount] = deck.Deal();
+                    boardMask.Add(board[boardCount++]);
+                }
+                phase = PHASE_FLOP;
+                break;
+            case PHASE_FLOP:
+            case PHASE_TURN:
+                board[boardCount] = deck.Deal();
+                boardMask.Add(board[boardCount++]);
+                phase = (phase == PHASE_FLOP) ? PHASE_TURN : PHASE_RIVER;
+                break;
+            default:
+                phase = PHASE_SHOWDOWN;
+                currentSeat = -1;
+                return;
+        }
+    } while (CountCanAct() <= 1);
+
+    // Post-flop action starts with the first live seat from the small blind -
+    // except heads-up, where the small blind is the button and acts last
+    int firstSeat = (__builtin_popcount(handMask) == 2) ? bigBlindSeat : smallBlindSeat;
+    currentSeat = NextSeatToAct(firstSeat - 1);
+}
+
+template <int Seats>
+void PokerEngineT<Seats>::AwardUncontested() {
+    if (liveMask) {
+        int winner = __builtin_ctz(liveMask);
+        seats[winner].winnings += pot;
+        seats[winner].stack += pot;
+    }
+    pot = 0;
+    currentSeat = -1;
+    phase = PHASE_COMPLETE;
+}
+
+#define POKER_ENGINE_INSTANTIATE(n) template class PokerEngineT<n>;
+POKER_ENGINE_SEAT_COUNTS(POKER_ENGINE_INSTANTIATE)
+#undef POKER_ENGINE_INSTANTIATE
@@ -0,0 +1,185 @@
+#ifndef POKER_ENGINE_HPP
+#define POKER_ENGINE_HPP
+
+#include "gameplay/card_mask.hpp"
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/pot_settlement.hpp"
+#include "gameplay/fast_deck.hpp"
+#include "gameplay/blind_structure.hpp"
+#include <array>
+#include <cstdint>
+
+#define BOARD_SIZE 5
+#define HOLE_CARDS 2
+
+// Table sizes PokerEngineT is built for (explicit instantiations in poker_engine.cpp)
+// Other seat counts run on the next size up - empty seats are never dealt in
+#define POKER_ENGINE_SEAT_COUNTS(X) X(2) X(6) X(8) X(9) X(10)
+#define DEFAULT_TABLE_SEATS 8
+
+// Betting actions (values match Person::PromptBet return codes)
+enum PokerActionType {
+    ACTION_FOLD = 0,
+    ACTION_CALL = 1,    // Also a check when nothing is owed
+    ACTION_RAISE = 2
+};
+
+struct PokerAction {
+    PokerActionType type;
+    int amount;         // Raise-to total for this round (ignored for fold/call)
+
+    PokerAction(PokerActionType t = ACTION_FOLD, int a = 0) : type(t), amount(a) {}
+};
+
+// Where the current hand is
+enum HandPhase {
+    PHASE_WAITING,      // No hand running
+    PHASE_PREFLOP,
+    PHASE_FLOP,
+    PHASE_TURN,
+    PHASE_RIVER,
+    PHASE_SHOWDOWN,     // Betting is over - call ResolveShowdown()
+    PHASE_COMPLETE      // Pot awarded - winnings are readable until the next StartHand()
+};
+
+// Plain value state for one seat
+struct EngineSeat {
+    bool occupied;
+    bool inHand;        // Dealt into the current hand
+    bool folded;
+    bool allIn;
+    int stack;          // Chips behind
+    int roundBet;       // Committed this betting round
+    int totalBet;       // Committed this hand (antes included)
+    int winnings;       // Paid out at the end of the hand
+    int holeCards[HOLE_CARDS];
+    CardMask hand;      // Cards this seat plays with (hole cards unless overridden)
+    HandStrength strength;
+
+    EngineSeat()
+        : occupied(false), inHand(false), folded(true), allIn(false),
+          stack(0), roundBet(0), totalBet(0), winnings(0), holeCards{-1, -1}, hand(), strength(0) {}
+};
+
+// Headless Texas Hold'em hand state machine for a table of Seats seats
+// Knows nothing about rendering, the DOM or inventories - seats, stacks, pot and board are plain values
+// and the hand only moves forward through StartHand(), ApplyAction() and ResolveShowdown()
+// Who is dealt in, still live, able to act and done acting this round is also kept as one bit per seat,
+// so finding the next seat or checking whether a round is over is a mask test instead of a seat scan.
+template <int Seats>
+class PokerEngineT {
+    static_assert(Seats >= 2 && Seats <= MAX_SEATS, "PokerEngineT seat count must be 2..MAX_SEATS");
+
+private:
+    std::array<EngineSeat, Seats> seats;
+    int board[BOARD_SIZE];
+    int boardCount;
+    CardMask boardMask;
+    int pot;
+    int currentBet;
+    int currentSeat;
+    int smallBlindSeat;
+    int bigBlindSeat;
+    HandPhase phase;
+
+    // Seat bitmasks (bit i = seat i)
+    uint32_t handMask;      // Dealt into this hand
+    uint32_t liveMask;      // Dealt in and not folded
+    uint32_t activeMask;    // Live and not all-in (still has decisions to make)
+    uint32_t actedMask;     // Acted since the last raise this round
+    uint32_t raisedMask;    // Raised this round (each seat may raise once per round)
+    PokerActionType lastAction;   // What the last ApplyAction() did, after raises were checked
+
+    // Blinds and antes come from a runtime schedule; level is what the current hand uses
+    BlindStructure blinds;
+    BlindLevel level;
+    int handNumber;         // Hands started since SetBlindStructure()
+
+    // Engine-owned deck: each card drawn is one step of a partial Fisher-Yates
+    // Every hand reseeds it from the seeder, so a single hand replays from its own seed
+    Rng seeder;
+    uint64_t handSeed;
+    FastDeck deck;
+
+    // Set by SetNextHand() for replays: the next StartHand() uses these instead of rotating/drawing
+    int nextSmallBlindSeat;
+    uint64_t nextHandSeed;
+    bool nextHandSet;
+
+    static int NextInMask(uint32_t mask, int index);  // First set bit after index, wrapping (-1 if none)
+
+    void Commit(int seat, int amount);
+    void PostAnte(int seat, int amount);     // Dead money: counts toward the pot, not the round's bet
+    void Fold(int seat);
+    int NextSeatInHand(int index) const { return NextInMask(handMask, index); }
+    int NextSeatToAct(int index) const { return NextInMask(activeMask, index); }
+    int CountLive() const { return __builtin_popcount(liveMask); }
+    int CountCanAct() const { return __builtin_popcount(activeMask); }
+    bool IsRoundComplete() const { return (activeMask & ~actedMask) == 0; }
+    void AfterAction(int seat);
+    void AdvanceStreet();
+    void AwardUncontested();
+
+public:
+    static const int SEAT_COUNT = Seats;
+
+    explicit PokerEngineT(uint64_t seed = 0);  // 0 = random seed
+
+    // Seating
+    bool SitDown(int seat, int stack);
+    void StandUp(int seat);                 // Folds the seat first if it is in a hand
+    void SetStack(int seat, int stack);     // Only between hands
+    void SetBlinds(int small, int big, int ante = 0);           // Only between hands - fixed blinds from now on
+    void SetBlindStructure(const BlindStructure& structure);    // Only between hands - levels count from the next hand
+
+    // Hand flow
+    bool StartHand();                       // Needs 2+ seats with chips
+    bool ApplyAction(const PokerAction& action);  // Acts for GetCurrentSeat()
+    void SetHand(int seat, CardMask hand);  // Override the cards a seat shows down with
+    void ResolveShowdown();
+    void Seed(uint64_t seed) { seeder.Seed(seed); }  // Same seed + same actions = same hands
+    void SetNextHand(int smallBlindSeat, uint64_t seed);  // Only between hands - pins the button and deck (replays)
+
+    // Betting queries
+    bool IsBetting() const { return phase >= PHASE_PREFLOP && phase <= PHASE_RIVER; }
+    int GetCallAmount(int seat) const;      // Not clamped to the stack
+    int GetMinRaise() const { return currentBet + level.bigBlind; }
+    int GetMaxRaise(int seat) const;
+    bool CanRaise(int seat) const;
+    int GetStreetRaises() const { return __builtin_popcount(raisedMask); }   // Each seat raises at most once a round
+    PokerActionType GetLastAction() const { return lastAction; }   // A raise that wasn't allowed reads as a call
+
+    // Accessors
+    int GetSeatCount() const { return Seats; }
+    HandPhase GetPhase() const { return phase; }
+    int GetCurrentSeat() const { return currentSeat; }
+    int GetCurrentBet() const { return currentBet; }
+    int GetPot() const { return pot; }
+    PotContributions GetContributions() const;   // Per-seat chips in this hand
+    int GetPots(SidePot* pots) const;            // Main + side pots into pots[MAX_POTS], returns count
+    uint64_t GetHandSeed() const { return handSeed; }  // Deck seed of the current/last hand
+    int GetSmallBlindSeat() const { return smallBlindSeat; }
+    int GetBigBlindSeat() const { return bigBlindSeat; }
+    int GetSmallBlind() const { return level.smallBlind; }
+    int GetBigBlind() const { return level.bigBlind; }
+    int GetAnte() const { return level.ante; }
+    const BlindStructure& GetBlindStructure() const { return blinds; }
+    int GetHandNumber() const { return handNumber; }
+    int GetBoardCount() const { return boardCount; }
+    int GetBoardCard(int i) const { return board[i]; }
+    CardMask GetBoard() const { return boardMask; }
+    int GetLiveCount() const { return CountLive(); }
+    uint32_t GetLiveMask() const { return liveMask; }
+    const EngineSeat& GetSeat(int seat) const { return seats[seat]; }
+    int GetStack(int seat) const { return seats[seat].stack; }
+    int GetWinnings(int seat) const { return seats[seat].winnings; }
+    bool IsInHand(int seat) const { return (liveMask >> seat) & 1u; }
+};
+
+#define POKER_ENGINE_EXTERN(n) extern template class PokerEngineT<n>;
+POKER_ENGINE_SEAT_COUNTS(POKER_ENGINE_EXTERN)
+#undef POKER_ENGINE_EXTERN
+
+typedef PokerEngineT<DEFAULT_TABLE_SEATS> PokerEngine;
+
+#endif
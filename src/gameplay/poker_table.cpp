@@ -1,4 +1,5 @@
 #include "gameplay/poker_table.hpp"
+#include "gameplay/hand_optimizer.hpp"
 #include "entities/dealer.hpp"
 #include "entities/player.hpp"
 #include "items/chip.hpp"
@@ -6,52 +7,47 @@
 #include "core/dom.hpp"
 #include "raymath.h"
 #include <cstring>
-#include <map>
 #include <cstdio>
 
-PokerTable::PokerTable(Vector3 pos, Vector3 tableSize, Color tableColor, PhysicsWorld* physicsWorld)
+PokerTable::PokerTable(Vector3 pos, Vector3 tableSize, Color tableColor, PhysicsWorld* physicsWorld, int tableSeats)
     : Interactable(pos), size(tableSize), color(tableColor),
-      dealer(nullptr), deck(nullptr), potStack(nullptr),
-      smallBlindSeat(-1), bigBlindSeat(-1), currentPlayerSeat(-1),
-      currentBet(0), potValue(0), handActive(false), bettingActive(false), showdownActive(false),
-      lastLoggedPlayerSeat(-1)
+      deck(nullptr), seatCount(tableSeats), blindsPending(false),
+      statsHand(OpponentStatsTracker::GetGlobal()), replayNext(-1), handActive(false), state(TABLE_IDLE),
+      dealTimer(0.0f), requestId(0), awaitSeat(-1), advancing(false)
 {
-    // Calculate seat positions around the table
+    if (seatCount < 2) seatCount = 2;
+    if (seatCount > MAX_SEATS) seatCount = MAX_SEATS;
+
     float hw = size.x / 2.0f;
     float hd = size.z / 2.0f;
     float dist = 1.2f;
     float ground = pos.y - size.y / 2.0f;
 
-    seats[0].position = {pos.x - hw/2, ground, pos.z + hd + dist};
-    seats[1].position = {pos.x + hw/2, ground, pos.z + hd + dist};
-    seats[2].position = {pos.x - hw - dist, ground, pos.z + hd/2};
-    seats[3].position = {pos.x - hw - dist, ground, pos.z - hd/2};
-    seats[4].position = {pos.x + hw + dist, ground, pos.z + hd/2};
-    seats[5].position = {pos.x + hw + dist, ground, pos.z - hd/2};
-    seats[6].position = {pos.x - hw/2, ground, pos.z - hd - dist};
-    seats[7].position = {pos.x + hw/2, ground, pos.z - hd - dist};
+    LayOutSeats(pos);
 
     // Initialize seats as empty
     for (int i = 0; i < MAX_SEATS; i++) {
-        seats[i].occupant = nullptr;
+        seats[i].occupant = ObjectHandle();
         seats[i].isOccupied = false;
-        statusList[i] = 0;
-        hasRaised[i] = false;
+        chipsCommitted[i] = 0;
+        playerIds[i] = 0;
     }
 
     // Create dealer and add to DOM
-    dealer = new Dealer({pos.x, ground, pos.z - hd - dist}, "Dealer");
-    DOM::GetGlobal()->AddObject(dealer);
+    Dealer* newDealer = new Dealer({pos.x, ground, pos.z - hd - dist}, "Dealer");
+    DOM::GetGlobal()->AddObject(newDealer);
+    dealer = newDealer->GetHandle();
 
     // Create deck (not added to DOM - we don't want to render it)
+    // The engine shuffles and deals card indices; the deck just supplies the matching Card objects
     Vector3 deckPos = {pos.x - hw * 0.5f, pos.y + size.y / 2.0f + 0.05f, pos.z};
     deck = new Deck(deckPos);
-    deck->Shuffle();
 
     // Create pot stack and add to DOM
     Vector3 potPos = {pos.x - hw * 0.5f, pos.y + size.y / 2.0f + 0.05f, pos.z - 0.5f};
-    potStack = new ChipStack(potPos);
-    DOM::GetGlobal()->AddObject(potStack);
+    ChipStack* newPotStack = new ChipStack(potPos);
+    DOM::GetGlobal()->AddObject(newPotStack);
+    potStack = newPotStack->GetHandle();
 
     // Create collision geometry that extends higher than table to prevent walking on top
     // This makes the table act like a solid barrier you can't walk through or climb on
@@ -66,14 +62,22 @@ PokerTable::PokerTable(Vector3 pos, Vector3 tableSize, Color tableColor, Physics
         collider.SetCollisionBits(COLLISION_CATEGORY_TABLE, ~0);
         collider.UpdateFromObject(this);
     }
+
+    if (HAND_HISTORY_ENABLED) {
+        // One base per table, so tables never write into each other's segments
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), "_t%04d", GetID());
+        StartRecording(HAND_HISTORY_BASE_PATH + std::string(suffix));
+    }
 }
 
 PokerTable::~PokerTable() {
+    // Seated people outlive the table - make sure none of them can call back into it
+    CancelRequests();
+    for (int i = 0; i < MAX_SEATS; i++) CancelCardSelection(i);
+
     // Note: dealer and potStack are owned by DOM and will be cleaned up by DOM
     // We don't delete them here to avoid double-free
-    // Just set pointers to nullptr for safety
-    dealer = nullptr;
-    potStack = nullptr;
 
     // Clean up deck (not in DOM, we own it)
     if (deck) {
@@ -85,54 +89,35 @@ PokerTable::~PokerTable() {
 }
 
 void PokerTable::Update(float deltaTime) {
-    // Check if dealer is still alive (if they were shot, stop the game)
-    if (dealer) {
-        DOM* dom = DOM::GetGlobal();
-        bool dealerExists = false;
-
-        if (dom) {
-            // Check if dealer is still in the DOM
-            for (int i = 0; i < dom->GetCount(); i++) {
-                if (dom->GetObject(i) == dealer) {
-                    dealerExists = true;
-                    break;
-                }
-            }
-        }
+    // A destroyed dealer ends the game however it happened (one handle lookup, no DOM scan)
+    if (state != TABLE_STOPPED && !DOM::Resolve(dealer)) {
+        POKER_LOG(LOG_INFO, "*** DEALER IS GONE - POKER GAME STOPPED ***");
+        StopGame();
+        return;
+    }
+    VacateStaleSeats();
 
-        // If dealer was removed (shot), stop the game
-        if (!dealerExists) {
-            POKER_LOG(LOG_INFO, "*** DEALER WAS KILLED - POKER GAME STOPPED ***");
-            dealer = nullptr;
-            handActive = false;
-            bettingActive = false;
-
-            // Clear all seats
-            for (int i = 0; i < MAX_SEATS; i++) {
-                if (seats[i].isOccupied && seats[i].occupant) {
-                    seats[i].occupant->StandUp();
-                    seats[i].occupant = nullptr;
-                    seats[i].isOccupied = false;
-                }
-            }
+    switch (state) {
+    case TABLE_IDLE:
+        // Deal once the timer has run out (seating changes reset it)
+        if (dealTimer > 0.0f) {
+            dealTimer -= deltaTime;
+            if (dealTimer > 0.0f) return;
+        }
+        if (GetOccupiedSeatCount() < 2) return;
+        if (!StartHand()) {
+            dealTimer = TABLE_DEAL_RETRY_SECONDS;
             return;
         }
-    }
-
-    // Start hand if we have 2+ players and no active hand and dealer is alive
-    if (!handActive && GetOccupiedSeatCount() >= 2 && dealer) {
-        StartHand();
-    }
+        Advance();
+        return;
 
-    // Process betting if active
-    if (bettingActive) {
-        ProcessBetting(deltaTime);
-        POKER_LOG(LOG_INFO, "ProcessBetting completed, returning from PokerTable::Update");
-    }
+    case TABLE_ADVANCE:
+        Advance();
+        return;
 
-    // Process showdown if active (waiting for card selection)
-    if (showdownActive) {
-        Showdown();
+    default:
+        return;  // Waiting on a callback, or stopped
     }
 }
 
@@ -164,11 +149,53 @@ std::string PokerTable::GetType() const {
 
 // ========== SEATING ==========
 
+void PokerTable::LayOutSeats(Vector3 pos) {
+    float hw = size.x / 2.0f;
+    float hd = size.z / 2.0f;
+    float dist = 1.2f;
+    float ground = pos.y - size.y / 2.0f;
+
+    // Ends get one seat each (two from 8-max up); the long sides share the rest, with an even
+    // count on the dealer's side so nobody sits in front of the dealer
+    int perEnd = (seatCount >= 8) ? 2 : 1;
+    int sides = seatCount - 2 * perEnd;
+    int back = (sides / 2) & ~1;
+    int front = sides - back;
+
+    // Front (left to right), left end, right end (far to near), back (left to right)
+    int seat = 0;
+    for (int i = 0; i < front; i++) {
+        float x = pos.x - hw + size.x * (i + 0.5f) / front;
+        seats[seat++].position = {x, ground, pos.z + hd + dist};
+    }
+    for (int side = -1; side <= 1; side += 2) {
+        for (int i = 0; i < perEnd; i++) {
+            float z = pos.z + hd - size.z * (i + 0.5f) / perEnd;
+            seats[seat++].position = {pos.x + side * (hw + dist), ground, z};
+        }
+    }
+    for (int i = 0; i < back; i++) {
+        float x = pos.x - hw + size.x * (i + 0.5f) / back;
+        seats[seat++].position = {x, ground, pos.z - hd - dist};
+    }
+
+    // Unused seats stay at the table centre (never offered - see FindClosestOpenSeat)
+    for (; seat < MAX_SEATS; seat++) {
+        seats[seat].position = {pos.x, ground, pos.z};
+    }
+}
+
+void PokerTable::SetBlindStructure(const BlindStructure& structure) {
+    if (!structure.IsValid()) return;
+    blinds = structure;
+    blindsPending = true;
+}
+
 int PokerTable::FindClosestOpenSeat(Vector3 pos) {
     int closest = -1;
     float closestDist = FLT_MAX;
 
-    for (int i = 0; i < MAX_SEATS; i++) {
+    for (int i = 0; i < seatCount; i++) {
         if (!seats[i].isOccupied) {
             float dist = Vector3Distance(pos, seats[i].position);
             if (dist < closestDist) {
@@ -182,29 +209,24 @@ int PokerTable::FindClosestOpenSeat(Vector3 pos) {
 }
 
 bool PokerTable::SeatPerson(Person* p, int seatIndex) {
-    if (seatIndex < 0 || seatIndex >= MAX_SEATS) return false;
+    if (seatIndex < 0 || seatIndex >= seatCount) return false;
     if (!p) return false;
     if (seats[seatIndex].isOccupied) return false;
 
     // Can't sit down if dealer is dead
-    if (!dealer) {
+    if (!DOM::Resolve(dealer)) {
         POKER_LOG(LOG_INFO, "Cannot sit down - dealer has been killed!");
         return false;
     }
 
-    // Seat the person
+    // Seat the person (joining mid-hand sits out until the next deal)
     p->SitDownFacingPoint(seats[seatIndex].position, position);
-    seats[seatIndex].occupant = p;
+    seats[seatIndex].occupant = p->GetHandle();
     seats[seatIndex].isOccupied = true;
-
-    // If joining mid-hand, mark as folded
-    if (handActive) {
-        statusList[seatIndex] = -1;
-        // POKER_LOG(LOG_INFO, "Seated %s at seat %d (folded - mid-hand)", p->GetName().c_str(), seatIndex);
-    } else {
-        statusList[seatIndex] = 0;
-        // POKER_LOG(LOG_INFO, "Seated %s at seat %d", p->GetName().c_str(), seatIndex);
-    }
+    engine.SitDown(seatIndex, CountChips(p));
+    chipsCommitted[seatIndex] = 0;
+    playerIds[seatIndex] = OpponentStatsTracker::PlayerId(p->GetName());
+    dealTimer = 0.0f;  // Someone new might make a hand possible
 
     return true;
 }
@@ -213,7 +235,10 @@ void PokerTable::UnseatPerson(Person* p) {
     if (!p) return;
 
     for (int i = 0; i < MAX_SEATS; i++) {
-        if (seats[i].occupant == p) {
+        if (seats[i].occupant == p->GetHandle()) {
+            // Their answer is no longer wanted
+            if (awaitSeat == i) CancelRequests();
+
             // Return only the dealt hole cards before unseating (during active hand)
             if (handActive) {
                 Inventory* inv = p->GetInventory();
@@ -237,9 +262,7 @@ void PokerTable::UnseatPerson(Person* p) {
                 }
             }
 
-            seats[i].occupant = nullptr;
-            seats[i].isOccupied = false;
-            statusList[i] = 0;
+            VacateSeat(i);
             p->StandUp();
             // POKER_LOG(LOG_INFO, "Unseated %s from seat %d", p->GetName().c_str(), i);
             return;
@@ -247,11 +270,71 @@ void PokerTable::UnseatPerson(Person* p) {
     }
 }
 
+void PokerTable::VacateSeat(int seat) {
+    if (state == TABLE_AWAIT_SHOWDOWN) CancelCardSelection(seat);
+
+    // Chips already bet stay in the pot
+    StandUpSeat(seat);
+    seats[seat].occupant = ObjectHandle();
+    seats[seat].isOccupied = false;
+    chipsCommitted[seat] = 0;
+    playerIds[seat] = 0;
+    dealtHoleCards[seat].clear();
+
+    // The hand may have moved on (or ended) without them - pick it up on the next Update()
+    if (handActive) {
+        bool stillWaiting = state == TABLE_AWAIT_BET && engine.IsBetting() &&
+                            engine.GetCurrentSeat() == awaitSeat;
+        if (!stillWaiting) {
+            CancelRequests();
+            state = TABLE_ADVANCE;
+        }
+    }
+}
+
+void PokerTable::VacateStaleSeats() {
+    for (int i = 0; i < MAX_SEATS; i++) {
+        if (!seats[i].isOccupied || GetOccupant(i)) continue;
+        POKER_LOG(LOG_INFO, "Seat %d occupant was destroyed - vacating seat", i);
+        if (awaitSeat == i) CancelRequests();
+        VacateSeat(i);
+    }
+}
+
+void PokerTable::OnPersonKilled(Person* p) {
+    if (!p) return;
+
+    if (p->GetHandle() != dealer) {
+        UnseatPerson(p);
+        return;
+    }
+
+    POKER_LOG(LOG_INFO, "*** DEALER WAS KILLED - POKER GAME STOPPED ***");
+    StopGame();
+}
+
+void PokerTable::StopGame() {
+    CancelRequests();
+    dealer = ObjectHandle();
+    handActive = false;
+    state = TABLE_STOPPED;
+
+    // Clear all seats
+    for (int i = 0; i < MAX_SEATS; i++) {
+        if (!seats[i].isOccupied) continue;
+        StandUpSeat(i);
+        Person* occupant = GetOccupant(i);
+        if (occupant) occupant->StandUp();
+        seats[i].occupant = ObjectHandle();
+        seats[i].isOccupied = false;
+    }
+}
+
 int PokerTable::FindSeatIndex(Person* p) {
     if (!p) return -1;
 
     for (int i = 0; i < MAX_SEATS; i++) {
-        if (seats[i].occupant == p) {
+        if (seats[i].occupant == p->GetHandle()) {
             return i;
         }
     }
@@ -261,8 +344,9 @@ int PokerTable::FindSeatIndex(Person* p) {
 
 void PokerTable::MakePotItemsInteractable() {
     // Make all chips in pot stack interactable
-    if (potStack) {
-        potStack->MakeAllInteractable();
+    ChipStack* pot = DOM::Resolve<ChipStack>(potStack);
+    if (pot) {
+        pot->MakeAllInteractable();
     }
 
     // Make all community cards interactable
@@ -273,8 +357,53 @@ void PokerTable::MakePotItemsInteractable() {
     }
 }
 
+bool PokerTable::StartRecording(const std::string& basePath) {
+    if (!history.Open(basePath)) {
+        POKER_LOG(LOG_INFO, "Could not open hand history %s", basePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool PokerTable::LoadReplay(const HandView& hand) {
+    if (handActive || !hand.header) return false;
+
+    for (int i = 0; i < MAX_SEATS; i++) {
+        if ((hand.header->seatMask & (1u << i)) && !GetValidOccupant(i)) return false;
+    }
+
+    replayRecord = *hand.header;
+    replayActions.assign(hand.actions, hand.actions + hand.header->actionCount);
+    replayNext = 0;
+    replayResult = ReplayResult();
+    dealTimer = 0.0f;
+    return true;
+}
+
+void PokerTable::StandUpSeat(int seat) {
+    // Only mid-hand departures change the hand; the history needs them to replay it
+    if (handActive && engine.IsInHand(seat)) {
+        history.RecordStandUp(seat, engine.GetPhase());
+        statsHand.RecordStandUp(seat);
+    }
+    engine.StandUp(seat);
+}
+
 // ========== SEAT NAVIGATION ==========
 
+const ChipStack* PokerTable::GetPotStack() const {
+    return DOM::Resolve<ChipStack>(potStack);
+}
+
+Dealer* PokerTable::GetDealer() const {
+    return DOM::Resolve<Dealer>(dealer);
+}
+
+Person* PokerTable::GetOccupant(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= MAX_SEATS) return nullptr;
+    return DOM::Resolve<Person>(seats[seatIndex].occupant);
+}
+
 Person* PokerTable::GetValidOccupant(int seatIndex) {
     // Validate seat index
     if (seatIndex < 0 || seatIndex >= MAX_SEATS) {
@@ -286,10 +415,10 @@ Person* PokerTable::GetValidOccupant(int seatIndex) {
         return nullptr;
     }
 
-    // Safety check - verify occupant pointer is valid
-    Person* occupant = seats[seatIndex].occupant;
+    // Safety check - the occupant may have been destroyed without being unseated
+    Person* occupant = GetOccupant(seatIndex);
     if (!occupant) {
-        POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but has null occupant!", seatIndex);
+        POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but its occupant is gone!", seatIndex);
         seats[seatIndex].isOccupied = false;
         return nullptr;
     }
@@ -297,26 +426,6 @@ Person* PokerTable::GetValidOccupant(int seatIndex) {
     return occupant;
 }
 
-int PokerTable::NextOccupiedSeat(int index) {
-    for (int i = 1; i <= MAX_SEATS; i++) {
-        int next = (index + i) % MAX_SEATS;
-        if (seats[next].isOccupied) {
-            return next;
-        }
-    }
-    return -1;  // No occupied seats
-}
-
-int PokerTable::NextActiveSeat(int index) {
-    for (int i = 1; i <= MAX_SEATS; i++) {
-        int next = (index + i) % MAX_SEATS;
-        if (seats[next].isOccupied && statusList[next] != -1) {  // Not folded
-            return next;
-        }
-    }
-    return -1;  // Everyone folded
-}
-
 int PokerTable::GetOccupiedSeatCount() {
     int count = 0;
     for (int i = 0; i < MAX_SEATS; i++) {
@@ -334,301 +443,346 @@ int PokerTable::CountChips(Person* p) {
     return inv->GetTotalChipValue();
 }
 
+void PokerTable::TakeChips(Person* p, int amount) {
+    if (!p || amount <= 0) return;
 
+    Inventory* inv = p->GetInventory();
+    if (!inv) return;
 
-std::vector<Chip*> PokerTable::CalculateChipCombination(int amount) {
-    std::vector<Chip*> result;
-    // Standard poker chip denominations (must match Chip::GetColorFromValue())
-    // BLACK=100, GREEN=25, BLUE=10, RED=5, WHITE=1
-    int denominations[] = {100, 25, 10, 5, 1};
-
-    // Track chip breakdown for logging
-    std::map<int, int> chipCounts;
-
-    for (int denom : denominations) {
-        int count = 0;
-        while (amount >= denom) {
-            Chip* chip = new Chip(denom, {0, 0, 0}, nullptr);
-            result.push_back(chip);
-            amount -= denom;
-            count++;
-        }
-        if (count > 0) {
-            chipCounts[denom] = count;
-        }
-    }
+    // Pay from the denominations the person holds (all-in if short), breaking a chip for change
+    ChipLedger bankroll = inv->GetChipLedger();
+    if (amount > bankroll.Total()) amount = bankroll.Total();
 
-    // Log the chip breakdown
-    if (!chipCounts.empty()) {
-        std::string breakdown = "";
-        for (auto& pair : chipCounts) {
-            breakdown += std::to_string(pair.second) + "x" + std::to_string(pair.first) + " ";
-        }
-        // POKER_LOG(LOG_INFO, "Chip combination for %d: %s(total: %zu chips)",
-    //                   originalAmount, breakdown.c_str(), result.size());
-    }
+    ChipLedger paid;
+    bankroll.Withdraw(amount, paid);
+    SetChips(p, bankroll);
+    AddToPot(paid);
 
-    return result;
+    // POKER_LOG(LOG_INFO, "%s bets %d chips (pot now: %d)", p->GetName().c_str(), amount, engine.GetPot());
 }
 
-void PokerTable::TakeChips(Person* p, int amount) {
+void PokerTable::GiveChips(Person* p, int amount) {
     if (!p || amount <= 0) return;
 
     Inventory* inv = p->GetInventory();
     if (!inv) return;
-    int totalChips = CountChips(p);
 
-    if (amount > totalChips) amount = totalChips;  // All-in
+    ChipLedger bankroll = inv->GetChipLedger();
+    bankroll.Add(ChipLedger::FromAmount(amount));
+    SetChips(p, bankroll);
+
+    // POKER_LOG(LOG_INFO, "Gave %d chips to %s", amount, p->GetName().c_str());
+}
+
+void PokerTable::SetChips(Person* p, const ChipLedger& ledger) {
+    Inventory* inv = p->GetInventory();
+    if (!inv) return;
+
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        int value = ChipLedger::DENOMINATIONS[d];
+        int count = ledger.counts[d];
+        int index = inv->FindChipStack(value);
 
-    // Remove all chips from player
-    for (int i = inv->GetStackCount() - 1; i >= 0; i--) {
-        ItemStack* stack = inv->GetStack(i);
-        if (stack && stack->item && stack->item->GetType().find("chip") != std::string::npos) {
-            for (int j = 0; j < stack->count; j++) {
-                inv->RemoveItem(i);
+        if (index >= 0) {
+            ItemStack* stack = inv->GetStack(index);
+            if (count > 0) {
+                stack->count = count;
+            } else {
+                // Stack is gone - its chip object goes back to the pool
+                Chip* chip = static_cast<Chip*>(stack->item);
+                inv->SetStackCount(index, 0);
+                chipPool.Release(chip);
             }
+        } else if (count > 0) {
+            // New denomination (change or winnings) - one pooled chip represents the whole stack
+            inv->AddItem(chipPool.Acquire(value));
+            inv->SetStackCount(inv->FindChipStack(value), count);
         }
     }
+}
 
-    // Give back change
-    int remaining = totalChips - amount;
-    if (remaining > 0) {
-        GiveChips(p, remaining);
+void PokerTable::AddToPot(const ChipLedger& chips) {
+    ChipStack* pot = DOM::Resolve<ChipStack>(potStack);
+    if (!pot) return;
+
+    chipScratch.clear();
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        for (int n = 0; n < chips.counts[d]; n++) {
+            chipScratch.push_back(chipPool.Acquire(ChipLedger::DENOMINATIONS[d]));
+        }
     }
+    pot->AddChips(chipScratch);
+}
 
-    // Add bet to pot
-    std::vector<Chip*> betChips = CalculateChipCombination(amount);
-    potStack->AddChips(betChips);
-    potValue += amount;
+void PokerTable::ClearPot() {
+    ChipStack* pot = DOM::Resolve<ChipStack>(potStack);
+    if (!pot) return;
 
-    // POKER_LOG(LOG_INFO, "%s bets %d chips (pot now: %d)", p->GetName().c_str(), amount, potValue);
+    std::vector<Chip*> potChips = pot->RemoveAll();
+    for (Chip* chip : potChips) {
+        chipPool.Release(chip);  // Never in an inventory - safe to reuse
+    }
 }
 
-void PokerTable::GiveChips(Person* p, int amount) {
-    if (!p || amount <= 0) return;
+// ========== ENGINE SYNC ==========
 
-    std::vector<Chip*> chips = CalculateChipCombination(amount);
-    Inventory* inv = p->GetInventory();
-    if (!inv) {
-        // Clean up chips if we can't give them
-        for (Chip* chip : chips) {
-            delete chip;
+void PokerTable::SyncChips() {
+    // The engine tracks stacks as numbers; move the matching chips into the pot
+    for (int i = 0; i < MAX_SEATS; i++) {
+        int committed = engine.GetSeat(i).totalBet;
+        int delta = committed - chipsCommitted[i];
+        Person* occupant = seats[i].isOccupied ? GetOccupant(i) : nullptr;
+        if (delta > 0 && occupant) {
+            TakeChips(occupant, delta);
         }
-        return;
+        chipsCommitted[i] = committed;
     }
+}
 
-    for (Chip* chip : chips) {
-        inv->AddItem(chip);
-    }
+void PokerTable::SyncBoard() {
+    // Position cards in a row on the table
+    float cardSpacing = 0.65f;  // Spacing between cards
+    float startX = position.x - 1.0f;  // Start left of center
+    float cardY = position.y + size.y/2.0f + 0.02f;  // Flush on table surface
+    float cardZ = position.z + 0.5f;  // Offset to opposite side from deck/pot
 
-    // POKER_LOG(LOG_INFO, "Gave %d chips to %s", amount, p->GetName().c_str());
+    while ((int)communityCards.size() < engine.GetBoardCount()) {
+        int slot = communityCards.size();
+        Card* card = deck->GetCard(engine.GetBoardCard(slot));
+        if (!card) break;
+
+        card->position = {startX + (slot * cardSpacing), cardY, cardZ};
+        card->rotation = {-90, 0, 0};  // Lay flat on table, face up
+        card->canInteract = false;  // Disable interaction for community cards
+
+        // Add to DOM for rendering
+        DOM::GetGlobal()->AddObject(card);
+        communityCards.push_back(card);
+    }
 }
 
-// ========== BETTING HELPERS ==========
+// ========== BETTING ==========
 
-bool PokerTable::IsBettingRoundComplete() {
-    int activePlayers = 0;
-    int lastBet = -1;
+void PokerTable::Advance() {
+    if (advancing) return;  // Re-entered by an answer given inside RequestBet - the loop below carries on
+    advancing = true;
+    state = TABLE_ADVANCE;
 
-    for (int i = 0; i < MAX_SEATS; i++) {
-        if (seats[i].isOccupied && statusList[i] != -1) {  // Not folded
-            activePlayers++;
-            if (lastBet == -1) {
-                lastBet = statusList[i];
-            } else if (statusList[i] != lastBet) {
-                return false;  // Bets don't match
-            }
+    while (handActive && state == TABLE_ADVANCE) {
+        if (engine.IsBetting()) {
+            // Replays never ask anyone - no thinking delay, no randomness
+            if (IsReplaying()) ReplayNextAction();
+            else RequestBet();
+        } else if (engine.GetPhase() == PHASE_SHOWDOWN) {
+            if (!Showdown()) state = TABLE_AWAIT_SHOWDOWN;
+        } else {
+            // Everyone else folded
+            EndHand();
         }
     }
-
-    return activePlayers <= 1 || (lastBet >= 0);  // All bets match or only 1 player left
+    advancing = false;
 }
 
-void PokerTable::ProcessBetting(float dt) {
-    (void)dt;
-
-    if (currentPlayerSeat < 0 || currentPlayerSeat >= MAX_SEATS) {
-        bettingActive = false;
+void PokerTable::RequestBet() {
+    int seat = engine.GetCurrentSeat();
+    if (seat < 0 || seat >= MAX_SEATS) {
+        state = TABLE_AWAIT_BET;  // Nobody to ask - wait for the seating to change
         return;
     }
 
-    // Skip empty seats
-    if (!seats[currentPlayerSeat].isOccupied) {
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
+    Person* p = GetValidOccupant(seat);
+    if (!p) {
+        // Person was removed mid-hand without being unseated - fold them out
+        POKER_LOG(LOG_INFO, "Seat %d person was removed during betting!", seat);
+        StandUpSeat(seat);
+        SyncBoard();
         return;
     }
 
-    Person* p = seats[currentPlayerSeat].occupant;
-    if (!p) {
-        POKER_LOG(LOG_INFO, "Seat %d has null occupant!", currentPlayerSeat);
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
-        return;
+    BetRequest request;
+    request.currentBet = engine.GetCurrentBet();
+    request.callAmount = engine.GetCallAmount(seat);
+    request.minRaise = engine.GetMinRaise();
+    request.maxRaise = engine.GetMaxRaise(seat);
+
+    // If player can't raise, force them to only fold or call
+    bool canRaise = engine.CanRaise(seat);
+    if (!canRaise) {
+        request.minRaise = request.maxRaise + 1;  // Make raise impossible
     }
 
-    // Skip if folded
-    if (statusList[currentPlayerSeat] == -1) {
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
-        return;
+    std::string personName = p->GetName();
+    POKER_LOG(LOG_INFO, "%s to act: currentBet=%d, callAmount=%d, canRaise=%d",
+                      personName.c_str(), request.currentBet, request.callAmount, canRaise);
+
+    // Share what's visible on the table so the AI can weigh its cards
+    TableView view;
+    view.board = engine.GetBoard();
+    view.pot = engine.GetPot();
+    view.liveOpponents = engine.GetLiveCount() - 1;
+    view.bigBlind = engine.GetBigBlind();
+    view.streetRaises = engine.GetStreetRaises();
+    view.stats = statsHand.GetTracker();
+    for (uint32_t m = engine.GetLiveMask() & ~(1u << seat); m; m &= m - 1) {
+        view.opponentIds[view.opponentIdCount++] = playerIds[__builtin_ctz(m)];
+    }
+    p->SetTableView(view);
+
+    // Nothing happens until the answer comes back (possibly right away, inside this call)
+    awaitSeat = seat;
+    state = TABLE_AWAIT_BET;
+    uint32_t id = ++requestId;
+    p->RequestBet(request, [this, id](int action, int raiseAmount) {
+        OnBetDecided(id, action, raiseAmount);
+    });
+}
+
+void PokerTable::OnBetDecided(uint32_t id, int action, int raiseAmount) {
+    if (id != requestId || state != TABLE_AWAIT_BET || awaitSeat < 0) return;  // Stale answer
+
+    int seat = awaitSeat;
+    awaitSeat = -1;
+    Person* occupant = GetOccupant(seat);
+    std::string personName = occupant ? occupant->GetName() : "";
+
+    PokerActionType type = ACTION_FOLD;
+    if (action == 1) {
+        POKER_LOG(LOG_INFO, "%s calls %d", personName.c_str(), engine.GetCallAmount(seat));
+        type = ACTION_CALL;
+    } else if (action == 2) {
+        POKER_LOG(LOG_INFO, "%s raises to %d", personName.c_str(), raiseAmount);
+        type = ACTION_RAISE;
+    } else {
+        POKER_LOG(LOG_INFO, "%s folds", personName.c_str());
     }
 
-    // Re-check seat is still occupied (person might have been killed/removed mid-frame)
-    if (!seats[currentPlayerSeat].isOccupied || seats[currentPlayerSeat].occupant != p) {
-        POKER_LOG(LOG_INFO, "Seat %d person was removed during betting!", currentPlayerSeat);
-        statusList[currentPlayerSeat] = -1;  // Mark as folded
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
-        return;
+    // Record what the engine actually did - a raise it doesn't allow is played (and counted) as a call
+    HandPhase phase = engine.GetPhase();
+    if (engine.ApplyAction(PokerAction(type, raiseAmount))) {
+        PokerAction applied(engine.GetLastAction(), raiseAmount);
+        history.RecordAction(seat, phase, applied);
+        statsHand.RecordAction(seat, phase, applied.type);
     }
 
-    // Calculate call amount
-    int callAmount = currentBet - statusList[currentPlayerSeat];
-    int chips = CountChips(p);
-    int minRaise = currentBet + BIG_BLIND_AMOUNT;
-    int maxRaise = statusList[currentPlayerSeat] + chips;
-    int raiseAmount = 0;
-
-    // Check if player has already raised this round
-    bool canRaise = !hasRaised[currentPlayerSeat];
-
-    // Only log when we first move to this player (prevent spamming while they think)
-    if (lastLoggedPlayerSeat != currentPlayerSeat) {
-        std::string personName = p->GetName();
-        POKER_LOG(LOG_INFO, "%s to act: currentBet=%d, statusList[%d]=%d, callAmount=%d, canRaise=%d",
-                          personName.c_str(), currentBet, currentPlayerSeat, statusList[currentPlayerSeat], callAmount, canRaise);
-        lastLoggedPlayerSeat = currentPlayerSeat;
+    SyncChips();
+    SyncBoard();
+
+    state = TABLE_ADVANCE;
+    Advance();
+}
+
+void PokerTable::OnShowdownReady(uint32_t id) {
+    if (id != requestId || state != TABLE_AWAIT_SHOWDOWN) return;
+    Advance();
+}
+
+void PokerTable::CancelRequests() {
+    if (awaitSeat >= 0) {
+        Person* p = GetValidOccupant(awaitSeat);
+        if (p) p->CancelBet();
     }
+    awaitSeat = -1;
+    requestId++;  // Anything still in flight is now stale
 
-    // If player can't raise, force them to only fold or call
-    if (!canRaise) {
-        minRaise = maxRaise + 1;  // Make raise impossible
+    // A showdown waiting on card picks asks again (if it's still on) once the hand advances
+    if (state == TABLE_AWAIT_SHOWDOWN) {
+        for (int i = 0; i < MAX_SEATS; i++) CancelCardSelection(i);
     }
+}
 
-    // Re-verify person pointer is still valid before calling PromptBet
-    if (!seats[currentPlayerSeat].isOccupied || seats[currentPlayerSeat].occupant != p) {
-        POKER_LOG(LOG_INFO, "ERROR: Person became invalid before PromptBet!");
-        statusList[currentPlayerSeat] = -1;
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
+void PokerTable::CancelCardSelection(int seat) {
+    Person* occupant = GetOccupant(seat);
+    Player* player = occupant ? occupant->As<Player>() : nullptr;
+    if (player) player->CancelCardSelection();
+}
+
+void PokerTable::ReplayNextAction() {
+    if (replayNext >= (int)replayActions.size()) {
+        // Record ran out while the engine still wants decisions
+        replayResult.failedAction = replayNext;
         return;
     }
 
-    std::string personName = p->GetName();
-    POKER_LOG(LOG_INFO, "About to call PromptBet on %s (ptr=%p)", personName.c_str(), (void*)p);
-    int action = p->PromptBet(currentBet, callAmount, minRaise, maxRaise, raiseAmount);
-    POKER_LOG(LOG_INFO, "PromptBet returned %d", action);
+    // Departures go through StandUpSeat() so a recording of the replay sees them too
+    const HandActionRecord& action = replayActions[replayNext];
+    bool applied = true;
+    if (action.type == HAND_ACTION_STAND_UP && action.seat < MAX_SEATS) {
+        StandUpSeat(action.seat);
+    } else {
+        applied = HandReplay::ApplyAction(engine, action);
+    }
+    if (!applied) {
+        POKER_LOG(LOG_INFO, "Replay diverged at action %d (seat %d)", replayNext, action.seat);
+        replayResult.failedAction = replayNext;
+        return;
+    }
+    replayNext++;
 
-    if (action == -1) return;  // Still thinking
+    SyncChips();
+    SyncBoard();
+}
 
-    // Process action
-    if (action == 0) {
-        // Fold
-        POKER_LOG(LOG_INFO, "%s folds", personName.c_str());
-        statusList[currentPlayerSeat] = -1;
-    } else if (action == 1) {
-        // Call
-        POKER_LOG(LOG_INFO, "%s calls %d", personName.c_str(), callAmount);
-        TakeChips(p, callAmount);
-        statusList[currentPlayerSeat] += callAmount;
-    } else if (action == 2) {
-        // Raise (only if they haven't raised yet)
-        if (canRaise) {
-            int totalBet = raiseAmount - statusList[currentPlayerSeat];
-            TakeChips(p, totalBet);
-            statusList[currentPlayerSeat] = raiseAmount;
-            currentBet = raiseAmount;
-            hasRaised[currentPlayerSeat] = true;  // Mark that they've raised
-            // POKER_LOG(LOG_INFO, "%s raises to %d", p->GetName().c_str(), raiseAmount);
-        } else {
-            // Shouldn't happen, but if it does, treat as call
-            // POKER_LOG(LOG_INFO, "%s tried to raise but already raised, calling instead", p->GetName().c_str());
-            TakeChips(p, callAmount);
-            statusList[currentPlayerSeat] += callAmount;
-        }
-    }
+// ========== GAME FLOW ==========
 
-    // Check if betting round is complete
-    if (IsBettingRoundComplete()) {
-        // POKER_LOG(LOG_INFO, "Betting round complete! communityCards.size()=%zu", communityCards.size());
-        bettingActive = false;
-        lastLoggedPlayerSeat = -1;  // Reset for next betting round
+bool PokerTable::StartHand() {
+    if (GetOccupiedSeatCount() < 2) return false;
 
-        // Count active players
-        int activePlayers = 0;
+    // Replays put the recorded stacks into the inventories first (seats not in the record sit out)
+    if (replayNext >= 0) {
         for (int i = 0; i < MAX_SEATS; i++) {
-            if (seats[i].isOccupied && statusList[i] != -1) activePlayers++;
+            Person* occupant = GetValidOccupant(i);
+            if (occupant && (replayRecord.seatMask & (1u << i))) {
+                SetChips(occupant, ChipLedger::FromAmount(replayRecord.startStacks[i]));
+            }
         }
+    }
 
-        // POKER_LOG(LOG_INFO, "Active players: %d", activePlayers);
-
-        if (activePlayers <= 1) {
-            // Everyone folded, end hand
-            EndHand();
-        } else {
-            // Progress to next street
-            if (communityCards.size() == 0) {
-                // POKER_LOG(LOG_INFO, "About to deal flop...");
-                DealFlop();
-            } else if (communityCards.size() == 3) {
-                // POKER_LOG(LOG_INFO, "About to deal turn...");
-                DealTurn();
-            } else if (communityCards.size() == 4) {
-                // POKER_LOG(LOG_INFO, "About to deal river...");
-                DealRiver();
-            } else {
-                // Showdown - call once, then showdownActive will keep it running
-                showdownActive = true;
-                Showdown();
-            }
+    // Stacks come from inventories - chips may have been picked up or dropped between hands
+    for (int i = 0; i < MAX_SEATS; i++) {
+        Person* occupant = GetValidOccupant(i);
+        if (occupant) {
+            if (!engine.GetSeat(i).occupied) engine.SitDown(i, 0);  // Left a replayed hand but still seated
+            bool sitsOut = replayNext >= 0 && !(replayRecord.seatMask & (1u << i));
+            engine.SetStack(i, sitsOut ? 0 : CountChips(occupant));
         }
-    } else {
-        currentPlayerSeat = NextActiveSeat(currentPlayerSeat);
-        // Don't reset lastLoggedPlayerSeat here - it will be updated on next ProcessBetting call
+        chipsCommitted[i] = 0;
+    }
+    if (replayNext >= 0) {
+        HandReplay::Prepare(engine, replayRecord);
+        blindsPending = true;  // Back to this table's own blinds afterwards
+    } else if (blindsPending) {
+        engine.SetBlindStructure(blinds);
+        blindsPending = false;
     }
-}
 
-// ========== GAME FLOW ==========
+    // Needs two players with chips
+    if (!engine.StartHand()) return false;
 
-void PokerTable::StartHand() {
-    if (GetOccupiedSeatCount() < 2) return;
+    if (replayNext >= 0 && (engine.GetHandSeed() != replayRecord.deckSeed ||
+                            engine.GetSmallBlindSeat() != replayRecord.smallBlindSeat)) {
+        POKER_LOG(LOG_INFO, "Replay could not restore the recorded deal");
+        replayResult.failedAction = 0;
+    }
 
     POKER_LOG(LOG_INFO, "StartHand: Beginning new hand");
+    history.BeginHand(engine, playerIds.data());
+    if (replayNext < 0) statsHand.BeginHand(engine, playerIds.data());
 
     handActive = true;
-    potValue = 0;
-    currentBet = 0;
 
     // Community cards should already be cleared by EndHand()
     // Don't clear here - EndHand() needs to remove them from DOM first
 
     // Clear pot
-    std::vector<Chip*> oldChips = potStack->RemoveAll();
-    for (Chip* chip : oldChips) {
-        delete chip;  // Delete the chips from previous hand
-    }
+    ClearPot();
 
-    // Reset status list for all seats
-    for (int i = 0; i < MAX_SEATS; i++) {
-        statusList[i] = 0;
-    }
-
-    // Reset deck
-    POKER_LOG(LOG_INFO, "StartHand: Resetting deck");
-    deck->Reset();
-    deck->Shuffle();
-
-    // Deal hole cards
-    POKER_LOG(LOG_INFO, "StartHand: About to deal hole cards");
+    // Hand out the cards the engine dealt, then move the blinds into the pot
     DealHoleCards();
-    POKER_LOG(LOG_INFO, "StartHand: Hole cards dealt");
-
-    // Post blinds (this sets smallBlindSeat and bigBlindSeat)
-    POKER_LOG(LOG_INFO, "StartHand: About to post blinds");
-    PostBlinds();
-    POKER_LOG(LOG_INFO, "StartHand: Blinds posted");
-
-    // Start betting (left of big blind) - don't reset bets, blinds are already posted
-    currentPlayerSeat = NextOccupiedSeat(bigBlindSeat);
-    bettingActive = true;
+    SyncChips();
+    SyncBoard();  // Blinds can put everyone all-in and run out the board
 
     POKER_LOG(LOG_INFO, "=== Hand started ===");
+    return true;
 }
 
 void PokerTable::DealHoleCards() {
@@ -639,296 +793,157 @@ void PokerTable::DealHoleCards() {
         dealtHoleCards[i].clear();
     }
 
-    for (int round = 0; round < 2; round++) {
-        POKER_LOG(LOG_INFO, "DealHoleCards: Round %d", round);
-        for (int i = 0; i < MAX_SEATS; i++) {
-            if (!seats[i].isOccupied) continue;  // Skip empty seats
-
-            POKER_LOG(LOG_INFO, "DealHoleCards: Checking seat %d (occupied)", i);
-
-            // Safety check - verify occupant pointer is valid
-            if (!seats[i].occupant) {
-                POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but has null occupant!", i);
-                seats[i].isOccupied = false;
-                continue;
-            }
-
-            POKER_LOG(LOG_INFO, "DealHoleCards: Seat %d occupant ptr=%p, about to get type", i, (void*)seats[i].occupant);
-
-            // Verify object is valid by checking type first
-            std::string personType = seats[i].occupant->GetType();
-            if (personType.empty()) {
-                POKER_LOG(LOG_INFO, "ERROR: Seat %d occupant has null/empty type!", i);
-                seats[i].isOccupied = false;
-                continue;
-            }
-            POKER_LOG(LOG_INFO, "DealHoleCards: Seat %d occupant type=%s", i, personType.c_str());
+    for (int i = 0; i < MAX_SEATS; i++) {
+        const EngineSeat& engineSeat = engine.GetSeat(i);
+        if (!engineSeat.inHand) continue;
 
-            POKER_LOG(LOG_INFO, "DealHoleCards: About to get name");
-            // Get name safely - store as string and use it immediately
-            std::string playerName = seats[i].occupant->GetName();
-            POKER_LOG(LOG_INFO, "DealHoleCards: Dealing to %s at seat %d", playerName.c_str(), i);
+        Person* occupant = GetValidOccupant(i);
+        if (!occupant) continue;
 
-            POKER_LOG(LOG_INFO, "DealHoleCards: About to draw card from deck");
-            Card* card = deck->DrawCard();
-            POKER_LOG(LOG_INFO, "DealHoleCards: Drew card %p", (void*)card);
+        Inventory* inv = occupant->GetInventory();
+        if (!inv) {
+            POKER_LOG(LOG_INFO, "ERROR: Seat %d occupant has null inventory!", i);
+            continue;
+        }
 
+        for (int k = 0; k < HOLE_CARDS; k++) {
+            Card* card = deck->GetCard(engineSeat.holeCards[k]);
             if (!card) {
-                POKER_LOG(LOG_INFO, "DealHoleCards: No card available from deck");
+                POKER_LOG(LOG_INFO, "DealHoleCards: No card for index %d", engineSeat.holeCards[k]);
                 continue;
             }
 
-            POKER_LOG(LOG_INFO, "DealHoleCards: Setting card properties");
             card->canInteract = false;  // Disable interaction for hole cards
 
-            POKER_LOG(LOG_INFO, "DealHoleCards: Tracking card for seat %d", i);
             // Track this card as dealt this hand
             dealtHoleCards[i].push_back(card);
-
-            POKER_LOG(LOG_INFO, "DealHoleCards: Getting inventory");
-            // Get inventory with safety checks
-            Person* occupant = seats[i].occupant;
-            if (!occupant) {
-                POKER_LOG(LOG_INFO, "ERROR: Occupant became null during card dealing!");
-                continue;
-            }
-
-            Inventory* inv = occupant->GetInventory();
-            if (!inv) {
-                POKER_LOG(LOG_INFO, "ERROR: Seat %d occupant has null inventory!", i);
-                continue;
-            }
-
-            POKER_LOG(LOG_INFO, "DealHoleCards: Adding card to inventory");
-            // Add card to inventory
             inv->AddItem(card);
-            POKER_LOG(LOG_INFO, "DealHoleCards: Card added successfully");
         }
     }
     POKER_LOG(LOG_INFO, "DealHoleCards: Finished dealing all cards");
 }
 
-void PokerTable::PostBlinds() {
-    // If this is first hand, start from seat 0, otherwise rotate from previous small blind
-    if (smallBlindSeat == -1) {
-        smallBlindSeat = NextOccupiedSeat(-1);  // Will find first occupied seat
-    } else {
-        smallBlindSeat = NextOccupiedSeat(smallBlindSeat);  // Rotate to next
-    }
-    bigBlindSeat = NextOccupiedSeat(smallBlindSeat);
-
-    // POKER_LOG(LOG_INFO, "PostBlinds: smallBlindSeat=%d, bigBlindSeat=%d", smallBlindSeat, bigBlindSeat);
-
-    // Small blind
-    TakeChips(seats[smallBlindSeat].occupant, SMALL_BLIND_AMOUNT);
-    statusList[smallBlindSeat] = SMALL_BLIND_AMOUNT;
-
-    // Big blind
-    TakeChips(seats[bigBlindSeat].occupant, BIG_BLIND_AMOUNT);
-    statusList[bigBlindSeat] = BIG_BLIND_AMOUNT;
-    currentBet = BIG_BLIND_AMOUNT;
-
-    // POKER_LOG(LOG_INFO, "Blinds posted: seat %d (SB=%d), seat %d (BB=%d)", smallBlindSeat, SMALL_BLIND_AMOUNT, bigBlindSeat, BIG_BLIND_AMOUNT);
-    // POKER_LOG(LOG_INFO, "After PostBlinds - statusList: [0]=%d [1]=%d [2]=%d [3]=%d [4]=%d [5]=%d [6]=%d [7]=%d",
-    //           statusList[0], statusList[1], statusList[2], statusList[3],
-    //           statusList[4], statusList[5], statusList[6], statusList[7]);
-}
-
-void PokerTable::StartBettingRound(int startPlayer) {
-    // Reset round bets (but keep people folded as folded)
-    for (int i = 0; i < MAX_SEATS; i++) {
-        if (statusList[i] != -1) {
-            statusList[i] = 0;
+bool PokerTable::Showdown() {
+    // Replays show down with the recorded hands (after any recorded departures)
+    if (IsReplaying()) {
+        while (replayNext < (int)replayActions.size() && IsReplaying()) {
+            ReplayNextAction();
         }
-        hasRaised[i] = false;  // Reset raise tracking for new betting round
-    }
-    currentBet = 0;
-    currentPlayerSeat = startPlayer;
-    bettingActive = true;
-    lastLoggedPlayerSeat = -1;  // Reset logging state for new betting round
-}
-
-void PokerTable::DealFlop() {
-    // Position cards in a row on the table
-    float cardSpacing = 0.65f;  // Spacing between cards
-    float startX = position.x - 1.0f;  // Start left of center
-    float cardY = position.y + size.y/2.0f + 0.02f;  // Flush on table surface
-    float cardZ = position.z + 0.5f;  // Offset to opposite side from deck/pot
-
-    // POKER_LOG(LOG_INFO, "Dealing flop - cardY=%.2f, cardZ=%.2f", cardY, cardZ);
-
-    for (int i = 0; i < 3; i++) {
-        Card* card = deck->DrawCard();
-        if (!card) {
-            // POKER_LOG(LOG_INFO, "Failed to draw card %d for flop", i);
-            continue;
+        if (IsReplaying()) {
+            HandReplay::ApplyShownHands(engine, replayRecord);
+            engine.ResolveShowdown();
+            EndHand();
+            return true;
         }
-
-        card->position = {startX + (i * cardSpacing), cardY, cardZ};
-        card->rotation = {-90, 0, 0};  // Lay flat on table, face up
-        card->canInteract = false;  // Disable interaction for community cards
-
-        // Add to DOM for rendering
-        DOM::GetGlobal()->AddObject(card);
-        communityCards.push_back(card);
-
-        // POKER_LOG(LOG_INFO, "Flop card %d: %s at (%.2f, %.2f, %.2f)",
-    //                   i, card->GetType(), card->position.x, card->position.y, card->position.z);
     }
 
-    // POKER_LOG(LOG_INFO, "Dealt flop - %zu community cards total", communityCards.size());
-    StartBettingRound(NextOccupiedSeat(smallBlindSeat));  // Start from first seat after rotation
-}
-
-void PokerTable::DealTurn() {
-    Card* card = deck->DrawCard();
-    if (!card) return;
-
-    // Continue the line of community cards (4th card)
-    float cardSpacing = 0.65f;
-    float startX = position.x - 1.0f;
-    float cardY = position.y + size.y/2.0f + 0.02f;  // Flush on table surface
-    float cardZ = position.z + 0.5f;  // Offset to opposite side from deck/pot
-
-    card->position = {startX + (3 * cardSpacing), cardY, cardZ};
-    card->rotation = {-90, 0, 0};  // Lay flat on table, face up
-    card->canInteract = false;  // Disable interaction for community cards
-
-    // Add to DOM for rendering
-    DOM::GetGlobal()->AddObject(card);
-    communityCards.push_back(card);
-
-    // POKER_LOG(LOG_INFO, "Dealt turn");
-    StartBettingRound(NextOccupiedSeat(smallBlindSeat));  // Start from first seat after rotation
-}
-
-void PokerTable::DealRiver() {
-    Card* card = deck->DrawCard();
-    if (!card) return;
-
-    // Continue the line of community cards (5th card)
-    float cardSpacing = 0.65f;
-    float startX = position.x - 1.0f;
-    float cardY = position.y + size.y/2.0f + 0.02f;  // Flush on table surface
-    float cardZ = position.z + 0.5f;  // Offset to opposite side from deck/pot
-
-    card->position = {startX + (4 * cardSpacing), cardY, cardZ};
-    card->rotation = {-90, 0, 0};  // Lay flat on table, face up
-    card->canInteract = false;  // Disable interaction for community cards
-
-    // Add to DOM for rendering
-    DOM::GetGlobal()->AddObject(card);
-    communityCards.push_back(card);
-
-
-    StartBettingRound(NextOccupiedSeat(smallBlindSeat));  // Start from first seat after rotation
-}
-
-void PokerTable::Showdown() {
-
     // First, check if any players have 3+ cards and need to select
+    // (runs on entering showdown and again once the pick is confirmed - never per frame)
+    bool waiting = false;
     for (int i = 0; i < MAX_SEATS; i++) {
-        if (!seats[i].isOccupied || statusList[i] == -1) continue;
-        if (!seats[i].occupant) continue;
+        if (!seats[i].isOccupied || !engine.IsInHand(i)) continue;
+        Person* occupant = GetOccupant(i);
+        if (!occupant) continue;
 
         // Check if this is a player (not Enemy/Dealer) and count cards
-        if (seats[i].occupant->GetType() == "player") {
-            Player* player = static_cast<Player*>(seats[i].occupant);
+        if (Player* player = occupant->As<Player>()) {
             Inventory* inv = player->GetInventory();
             if (!inv) continue;
 
             // Count cards in inventory
-            int cardCount = inv->CountItemsByType("card");
+            int cardCount = inv->CountItemsByType(TYPE_CARD);
 
             // If player has 3+ cards, show selection UI
             if (cardCount >= 3) {
                 // Activate card selection UI if not already active
                 if (!player->cardSelectionUIActive && player->selectedCardIndices.empty()) {
-                    player->cardSelectionUIActive = true;
-                    showdownActive = true;  // Keep calling Showdown() until selection is done
+                    // The selection hint scores against the final board
+                    TableView view = player->GetTableView();
+                    view.board = engine.GetBoard();
+                    player->SetTableView(view);
+
+                    uint32_t id = ++requestId;
+                    player->RequestCardSelection([this, id] { OnShowdownReady(id); });
                     POKER_LOG(LOG_INFO, "Player has %d cards - activating card selection UI", cardCount);
                 }
 
                 // Wait for player to complete selection
                 if (player->cardSelectionUIActive) {
-                    return;  // Don't proceed with showdown yet, will be called again next frame
+                    waiting = true;
                 }
             }
         }
     }
+    if (waiting) return false;  // OnShowdownReady() picks the hand up again
 
     // All players have made their selections (or don't need to)
-    showdownActive = false;
-
-    // All players have made their selections (or don't need to), now evaluate
-    int winnerIndex = -1;
-    HandEvaluation bestHand = {HIGH_CARD, {}};
 
+    // Everyone shows down with two of the cards they actually hold, which is how extra cards get into play
     for (int i = 0; i < MAX_SEATS; i++) {
-        if (!seats[i].isOccupied || statusList[i] == -1) continue;  // Skip empty or folded
+        if (!engine.IsInHand(i)) continue;
 
-        // Safety check - verify occupant pointer is valid
-        if (!seats[i].occupant) {
-            POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but has null occupant in Showdown!", i);
-            seats[i].isOccupied = false;
+        Person* occupant = GetValidOccupant(i);
+        if (!occupant) {
+            StandUpSeat(i);
             continue;
         }
-
-        HandEvaluation hand = EvaluateHand(seats[i].occupant);
-
-        if (winnerIndex == -1 || CompareHands(hand, bestHand) > 0) {
-            bestHand = hand;
-            winnerIndex = i;
-        }
-    }
-
-    if (winnerIndex != -1 && seats[winnerIndex].occupant) {
-        std::string winnerName = seats[winnerIndex].occupant->GetName();
-        TraceLog(LOG_INFO, "%s wins!", winnerName.c_str());
-        GiveChips(seats[winnerIndex].occupant, potValue);
+        engine.SetHand(i, GetShowdownHand(occupant));
     }
 
+    engine.ResolveShowdown();
     EndHand();
+    return true;
 }
 
 void PokerTable::EndHand() {
+    history.EndHand(engine);
+    if (replayNext < 0) statsHand.EndHand(engine);
 
-    // If only one player left (everyone else folded), award pot
-    if (bettingActive) {
-        for (int i = 0; i < MAX_SEATS; i++) {
-            if (seats[i].isOccupied && statusList[i] != -1) {
-                // Safety check - verify occupant pointer is valid
-                if (!seats[i].occupant) {
-                    POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but has null occupant when awarding pot!", i);
-                    seats[i].isOccupied = false;
-                    continue;
-                }
-                TraceLog(LOG_INFO, "%s wins (others folded)", seats[i].occupant->GetName().c_str());
-                GiveChips(seats[i].occupant, potValue);
-                break;
-            }
+    if (replayNext >= 0) {
+        HandReplay::Check(engine, replayRecord, replayResult);
+        replayNext = -1;
+    }
+
+    // Pot chips go back to the pool first so the payout below can reuse them
+    ClearPot();
+
+    // Pay out what the engine awarded (showdown winners, or the last player standing)
+    for (int i = 0; i < MAX_SEATS; i++) {
+        int won = engine.GetWinnings(i);
+        if (won <= 0) continue;
+
+        Person* occupant = GetValidOccupant(i);
+        if (!occupant) continue;
+
+        HandStrength strength = engine.GetSeat(i).strength;
+        if (strength != 0) {
+            TraceLog(LOG_INFO, "%s wins %d with %s!", occupant->GetName().c_str(), won,
+                     HandEvaluator::GetRankName(HandEvaluator::GetRank(strength)));
+        } else {
+            TraceLog(LOG_INFO, "%s wins %d (others folded)", occupant->GetName().c_str(), won);
         }
+        GiveChips(occupant, won);
     }
 
     // Clear hole cards from all players' inventories and reset card selection
     for (int i = 0; i < MAX_SEATS; i++) {
         if (!seats[i].isOccupied) continue;
 
-        // Safety check - verify occupant pointer is valid
-        if (!seats[i].occupant) {
-            POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but has null occupant in EndHand!", i);
+        // Safety check - the occupant may have been destroyed without being unseated
+        Person* occupant = GetOccupant(i);
+        if (!occupant) {
+            POKER_LOG(LOG_INFO, "ERROR: Seat %d marked occupied but its occupant is gone in EndHand!", i);
             seats[i].isOccupied = false;
             continue;
         }
 
         // Reset card selection for players
-        if (seats[i].occupant->GetType() == "player") {
-            Player* player = static_cast<Player*>(seats[i].occupant);
+        if (Player* player = occupant->As<Player>()) {
             player->cardSelectionUIActive = false;
             player->selectedCardIndices.clear();
         }
 
-        Inventory* inv = seats[i].occupant->GetInventory();
+        Inventory* inv = occupant->GetInventory();
         if (!inv) {
             POKER_LOG(LOG_INFO, "ERROR: Seat %d occupant has null inventory in EndHand!", i);
             continue;
@@ -961,133 +976,43 @@ void PokerTable::EndHand() {
     }
     communityCards.clear();
 
-    // Clear pot chips
-    std::vector<Chip*> potChips = potStack->RemoveAll();
-    for (Chip* chip : potChips) {
-        delete chip;  // Just delete - they were never in DOM (managed by ChipStack)
-    }
 
-    // Blinds will rotate on next hand (handled in PostBlinds)
+    // Blinds will rotate on next hand (handled by the engine)
 
     handActive = false;
-    bettingActive = false;
-
-
+    awaitSeat = -1;
+    state = TABLE_IDLE;
+    dealTimer = 0.0f;  // Deal the next hand on the next Update()
 }
 
 // ========== HAND EVALUATION ==========
 
-HandEvaluation PokerTable::EvaluateHand(Person* p) {
-    // Get player's hole cards
-    std::vector<Card*> allCards;
-
+CardMask PokerTable::GetShowdownHand(Person* p) {
     if (!p) {
-        return {HIGH_CARD, {}};
+        return CardMask();
     }
 
     Inventory* inv = p->GetInventory();
     if (!inv) {
-        return {HIGH_CARD, {}};
+        return CardMask();
     }
 
     // Check if this is a Player (human) who might have selected specific cards
-    if (p->GetType() == "player") {
+    if (p->IsA<Player>()) {
         Player* player = static_cast<Player*>(p);
         std::vector<Card*> selectedCards = player->GetSelectedCards();
 
         // Use selected cards if available (should be exactly 2 for cheating)
         if (selectedCards.size() == 2) {
             POKER_LOG(LOG_INFO, "Using player's selected cards for evaluation (cheating)");
-            allCards = selectedCards;
-        } else {
-            // Fallback to all cards in inventory
-            for (int i = 0; i < inv->GetStackCount(); i++) {
-                ItemStack* stack = inv->GetStack(i);
-                if (stack && stack->item && stack->item->GetType().find("card") != std::string::npos) {
-                    Card* card = static_cast<Card*>(stack->item);
-                    allCards.push_back(card);
-                }
-            }
-        }
-    } else {
-        // For non-players (Enemy, Dealer), use all cards in inventory
-        for (int i = 0; i < inv->GetStackCount(); i++) {
-            ItemStack* stack = inv->GetStack(i);
-            if (stack && stack->item && stack->item->GetType().find("card") != std::string::npos) {
-                Card* card = static_cast<Card*>(stack->item);
-                allCards.push_back(card);
-            }
-        }
-    }
-
-    // Add community cards
-    for (Card* card : communityCards) {
-        allCards.push_back(card);
-    }
-
-    // For now, simple evaluation (just count rank frequencies)
-    // TODO: Implement full poker hand evaluation
-
-    std::map<Rank, int> rankCounts;
-    std::map<Suit, int> suitCounts;
-
-    for (Card* card : allCards) {
-        rankCounts[card->rank]++;
-        suitCounts[card->suit]++;
-    }
-
-    // Check for flush
-    bool hasFlush = false;
-    for (auto& pair : suitCounts) {
-        if (pair.second >= 5) hasFlush = true;
-    }
-
-    // Check for pairs, trips, quads
-    int pairs = 0;
-    int trips = 0;
-    int quads = 0;
-    Rank highestPairRank = RANK_TWO;
-
-    for (auto& pair : rankCounts) {
-        if (pair.second == 4) quads++;
-        if (pair.second == 3) trips++;
-        if (pair.second == 2) {
-            pairs++;
-            if (pair.first > highestPairRank) highestPairRank = pair.first;
+            return Card::ToMask(selectedCards);
         }
     }
 
-    HandEvaluation result;
-
-    if (quads > 0) {
-        result.rank = FOUR_OF_KIND;
-    } else if (trips > 0 && pairs > 0) {
-        result.rank = FULL_HOUSE;
-    } else if (hasFlush) {
-        result.rank = FLUSH;
-    } else if (trips > 0) {
-        result.rank = THREE_OF_KIND;
-    } else if (pairs >= 2) {
-        result.rank = TWO_PAIR;
-    } else if (pairs == 1) {
-        result.rank = PAIR;
-        result.rankValues.push_back(highestPairRank);
-    } else {
-        result.rank = HIGH_CARD;
-    }
-
-    return result;
-}
-
-int PokerTable::CompareHands(const HandEvaluation& h1, const HandEvaluation& h2) {
-    if (h1.rank > h2.rank) return 1;
-    if (h1.rank < h2.rank) return -1;
-
-    // Same rank, compare kickers
-    for (size_t i = 0; i < h1.rankValues.size() && i < h2.rankValues.size(); i++) {
-        if (h1.rankValues[i] > h2.rankValues[i]) return 1;
-        if (h1.rankValues[i] < h2.rankValues[i]) return -1;
+    // Otherwise (Enemy, Dealer, or no selection) show the best two cards held against the board
+    CardMask held = inv->GetCardMask();
+    if (held.Count() <= HOLE_CARDS) {
+        return held;
     }
-
-    return 0;  // Tie
+    return HandOptimizer::BestTwo(held, engine.GetBoard()).GetMask();
 }
@@ -6,24 +6,33 @@
 #include "items/card.hpp"
 #include "items/chip.hpp"
 #include "items/chip_stack.hpp"
+#include "items/chip_pool.hpp"
+#include "gameplay/chip_ledger.hpp"
 #include "entities/person.hpp"
 #include "core/physics.hpp"
+#include "gameplay/poker_engine.hpp"
+#include "gameplay/hand_history.hpp"
+#include "gameplay/hand_replay.hpp"
+#include "gameplay/opponent_stats.hpp"
 #include <ode/ode.h>
 #include <array>
+#include <cmath>
 #include <vector>
 #include "core/collider.hpp"
 
-#define MAX_SEATS 8
-
-#define SMALL_BLIND_AMOUNT 5
-#define BIG_BLIND_AMOUNT 10
-
 // Game logging control - bypasses raylib's SetTraceLogLevel
 #define GAME_LOG_ENABLED false
 #define GAME_LOG(level, ...) do { if (GAME_LOG_ENABLED) { printf("[GAME] "); printf(__VA_ARGS__); printf("\n"); } } while(0)
 // Legacy alias for poker table code
 #define POKER_LOG GAME_LOG
 
+// Hand history recording (binary records for analysis and replay, see HandHistoryRecorder)
+#define HAND_HISTORY_ENABLED false
+#define HAND_HISTORY_BASE_PATH "hand_history"   // Each table records to <base>_t<tableId>
+
+// Seconds between deal attempts when a hand couldn't start (e.g. only one seat has chips)
+#define TABLE_DEAL_RETRY_SECONDS 1.0f
+
 // Collision categories
 #ifndef COLLISION_CATEGORY_PLAYER
 #define COLLISION_CATEGORY_PLAYER   (1 << 0)
@@ -33,31 +42,26 @@
 // Forward declarations
 class Dealer;
 
-// Hand rankings
-enum HandRank {
-    HIGH_CARD = 0,
-    PAIR = 1,
-    TWO_PAIR = 2,
-    THREE_OF_KIND = 3,
-    STRAIGHT = 4,
-    FLUSH = 5,
-    FULL_HOUSE = 6,
-    FOUR_OF_KIND = 7,
-    STRAIGHT_FLUSH = 8,
-    ROYAL_FLUSH = 9
-};
-
-struct HandEvaluation {
-    HandRank rank;
-    std::vector<int> rankValues;  // For tie-breaking (e.g., pair of Aces > pair of Kings)
+// Where the table is in a hand. Update() only does work in TABLE_IDLE (deal timer) and TABLE_ADVANCE;
+// the waiting states move on when the person's callback arrives, so a waiting or empty table costs nothing
+enum TableState {
+    TABLE_IDLE,             // Between hands - the next deal is tried when dealTimer runs out
+    TABLE_ADVANCE,          // Something changed outside a callback - run the hand forward on the next Update()
+    TABLE_AWAIT_BET,        // A bet request is out to the seat to act
+    TABLE_AWAIT_SHOWDOWN,   // Waiting for the player's showdown card pick
+    TABLE_STOPPED           // Dealer is dead - no more hands
 };
 
 struct Seat {
     Vector3 position;
-    Person* occupant;     // nullptr if empty
+    ObjectHandle occupant;   // Null if empty; goes stale if the person is destroyed while seated
     bool isOccupied;
 };
 
+// Every live table runs on the widest engine, so tables of any size can share a room (and one class);
+// seats past a table's seat count never sit anyone and so are never dealt in
+typedef PokerEngineT<MAX_SEATS> TableEngine;
+
 class PokerTable : public Interactable {
 private:
     // Visual
@@ -67,65 +71,87 @@ private:
 
 
     // Game objects (dual-reference: attributes for logic, children for rendering)
-    Dealer* dealer;
-    Deck* deck;
-    ChipStack* potStack;                 // Chip stack for pot (also in children)
+    ObjectHandle dealer;                 // Owned by the DOM; stale once the dealer is destroyed
+    Deck* deck;                          // Card objects for the engine's card indices
+    ObjectHandle potStack;               // Chip stack for pot (owned by the DOM)
+    ChipPool chipPool;                   // Recycled Chip objects for the pot and new inventory stacks
+    std::vector<Chip*> chipScratch;      // Reused buffer for chips moving into the pot
     std::vector<Card*> communityCards;   // Community cards (also in children)
 
-    // Seating - fixed size array
+    // Seating - fixed size array, the first seatCount seats are laid out around the table
     std::array<Seat, MAX_SEATS> seats;
-    std::array<int, MAX_SEATS> statusList;  // Betting status: -1 = folded, >= 0 = current bet
-    std::array<bool, MAX_SEATS> hasRaised;  // Track if player has raised this betting round
+    int seatCount;
+
+    // Hand state lives in the engine; the table mirrors it with cards and chips
+    TableEngine engine;
+    BlindStructure blinds;                      // This table's schedule (handed to the engine between hands)
+    bool blindsPending;                         // blinds changed, or a replay swapped in the recorded ones
+    std::array<int, MAX_SEATS> chipsCommitted;  // Chips already moved from each seat's inventory to the pot
+    HandHistoryRecorder history;                // Idle unless StartRecording() was called
+    OpponentStatsHand statsHand;                // This table's hand, counted into the shared tracker (replays aren't counted twice)
+    std::array<uint32_t, MAX_SEATS> playerIds;  // OpponentStatsTracker::PlayerId of each seat's occupant
+
+    // Replay mode: the next hand is dealt and played from a recorded hand instead of by the seated people
+    HandRecord replayRecord;
+    std::vector<HandActionRecord> replayActions;
+    int replayNext;                             // Next recorded action (-1 = not replaying)
+    ReplayResult replayResult;
 
     // Track hole cards dealt this hand (for removal at end)
     std::array<std::vector<Card*>, MAX_SEATS> dealtHoleCards;  // Cards dealt to each seat this hand
 
     // Game state
-    int smallBlindSeat;     // Index of seat with small blind
-    int bigBlindSeat;       // Index of seat with big blind
-    int currentPlayerSeat;  // Index of seat for current player (for betting)
-    int currentBet;         // Current bet to match
-    int potValue;           // Total value of pot
     bool handActive;
-    bool bettingActive;
-    bool showdownActive;    // Waiting for player card selection at showdown
-
-    // Logging state (to prevent duplicate logs)
-    int lastLoggedPlayerSeat;  // Last player seat that was logged
+    TableState state;
+    float dealTimer;         // Seconds until the next deal attempt (TABLE_IDLE)
+    uint32_t requestId;      // Bumped per bet/showdown request; stale callbacks are ignored
+    int awaitSeat;           // Seat the outstanding bet request went to (-1 = none)
+    bool advancing;          // Inside Advance() - decisions delivered synchronously are picked up by its loop
 
     // Helper functions - Chip management
     int CountChips(Person* p);
     void TakeChips(Person* p, int amount);
     void GiveChips(Person* p, int amount);
-    std::vector<Chip*> CalculateChipCombination(int amount);
+    void SetChips(Person* p, const ChipLedger& ledger);  // Adjust inventory chip stacks in place
+    void AddToPot(const ChipLedger& chips);
+    void ClearPot();                     // Return pot chips to the pool
 
     // Helper functions - Seat navigation
-    int NextOccupiedSeat(int index);
+    void LayOutSeats(Vector3 pos);            // Spread seatCount seats around the table edges
+    Person* GetOccupant(int seatIndex) const;  // Resolves the seat's handle (nullptr if empty or destroyed)
     Person* GetValidOccupant(int seatIndex);  // Safety check for valid occupant
-    int NextActiveSeat(int index);  // Next seat that's occupied and not folded
     int GetOccupiedSeatCount();
 
-    // Helper functions - Betting
-    bool IsBettingRoundComplete();
-    void ProcessBetting(float dt);
+    // Helper functions - Engine sync
+    void SyncChips();       // Move committed chips from inventories into the pot
+    void SyncBoard();       // Lay out community cards the engine has dealt
+
+    // Helper functions - Betting state machine
+    void Advance();                                         // Run the hand until it needs someone's input
+    void RequestBet();                                      // Ask the seat to act (answer arrives in OnBetDecided)
+    void OnBetDecided(uint32_t id, int action, int raiseAmount);
+    void OnShowdownReady(uint32_t id);
+    void CancelRequests();                                  // Drop the outstanding request, if any
+    void CancelCardSelection(int seat);                     // Drop the seat's pending showdown pick, if any
+    void ReplayNextAction();
 
     // Helper functions - Hand evaluation
-    HandEvaluation EvaluateHand(Person* p);
-    int CompareHands(const HandEvaluation& h1, const HandEvaluation& h2);
+    CardMask GetShowdownHand(Person* p);  // Cards a person shows down with (inventory, or the player's pick)
 
     // Game flow
-    void StartHand();
+    bool StartHand();
     void DealHoleCards();
-    void PostBlinds();
-    void StartBettingRound(int startPlayer);
-    void DealFlop();
-    void DealTurn();
-    void DealRiver();
-    void Showdown();
+    bool Showdown();        // False while waiting for a card selection
     void EndHand();
+    void StandUpSeat(int seat);     // Fold a seat out of the engine (and the history)
+    void VacateSeat(int seat);      // Empty a seat mid-hand or between hands
+    void VacateStaleSeats();        // Free seats whose occupant was destroyed without being unseated
+    void StopGame();                // Dealer is gone: end the hand and clear every seat
 
 public:
-    PokerTable(Vector3 pos, Vector3 size, Color color, PhysicsWorld* physics);
+    DECLARE_OBJECT_TYPE(TYPE_POKER_TABLE, Interactable)
+
+    PokerTable(Vector3 pos, Vector3 size, Color color, PhysicsWorld* physics, int seatCount = DEFAULT_TABLE_SEATS);
     ~PokerTable();
 
     // Overrides
@@ -133,18 +159,45 @@ public:
     void Draw(Camera3D camera) override;
     void Interact() override;
     std::string GetType() const override;
+    float GetBoundingRadius() const override { return 0.5f * sqrtf(size.x * size.x + size.y * size.y + size.z * size.z); }
 
     // Seating
     int FindClosestOpenSeat(Vector3 pos);
     bool SeatPerson(Person* p, int seatIndex);
     void UnseatPerson(Person* p);
     int FindSeatIndex(Person* p);  // Returns seat index or -1 if not seated
+    void OnPersonKilled(Person* p);   // Unseats them; killing this table's dealer stops the game
+
+    // Blinds and antes (takes effect from the next hand; the level clock restarts)
+    void SetBlindStructure(const BlindStructure& structure);
+
+    // Hand history
+    bool StartRecording(const std::string& basePath);   // Appends to <basePath>.NNNN.phh segments
+    void StopRecording() { history.Close(); }
+
+    // Opponent stats (defaults to OpponentStatsTracker::GetGlobal(); nullptr stops tracking)
+    void SetStatsTracker(OpponentStatsTracker* tracker) { statsHand.SetTracker(tracker); }
+    const OpponentStatsTracker* GetStatsTracker() const { return statsHand.GetTracker(); }
+
+    // Replay (only between hands; every recorded seat must be occupied)
+    // Restores the recorded stacks, button, blinds and deck, then plays the recorded actions on Update()
+    bool LoadReplay(const HandView& hand);
+    bool IsReplaying() const { return replayNext >= 0 && replayResult.failedAction < 0; }
+    const ReplayResult& GetReplayResult() const { return replayResult; }  // Filled in when the hand ends
 
     // Game state management
     void MakePotItemsInteractable();  // Make all pot chips and community cards interactable
 
     // Accessors
     Collider* GetCollider() { return &collider; }
+    TableState GetState() const { return state; }
+    int GetSeatCount() const { return seatCount; }
+    CardMask GetBoardMask() const { return engine.GetBoard(); }
+    const TableEngine& GetEngine() const { return engine; }
+    const HandHistoryRecorder& GetHistory() const { return history; }
+    const ChipPool& GetChipPool() const { return chipPool; }
+    const ChipStack* GetPotStack() const;
+    Dealer* GetDealer() const;        // nullptr once the dealer is destroyed
 };
 
 #endif
@@ -0,0 +1,104 @@
+#include "gameplay/pot_settlement.hpp"
+
+int PotSettlement::BuildPots(const PotContributions& contributions, SidePot* pots) {
+    // Distinct contribution levels of live seats, ascending (insertion sort over at most MAX_SEATS)
+    int levels[MAX_SEATS];
+    int levelCount = 0;
+    for (int seat = 0; seat < MAX_SEATS; seat++) {
+        int level = contributions.committed[seat];
+        if (!contributions.live[seat] || level <= 0) continue;
+
+        bool seen = false;
+        for (int i = 0; i < levelCount; i++) {
+            if (levels[i] == level) seen = true;
+        }
+        if (seen) continue;
+
+        int i = levelCount;
+        while (i > 0 && levels[i - 1] > level) {
+            levels[i] = levels[i - 1];
+            i--;
+        }
+        levels[i] = level;
+        levelCount++;
+    }
+
+    // Each level's pot takes the slice of every contribution between the previous level and this one
+    int potCount = 0;
+    int previous = 0;
+    for (int k = 0; k < levelCount; k++) {
+        int level = levels[k];
+        bool top = (k == levelCount - 1);
+
+        SidePot pot;
+        for (int seat = 0; seat < MAX_SEATS; seat++) {
+            int committed = contributions.committed[seat];
+            if (committed <= previous) continue;
+
+            // Folded chips above the highest live level still belong in the last pot
+            int capped = (top || committed < level) ? committed : level;
+            pot.amount += capped - previous;
+            if (contributions.live[seat] && committed >= level) {
+                pot.eligible |= 1u << seat;
+            }
+        }
+
+        if (pot.amount > 0) pots[potCount++] = pot;
+        previous = level;
+    }
+
+    // Only folded chips in play (no live seat put anything in) - everyone live shares them
+    if (levelCount == 0) {
+        SidePot pot;
+        for (int seat = 0; seat < MAX_SEATS; seat++) {
+            pot.amount += contributions.committed[seat];
+            if (contributions.live[seat]) pot.eligible |= 1u << seat;
+        }
+        if (pot.amount > 0 && pot.eligible != 0) pots[potCount++] = pot;
+    }
+
+    return potCount;
+}
+
+int PotSettlement::Settle(const PotContributions& contributions, const HandStrength* strengths,
+                          int firstSeat, int* winnings) {
+    SidePot pots[MAX_POTS];
+    int potCount = BuildPots(contributions, pots);
+    if (firstSeat < 0) firstSeat = 0;
+
+    int paid = 0;
+    for (int p = 0; p < potCount; p++) {
+        const SidePot& pot = pots[p];
+
+        HandStrength best = 0;
+        int winnerCount = 0;
+        uint32_t winners = 0;
+        for (int seat = 0; seat < MAX_SEATS; seat++) {
+            if (!(pot.eligible & (1u << seat))) continue;
+
+            if (winnerCount == 0 || strengths[seat] > best) {
+                best = strengths[seat];
+                winners = 1u << seat;
+                winnerCount = 1;
+            } else if (strengths[seat] == best) {
+                winners |= 1u << seat;
+                winnerCount++;
+            }
+        }
+        if (winnerCount == 0) continue;
+
+        int share = pot.amount / winnerCount;
+        int oddChips = pot.amount % winnerCount;
+        for (int n = 0; n < MAX_SEATS; n++) {
+            int seat = (firstSeat + n) % MAX_SEATS;
+            if (!(winners & (1u << seat))) continue;
+
+            int amount = share + (oddChips > 0 ? 1 : 0);
+            if (oddChips > 0) oddChips--;
+            winnings[seat] += amount;
+            paid += amount;
+        }
+    }
+
+    return paid;
+}
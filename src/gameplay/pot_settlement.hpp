@@ -0,0 +1,41 @@
+#ifndef POT_SETTLEMENT_HPP
+#define POT_SETTLEMENT_HPP
+
+#include "gameplay/hand_evaluator.hpp"
+#include <cstdint>
+
+#define MAX_SEATS 10         // Largest table (PokerEngineT, PokerTable, hand records and the simulator)
+#define MAX_POTS MAX_SEATS   // One main pot plus a side pot per distinct all-in level
+
+// One main or side pot: its chips and the seats that can win it
+struct SidePot {
+    int amount;
+    uint32_t eligible;   // Bit per seat still in the hand that covered this pot's level
+
+    SidePot() : amount(0), eligible(0) {}
+};
+
+// What every seat put in this hand and whether it is still contesting the pot
+// Fixed-size arrays indexed by seat, so settling a hand never touches the heap
+struct PotContributions {
+    int committed[MAX_SEATS];   // Chips put in this hand (folded seats included - their chips stay in)
+    bool live[MAX_SEATS];       // Not folded
+
+    PotContributions() : committed{}, live{} {}
+};
+
+// Static utility class for splitting a hand's chips into main/side pots and paying them out
+// Shared by every PokerEngineT (and through it the live table and the simulator)
+class PotSettlement {
+public:
+    // Main pot first, then each side pot; returns the number of pots written to pots[MAX_POTS]
+    static int BuildPots(const PotContributions& contributions, SidePot* pots);
+
+    // Pays each pot to its best eligible hands; ties split evenly and odd chips go to the
+    // winners closest after firstSeat (so the result never depends on evaluation order)
+    // Adds to winnings[MAX_SEATS] and returns the total paid
+    static int Settle(const PotContributions& contributions, const HandStrength* strengths,
+                      int firstSeat, int* winnings);
+};
+
+#endif
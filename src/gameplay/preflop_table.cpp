@@ -0,0 +1,196 @@
+#include "gameplay/preflop_table.hpp"
+#include "gameplay/hand_evaluator.hpp"
+#include "gameplay/fast_deck.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#define PREFLOP_BATCH_SAMPLES 16   // Matchup samples per HandEvaluator::EvaluateBatch call
+
+static const char RANK_CHARS[] = "23456789TJQKA";
+
+static size_t ExpectedFileSize() {
+    return sizeof(PreflopTableHeader) +
+           sizeof(float) * PREFLOP_CLASSES * PREFLOP_CLASSES +
+           sizeof(float) * PREFLOP_CLASSES * PREFLOP_MAX_OPPONENTS;
+}
+
+// ========== LOADING ==========
+
+PreflopTable::PreflopTable() : headsUp(nullptr), multiway(nullptr) {}
+
+bool PreflopTable::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) return false;
+
+    // Anything but the exact layout this build expects is treated as missing
+    const PreflopTableHeader* header = reinterpret_cast<const PreflopTableHeader*>(file.GetData());
+    if (file.GetSize() != ExpectedFileSize() ||
+        header->magic != PREFLOP_TABLE_MAGIC || header->version != PREFLOP_TABLE_VERSION ||
+        header->classCount != PREFLOP_CLASSES || header->maxOpponents != PREFLOP_MAX_OPPONENTS ||
+        header->headerBytes != sizeof(PreflopTableHeader)) {
+        file.Close();
+        return false;
+    }
+
+    headsUp = reinterpret_cast<const float*>(file.GetData() + sizeof(PreflopTableHeader));
+    multiway = headsUp + PREFLOP_CLASSES * PREFLOP_CLASSES;
+    return true;
+}
+
+void PreflopTable::Close() {
+    file.Close();
+    headsUp = nullptr;
+    multiway = nullptr;
+}
+
+bool PreflopTable::Lookup(CardMask hole, int opponents, double& equity) const {
+    int cls = ClassOf(hole);
+    if (!IsLoaded() || cls < 0) return false;
+
+    opponents = std::max(1, std::min(opponents, PREFLOP_MAX_OPPONENTS));
+    equity = Multiway(cls, opponents);
+    return true;
+}
+
+PreflopTable* PreflopTable::GetGlobal() {
+    static PreflopTable table;
+    return &table;
+}
+
+// ========== CLASSES ==========
+
+int PreflopTable::ClassOf(int cardA, int cardB) {
+    int rankA = CardMask::RankOf(cardA);
+    int rankB = CardMask::RankOf(cardB);
+    int high = std::max(rankA, rankB);
+    int low = std::min(rankA, rankB);
+
+    if (high == low) return high * NUM_RANKS + low;
+    if (CardMask::SuitOf(cardA) == CardMask::SuitOf(cardB)) return high * NUM_RANKS + low;
+    return low * NUM_RANKS + high;
+}
+
+int PreflopTable::ClassOf(CardMask hole) {
+    if (hole.Count() != 2) return -1;
+    int first = hole.PopFirst();
+    return ClassOf(first, hole.First());
+}
+
+std::string PreflopTable::ClassName(int cls) {
+    if (cls < 0 || cls >= PREFLOP_CLASSES) return "";
+    int row = cls / NUM_RANKS;
+    int col = cls % NUM_RANKS;
+
+    std::string name;
+    name += RANK_CHARS[std::max(row, col)];
+    name += RANK_CHARS[std::min(row, col)];
+    if (row != col) name += (row > col) ? 's' : 'o';
+    return name;
+}
+
+int PreflopTable::ClassFromName(const std::string& name) {
+    if (name.size() != 2 && name.size() != 3) return -1;
+    const char* a = strchr(RANK_CHARS, name[0]);
+    const char* b = strchr(RANK_CHARS, name[1]);
+    if (!a || !b || name[0] == '\0' || name[1] == '\0') return -1;
+
+    int high = static_cast<int>(a - RANK_CHARS);
+    int low = static_cast<int>(b - RANK_CHARS);
+    if (high == low) return name.size() == 2 ? high * NUM_RANKS + low : -1;
+    if (high < low || name.size() != 3) return -1;
+    if (name[2] == 's') return high * NUM_RANKS + low;
+    if (name[2] == 'o') return low * NUM_RANKS + high;
+    return -1;
+}
+
+int PreflopTable::ClassCombos(int cls, int combos[PREFLOP_MAX_COMBOS][2]) {
+    int row = cls / NUM_RANKS;
+    int col = cls % NUM_RANKS;
+    int high = std::max(row, col);
+    int low = std::min(row, col);
+
+    int count = 0;
+    for (int a = 0; a < NUM_SUITS; a++) {
+        for (int b = 0; b < NUM_SUITS; b++) {
+            bool keep = (row == col) ? (a < b) : (row > col) ? (a == b) : (a != b);
+            if (!keep) continue;
+            combos[count][0] = a * NUM_RANKS + high;
+            combos[count][1] = b * NUM_RANKS + low;
+            count++;
+        }
+    }
+    return count;
+}
+
+// ========== GENERATION ==========
+
+double PreflopTable::MatchupEquity(int cls, int vsCls, int samples, uint64_t seed) {
+    int ours[PREFLOP_MAX_COMBOS][2];
+    int theirs[PREFLOP_MAX_COMBOS][2];
+    int ourCount = ClassCombos(cls, ours);
+    int theirCount = ClassCombos(vsCls, theirs);
+
+    // Every pair of holdings that can be dealt together, each weighted equally
+    CardMask holes[PREFLOP_MAX_COMBOS * PREFLOP_MAX_COMBOS][2];
+    int pairs = 0;
+    for (int i = 0; i < ourCount; i++) {
+        CardMask a = CardMask::FromIndex(ours[i][0]) | CardMask::FromIndex(ours[i][1]);
+        for (int j = 0; j < theirCount; j++) {
+            CardMask b = CardMask::FromIndex(theirs[j][0]) | CardMask::FromIndex(theirs[j][1]);
+            if (!(a & b).IsEmpty()) continue;
+            holes[pairs][0] = a;
+            holes[pairs][1] = b;
+            pairs++;
+        }
+    }
+    if (pairs == 0 || samples <= 0) return 0.5;
+
+    FastDeck deck(seed);
+    CardMask hands[PREFLOP_BATCH_SAMPLES * 2];
+    HandStrength strengths[PREFLOP_BATCH_SAMPLES * 2];
+    double share = 0.0;
+
+    for (int done = 0; done < samples;) {
+        int batch = std::min(PREFLOP_BATCH_SAMPLES, samples - done);
+        for (int b = 0; b < batch; b++) {
+            const CardMask* pair = holes[(done + b) % pairs];
+            deck.ResetAll();
+            deck.RemoveDead(pair[0] | pair[1]);
+
+            CardMask board;
+            for (int i = 0; i < 5; i++) {
+                board.Add(deck.Deal());
+            }
+            hands[2 * b] = pair[0] | board;
+            hands[2 * b + 1] = pair[1] | board;
+        }
+
+        HandEvaluator::EvaluateBatch(hands, batch * 2, strengths);
+        for (int b = 0; b < batch; b++) {
+            if (strengths[2 * b] > strengths[2 * b + 1]) share += 1.0;
+            else if (strengths[2 * b] == strengths[2 * b + 1]) share += 0.5;
+        }
+        done += batch;
+    }
+    return share / samples;
+}
+
+bool PreflopTable::Write(const std::string& path, const PreflopTableHeader& header,
+                         const float* headsUpData, const float* multiwayData) {
+    PreflopTableHeader out = header;
+    out.magic = PREFLOP_TABLE_MAGIC;
+    out.version = PREFLOP_TABLE_VERSION;
+    out.classCount = PREFLOP_CLASSES;
+    out.maxOpponents = PREFLOP_MAX_OPPONENTS;
+    out.headerBytes = sizeof(PreflopTableHeader);
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(&out, sizeof(out), 1, f) == 1 &&
+              fwrite(headsUpData, sizeof(float), PREFLOP_CLASSES * PREFLOP_CLASSES, f) ==
+                  PREFLOP_CLASSES * PREFLOP_CLASSES &&
+              fwrite(multiwayData, sizeof(float), PREFLOP_CLASSES * PREFLOP_MAX_OPPONENTS, f) ==
+                  PREFLOP_CLASSES * PREFLOP_MAX_OPPONENTS;
+    return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,76 @@
+#ifndef PREFLOP_TABLE_HPP
+#define PREFLOP_TABLE_HPP
+
+#include "core/mapped_file.hpp"
+#include "gameplay/card_mask.hpp"
+#include <cstdint>
+#include <string>
+
+#define PREFLOP_TABLE_MAGIC 0x51454650u      // "PFEQ"
+#define PREFLOP_TABLE_VERSION 1
+#define PREFLOP_CLASSES 169                  // 13 pairs + 78 suited + 78 offsuit starting hands
+#define PREFLOP_MAX_OPPONENTS 7              // Bigger fields look up the 7-opponent column
+#define PREFLOP_MAX_COMBOS 12                // Offsuit classes have the most concrete holdings
+#define PREFLOP_TABLE_PATH "preflop_equity.bin"   // Loaded at startup (generate with `make preflop-table`)
+
+// File header, followed by float headsUp[PREFLOP_CLASSES][PREFLOP_CLASSES] and
+// float multiway[PREFLOP_CLASSES][PREFLOP_MAX_OPPONENTS] (little-endian, naturally aligned)
+struct PreflopTableHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t classCount;
+    uint16_t maxOpponents;
+    uint16_t headerBytes;
+    uint32_t headsUpSamples;     // Monte Carlo samples per class-vs-class matchup
+    uint32_t multiwaySamples;    // Samples per class and opponent count
+    uint32_t reserved0;
+    uint64_t seed;               // Base seed the generator ran with
+    uint8_t reserved[32];
+};
+static_assert(sizeof(PreflopTableHeader) == 64, "PreflopTableHeader layout is part of the file format");
+
+// Precomputed all-in preflop equities by canonical starting hand, memory-mapped for O(1) lookups
+// Class index: pairs on the diagonal (r * 13 + r), suited above it (high * 13 + low),
+// offsuit below it (low * 13 + high), with rank index 0 = two ... 12 = ace
+// A missing or mismatched file leaves the table unloaded and callers fall back to Monte Carlo
+class PreflopTable {
+private:
+    MappedFile file;
+    const float* headsUp;
+    const float* multiway;
+
+public:
+    PreflopTable();
+    ~PreflopTable() = default;
+
+    bool Open(const std::string& path);
+    void Close();
+    bool IsLoaded() const { return headsUp != nullptr; }
+
+    // Equity of `cls` against one `vsCls` holding / against `opponents` random holdings (1..7)
+    float HeadsUp(int cls, int vsCls) const { return headsUp[cls * PREFLOP_CLASSES + vsCls]; }
+    float Multiway(int cls, int opponents) const { return multiway[cls * PREFLOP_MAX_OPPONENTS + opponents - 1]; }
+
+    // Equity for two hole cards against random opponents; false if unloaded or the hole isn't two cards
+    bool Lookup(CardMask hole, int opponents, double& equity) const;
+
+    // ========== CLASSES ==========
+    static int ClassOf(int cardA, int cardB);     // Card indices
+    static int ClassOf(CardMask hole);            // Exactly two cards, otherwise -1
+    static bool IsPair(int cls) { return cls / NUM_RANKS == cls % NUM_RANKS; }
+    static bool IsSuited(int cls) { return cls / NUM_RANKS > cls % NUM_RANKS; }
+    static std::string ClassName(int cls);        // "AA", "AKs", "T9o"
+    static int ClassFromName(const std::string& name);   // -1 if not a class name
+    static int ClassCombos(int cls, int combos[PREFLOP_MAX_COMBOS][2]);   // Concrete holdings, returns count
+
+    // ========== GENERATION ==========
+    // Monte Carlo equity of `cls` against `vsCls`, cycling through every non-conflicting pair of holdings
+    static double MatchupEquity(int cls, int vsCls, int samples, uint64_t seed);
+    static bool Write(const std::string& path, const PreflopTableHeader& header,
+                      const float* headsUp, const float* multiway);
+
+    // Shared table for AI decisions (opened once at startup)
+    static PreflopTable* GetGlobal();
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "gameplay/strategy_table.hpp"
+#include <algorithm>
+#include <cstdio>
+
+static size_t ExpectedFileSize() {
+    return sizeof(StrategyTableHeader) + STRATEGY_INFOSETS * STRATEGY_ACTIONS;
+}
+
+// ========== LOADING ==========
+
+StrategyTable::StrategyTable() : probabilities(nullptr) {}
+
+bool StrategyTable::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) return false;
+
+    // Anything but the exact abstraction this build expects is treated as missing
+    const StrategyTableHeader* header = reinterpret_cast<const StrategyTableHeader*>(file.GetData());
+    if (file.GetSize() != ExpectedFileSize() ||
+        header->magic != STRATEGY_TABLE_MAGIC || header->version != STRATEGY_TABLE_VERSION ||
+        header->headerBytes != sizeof(StrategyTableHeader) || header->infosetCount != STRATEGY_INFOSETS ||
+        header->actionCount != STRATEGY_ACTIONS || header->equityBuckets != STRATEGY_EQUITY_BUCKETS) {
+        file.Close();
+        return false;
+    }
+
+    probabilities = file.GetData() + sizeof(StrategyTableHeader);
+    return true;
+}
+
+void StrategyTable::Close() {
+    file.Close();
+    probabilities = nullptr;
+}
+
+const StrategyTableHeader* StrategyTable::GetHeader() const {
+    if (!IsLoaded()) return nullptr;
+    return reinterpret_cast<const StrategyTableHeader*>(file.GetData());
+}
+
+int StrategyTable::SampleAction(int infoset, uint32_t roll) const {
+    const uint8_t* strategy = GetStrategy(infoset);
+    if (roll < strategy[0]) return 0;
+    if (roll < (uint32_t)strategy[0] + strategy[1]) return 1;
+    return 2;
+}
+
+StrategyTable* StrategyTable::GetGlobal() {
+    static StrategyTable table;
+    return &table;
+}
+
+// ========== ABSTRACTION ==========
+
+int StrategyTable::InfosetIndex(int street, int raises, bool facingBet, int potBucket, int equityBucket) {
+    street = std::max(0, std::min(street, STRATEGY_STREETS - 1));
+    raises = std::max(0, std::min(raises, STRATEGY_RAISE_STATES - 1));
+    int index = street;
+    index = index * STRATEGY_RAISE_STATES + raises;
+    index = index * 2 + (facingBet ? 1 : 0);
+    index = index * STRATEGY_POT_BUCKETS + potBucket;
+    return index * STRATEGY_EQUITY_BUCKETS + equityBucket;
+}
+
+int StrategyTable::StreetOf(int boardCount) {
+    if (boardCount < 3) return 0;
+    return std::min(boardCount - 2, STRATEGY_STREETS - 1);
+}
+
+int StrategyTable::PotBucket(int pot, int bigBlind) {
+    if (bigBlind <= 0) bigBlind = 1;
+    int bigBlinds = pot / bigBlind;
+    if (bigBlinds < 4) return 0;
+    if (bigBlinds < 16) return 1;
+    if (bigBlinds < 64) return 2;
+    return 3;
+}
+
+int StrategyTable::EquityBucket(double equity) {
+    int bucket = static_cast<int>(equity * STRATEGY_EQUITY_BUCKETS);
+    return std::max(0, std::min(bucket, STRATEGY_EQUITY_BUCKETS - 1));
+}
+
+// ========== WRITING ==========
+
+void StrategyTable::Quantize(const double* probs, uint8_t* out) {
+    double remainders[STRATEGY_ACTIONS];
+    int total = 0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        double scaled = std::max(0.0, probs[a]) * STRATEGY_QUANT;
+        out[a] = static_cast<uint8_t>(std::min(scaled, (double)STRATEGY_QUANT));
+        remainders[a] = scaled - out[a];
+        total += out[a];
+    }
+
+    // Hand the rounding leftovers to the largest remainders so every infoset sums exactly
+    while (total < STRATEGY_QUANT) {
+        int best = 0;
+        for (int a = 1; a < STRATEGY_ACTIONS; a++) {
+            if (remainders[a] > remainders[best]) best = a;
+        }
+        out[best]++;
+        remainders[best] -= 1.0;
+        total++;
+    }
+    while (total > STRATEGY_QUANT) {
+        int best = 0;
+        for (int a = 1; a < STRATEGY_ACTIONS; a++) {
+            if (out[a] > out[best]) best = a;
+        }
+        out[best]--;
+        total--;
+    }
+}
+
+bool StrategyTable::Write(const std::string& path, const StrategyTableHeader& header, const uint8_t* probs) {
+    StrategyTableHeader out = header;
+    out.magic = STRATEGY_TABLE_MAGIC;
+    out.version = STRATEGY_TABLE_VERSION;
+    out.headerBytes = sizeof(StrategyTableHeader);
+    out.infosetCount = STRATEGY_INFOSETS;
+    out.actionCount = STRATEGY_ACTIONS;
+    out.equityBuckets = STRATEGY_EQUITY_BUCKETS;
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(&out, sizeof(out), 1, f) == 1 &&
+              fwrite(probs, 1, STRATEGY_INFOSETS * STRATEGY_ACTIONS, f) == STRATEGY_INFOSETS * STRATEGY_ACTIONS;
+    return fclose(f) == 0 && ok;
+}
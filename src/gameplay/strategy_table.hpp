@@ -0,0 +1,74 @@
+#ifndef STRATEGY_TABLE_HPP
+#define STRATEGY_TABLE_HPP
+
+#include "core/mapped_file.hpp"
+#include <cstdint>
+#include <string>
+
+#define STRATEGY_TABLE_MAGIC 0x54534643u     // "CFST"
+#define STRATEGY_TABLE_VERSION 2
+#define STRATEGY_TABLE_PATH "strategy_table.bin"   // Loaded at startup (train with `make strategy-table`)
+
+// Abstraction: what a decision is keyed on
+#define STRATEGY_STREETS 4                   // Preflop, flop, turn, river
+#define STRATEGY_RAISE_STATES 3              // Raises already made this street: 0, 1, 2+ (a seat raises once per round)
+#define STRATEGY_POT_BUCKETS 4               // Pot in big blinds: under 4, under 16, under 64, 64+
+#define STRATEGY_EQUITY_BUCKETS 16           // Equity against the field, in equal slices
+#define STRATEGY_ACTIONS 3                   // Fold, call/check, raise (PokerActionType order)
+#define STRATEGY_INFOSETS (STRATEGY_STREETS * STRATEGY_RAISE_STATES * 2 * STRATEGY_POT_BUCKETS * STRATEGY_EQUITY_BUCKETS)
+#define STRATEGY_QUANT 255                   // Each infoset's quantized probabilities sum to this
+
+// File header, followed by uint8 probabilities[STRATEGY_INFOSETS][STRATEGY_ACTIONS] (naturally aligned)
+struct StrategyTableHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerBytes;
+    uint32_t infosetCount;
+    uint16_t actionCount;
+    uint16_t equityBuckets;
+    uint64_t iterations;         // CFR iterations behind the average strategy
+    uint64_t seed;               // Base seed the trainer ran with
+    float exploitability;        // Estimated at write time, milli-big-blinds per hand (negative = not measured)
+    uint8_t reserved[28];
+};
+static_assert(sizeof(StrategyTableHeader) == 64, "StrategyTableHeader layout is part of the file format");
+
+// Quantized average strategy from the offline CFR trainer, memory-mapped so a lookup is one index
+// and sampling an action is one roll against three bytes
+// A missing or mismatched file leaves the table unloaded and Enemy falls back to BettingAI
+class StrategyTable {
+private:
+    MappedFile file;
+    const uint8_t* probabilities;
+
+public:
+    StrategyTable();
+    ~StrategyTable() = default;
+
+    bool Open(const std::string& path);
+    void Close();
+    bool IsLoaded() const { return probabilities != nullptr; }
+    const StrategyTableHeader* GetHeader() const;
+
+    // Quantized action weights for one infoset (STRATEGY_ACTIONS bytes summing to STRATEGY_QUANT)
+    const uint8_t* GetStrategy(int infoset) const { return probabilities + infoset * STRATEGY_ACTIONS; }
+
+    // Action for a roll in [0, STRATEGY_QUANT) (0=fold, 1=call, 2=raise)
+    int SampleAction(int infoset, uint32_t roll) const;
+
+    // ========== ABSTRACTION ==========
+    static int InfosetIndex(int street, int raises, bool facingBet, int potBucket, int equityBucket);
+    static int StreetOf(int boardCount);
+    static int PotBucket(int pot, int bigBlind);
+    static int EquityBucket(double equity);
+
+    // ========== WRITING ==========
+    // Round probabilities (summing to 1) to bytes summing to STRATEGY_QUANT (largest remainder)
+    static void Quantize(const double* probabilities, uint8_t* out);
+    static bool Write(const std::string& path, const StrategyTableHeader& header, const uint8_t* probabilities);
+
+    // Shared table for AI decisions (opened once at startup)
+    static StrategyTable* GetGlobal();
+};
+
+#endif
@@ -160,6 +160,14 @@ std::string Card::GetType() const {
     return typeBuffer;
 }
 
+CardMask Card::ToMask(const std::vector<Card*>& cards) {
+    CardMask mask;
+    for (Card* card : cards) {
+        if (card) mask.Add(card->GetIndex());
+    }
+    return mask;
+}
+
 const char* Card::GetSuitSymbol(Suit s) {
     switch (s) {
         case SUIT_HEARTS:   return "HEARTS";
@@ -4,6 +4,8 @@
 #include "items/item.hpp"
 #include "core/rigidbody.hpp"
 #include "core/physics.hpp"
+#include "gameplay/card_mask.hpp"
+#include <vector>
 
 typedef enum {
     SUIT_HEARTS,
@@ -30,6 +32,8 @@ typedef enum {
 
 class Card : public Item {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_CARD, Item)
+
     Suit suit;
     Rank rank;
     RenderTexture2D texture;
@@ -51,6 +55,11 @@ public:
     // Cards don't stack - each card is unique
     bool CanStack() const override { return false; }
     
+    // Bitboard conversions (see CardMask)
+    int GetIndex() const { return CardMask::CardIndex(suit, rank); }
+    CardMask GetMask() const { return CardMask::FromIndex(GetIndex()); }
+    static CardMask ToMask(const std::vector<Card*>& cards);
+
     static const char* GetSuitSymbol(Suit s);
     static const char* GetRankString(Rank r);
     static Color GetSuitColor(Suit s);
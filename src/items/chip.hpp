@@ -7,6 +7,8 @@
 
 class Chip : public Item {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_CHIP, Item)
+
     int value;
     Color color;
     RenderTexture2D iconTexture;
@@ -20,6 +22,7 @@ public:
     void Draw(Camera3D camera) override;
     void DrawIcon(Rectangle destRect) override;
     std::string GetType() const override;
+    int GetStackKey() const override { return value * TYPE_COUNT + TYPE_CHIP; }  // One stack per denomination
     Object* Clone(Vector3 newPos) const override;
     
     static Color GetColorFromValue(int value);
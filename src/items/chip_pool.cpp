@@ -0,0 +1,56 @@
+#include "items/chip_pool.hpp"
+
+ChipPool::ChipPool() : allocatedCount(0) {
+}
+
+ChipPool::~ChipPool() {
+    for (std::vector<Chip*>& chips : freeChips) {
+        for (Chip* chip : chips) {
+            delete chip;
+        }
+        chips.clear();
+    }
+}
+
+Chip* ChipPool::Acquire(int value) {
+    int d = ChipLedger::IndexOf(value);
+    if (d < 0) return nullptr;
+
+    if (!freeChips[d].empty()) {
+        Chip* chip = freeChips[d].back();
+        freeChips[d].pop_back();
+        return chip;
+    }
+
+    allocatedCount++;
+    return new Chip(value, {0, 0, 0}, nullptr);
+}
+
+void ChipPool::Release(Chip* chip) {
+    if (!chip) return;
+
+    int d = ChipLedger::IndexOf(chip->value);
+    if (d < 0 || chip->rigidBody) {
+        // Picked-up world chips carry a physics body - don't keep those around
+        delete chip;
+        return;
+    }
+
+    chip->canInteract = false;
+    chip->rotation = {0, 0, 0};
+    freeChips[d].push_back(chip);
+}
+
+void ChipPool::Reserve(const ChipLedger& ledger) {
+    for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+        while ((int)freeChips[d].size() < ledger.counts[d]) {
+            freeChips[d].push_back(new Chip(ChipLedger::DENOMINATIONS[d], {0, 0, 0}, nullptr));
+            allocatedCount++;
+        }
+    }
+}
+
+int ChipPool::GetFreeCount(int value) const {
+    int d = ChipLedger::IndexOf(value);
+    return (d >= 0) ? (int)freeChips[d].size() : 0;
+}
@@ -0,0 +1,32 @@
+#ifndef CHIP_POOL_HPP
+#define CHIP_POOL_HPP
+
+#include "items/chip.hpp"
+#include "gameplay/chip_ledger.hpp"
+#include <array>
+#include <vector>
+
+// Recycles Chip objects so their icon textures are created once, not on every bet
+// Owned by whoever shows chips (the poker table); chips handed out are owned by the caller until released
+class ChipPool {
+private:
+    std::array<std::vector<Chip*>, CHIP_DENOMINATION_COUNT> freeChips;  // Idle chips by denomination
+    int allocatedCount;                                                  // Chips this pool ever created
+
+public:
+    ChipPool();
+    ~ChipPool();
+
+    ChipPool(const ChipPool&) = delete;
+    ChipPool& operator=(const ChipPool&) = delete;
+
+    Chip* Acquire(int value);           // Reuse an idle chip or create one
+    void Release(Chip* chip);           // Back to the pool (chips with physics are deleted instead)
+    void Reserve(const ChipLedger& ledger);  // Pre-create idle chips so later Acquire() calls don't allocate
+
+    // Accessors
+    int GetAllocatedCount() const { return allocatedCount; }
+    int GetFreeCount(int value) const;
+};
+
+#endif
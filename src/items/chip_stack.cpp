@@ -9,7 +9,8 @@ ChipStack::~ChipStack() {
     // Remove chips from DOM and delete them
     DOM* dom = DOM::GetGlobal();
     if (dom) {
-        for (Chip* chip : chips) {
+        for (ObjectHandle handle : chips) {
+            Chip* chip = DOM::Resolve<Chip>(handle);
             if (chip) {
                 dom->RemoveObject(chip);
                 delete chip;
@@ -37,8 +38,8 @@ std::string ChipStack::GetType() const {
 void ChipStack::AddChip(Chip* chip) {
     if (!chip) return;
 
-    chips.push_back(chip);
-    chipsByValue[chip->value].push_back(chip);
+    chips.push_back(chip->GetHandle());
+    chipsByValue[chip->value].push_back(chip->GetHandle());
 
     // Make chip non-interactable (it's in the pot)
     chip->canInteract = false;
@@ -54,61 +55,53 @@ void ChipStack::AddChip(Chip* chip) {
 }
 
 void ChipStack::AddChips(const std::vector<Chip*>& newChips) {
-    DOM* dom = DOM::GetGlobal();
-
     for (Chip* chip : newChips) {
         if (chip) {
-            chips.push_back(chip);
-            chipsByValue[chip->value].push_back(chip);
+            chips.push_back(chip->GetHandle());
+            chipsByValue[chip->value].push_back(chip->GetHandle());
 
             // Make chip non-interactable (it's in the pot)
             chip->canInteract = false;
-
-            // Add chip to DOM so it renders
-            if (dom) {
-                dom->AddObject(chip);
-            }
         }
     }
 
+    // Add chips to DOM so they render (one batch)
+    DOM* dom = DOM::GetGlobal();
+    if (dom) {
+        dom->AddObjects(newChips);
+    }
+
     // Reorganize positions
     OrganizeChips();
 }
 
 void ChipStack::Clear() {
     // Remove chips from DOM (but don't delete them - caller manages that)
-    DOM* dom = DOM::GetGlobal();
-    if (dom) {
-        for (Chip* chip : chips) {
-            if (chip) {
-                dom->RemoveObject(chip);
-            }
-        }
-    }
-
-    chips.clear();
-    chipsByValue.clear();
+    RemoveAll();
 }
 
 std::vector<Chip*> ChipStack::RemoveAll() {
-    // Remove chips from DOM (caller will manage deletion)
+    std::vector<Chip*> result;
+    result.reserve(chips.size());
+    for (ObjectHandle handle : chips) {
+        Chip* chip = DOM::Resolve<Chip>(handle);
+        if (chip) result.push_back(chip);
+    }
+
+    // Remove chips from DOM in one batch (caller will manage deletion)
     DOM* dom = DOM::GetGlobal();
     if (dom) {
-        for (Chip* chip : chips) {
-            if (chip) {
-                dom->RemoveObject(chip);
-            }
-        }
+        dom->RemoveObjects(result);
     }
 
-    std::vector<Chip*> result = chips;
     chips.clear();
     chipsByValue.clear();
     return result;
 }
 
 void ChipStack::MakeAllInteractable() {
-    for (Chip* chip : chips) {
+    for (ObjectHandle handle : chips) {
+        Chip* chip = DOM::Resolve<Chip>(handle);
         if (chip) {
             chip->canInteract = true;
         }
@@ -117,7 +110,8 @@ void ChipStack::MakeAllInteractable() {
 
 int ChipStack::GetTotalValue() const {
     int total = 0;
-    for (Chip* chip : chips) {
+    for (ObjectHandle handle : chips) {
+        const Chip* chip = DOM::Resolve<Chip>(handle);
         if (chip) {
             total += chip->value;
         }
@@ -141,11 +135,11 @@ void ChipStack::OrganizeChips() {
         if (chipsByValue.find(denom) == chipsByValue.end()) continue;
         if (chipsByValue[denom].empty()) continue;
 
-        std::vector<Chip*>& pile = chipsByValue[denom];
+        std::vector<ObjectHandle>& pile = chipsByValue[denom];
 
         // Stack chips vertically
         for (size_t i = 0; i < pile.size(); i++) {
-            Chip* chip = pile[i];
+            Chip* chip = DOM::Resolve<Chip>(pile[i]);
             if (chip) {
                 chip->position = {
                     currentX,
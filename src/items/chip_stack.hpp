@@ -8,12 +8,15 @@
 
 class ChipStack : public Object {
 private:
-    std::vector<Chip*> chips;  // All chips in the stack
-    std::map<int, std::vector<Chip*>> chipsByValue;  // Organized by denomination
+    // Handles, so a chip destroyed elsewhere (or picked up and used up) is skipped instead of dangling
+    std::vector<ObjectHandle> chips;  // All chips in the stack
+    std::map<int, std::vector<ObjectHandle>> chipsByValue;  // Organized by denomination
     
     void OrganizeChips();  // Reorganize chip positions based on value
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_CHIP_STACK, Object)
+
     ChipStack(Vector3 pos);
     ~ChipStack();
     
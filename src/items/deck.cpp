@@ -1,22 +1,13 @@
 #include "items/deck.hpp"
-#include <cstdlib>
-#include <ctime>
-#include <algorithm>
-#include <random>
 
-Deck::Deck(Vector3 pos) : Object(pos) {
+Deck::Deck(Vector3 pos) : Object(pos), order(Rng::RandomSeed()), shuffled(false) {
     
     // Generate all 52 cards
     for (int suit = SUIT_HEARTS; suit <= SUIT_SPADES; suit++) {
         for (int rank = RANK_ACE; rank <= RANK_KING; rank++) {
             // Create card at origin with no physics (cards are part of the deck, not individual objects)
             Card* card = new Card(static_cast<Suit>(suit), static_cast<Rank>(rank), {0, 0, 0}, nullptr);
-            
-            // Add to allCards for cleanup tracking
-            allCards.push_back(card);
-            
-            // Push onto stack
-            cards.push_back(card);
+            cardsByIndex[card->GetIndex()] = card;
         }
     }
     
@@ -34,8 +25,8 @@ void Deck::Update(float deltaTime) {
     float cardThickness = 0.02f;
     
     // Position and activate only the cards still in the stack
-    for (size_t i = 0; i < cards.size(); i++) {
-        Card* card = cards[i];
+    for (int i = 0; i < order.GetRemaining(); i++) {
+        Card* card = cardsByIndex[order.GetUndealt(i)];
         if (card != nullptr) {
             card->position = {
                 position.x,
@@ -51,7 +42,8 @@ void Deck::Update(float deltaTime) {
 
 void Deck::Draw(Camera3D camera) {
     // Draw all cards in the stack manually (they're not in DOM)
-    for (Card* card : cards) {
+    for (int i = 0; i < order.GetRemaining(); i++) {
+        Card* card = cardsByIndex[order.GetUndealt(i)];
         if (card) {
             card->Draw(camera);
         }
@@ -63,56 +55,66 @@ std::string Deck::GetType() const {
 }
 
 void Deck::Shuffle() {
-    if (cards.size() <= 1) return;
-    
-    // Use std::shuffle with random device for proper random shuffling
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::shuffle(cards.begin(), cards.end(), gen);
+    // Nothing to move up front: each draw picks a random remaining card
+    shuffled = true;
+}
+
+void Deck::Seed(uint64_t seed) {
+    order.Seed(seed);
 }
 
 Card* Deck::DrawCard() {
-    if (cards.empty()) {
+    if (order.IsEmpty()) {
         return nullptr;
     }
     
-    // Pop from the top of the stack (back of vector)
-    Card* drawnCard = cards.back();
-    cards.pop_back();
-    
-    return drawnCard;
+    // Unshuffled decks deal straight off the top (last undealt slot) - it leaves through
+    // the dead range, which Reset() restores along with everything else
+    if (!shuffled) {
+        int top = order.GetUndealt(order.GetRemaining() - 1);
+        order.RemoveDead(top);
+        return cardsByIndex[top];
+    }
+
+    return cardsByIndex[order.Deal()];
 }
 
 Card* Deck::Peek() {
-    if (cards.empty()) {
+    if (order.IsEmpty()) {
         return nullptr;
     }
     
-    return cards.back();
+    if (!shuffled) {
+        return cardsByIndex[order.GetUndealt(order.GetRemaining() - 1)];
+    }
+
+    return cardsByIndex[order.Peek()];
 }
 
 void Deck::Reset() {
-    // Clear the stack
-    cards.clear();
-    
-    // Push all cards back onto the stack
-    for (Card* card : allCards) {
-        if (card != nullptr) {
-            cards.push_back(card);
-        }
-    }
-    
+    if (!cardsByIndex[0]) return;  // Cleaned up
+    order.ResetAll();
+    shuffled = false;
+}
+
+bool Deck::RemoveDead(int cardIndex) {
+    return order.RemoveDead(cardIndex);
 }
 
 void Deck::Cleanup() {
-    // Clear the stack
-    cards.clear();
-    
     // Delete all cards
-    for (Card* card : allCards) {
-        if (card) {
-            delete card;
+    for (int i = 0; i < DECK_SIZE; i++) {
+        if (cardsByIndex[i]) {
+            delete cardsByIndex[i];
+            cardsByIndex[i] = nullptr;
         }
     }
-    allCards.clear();
+    order.RemoveDead(order.GetRemainingMask());
+}
+
+Card* Deck::GetCard(int cardIndex) const {
+    if (cardIndex < 0 || cardIndex >= DECK_SIZE) {
+        return nullptr;
+    }
+    return cardsByIndex[cardIndex];
 }
@@ -3,16 +3,19 @@
 
 #include "core/object.hpp"
 #include "items/card.hpp"
-#include <vector>
+#include "gameplay/fast_deck.hpp"
 
 #define DECK_SIZE 52
 
 class Deck : public Object {
 private:
-    std::vector<Card*> cards;  // Stack of cards (back = top of deck)
-    std::vector<Card*> allCards;  // All 52 cards for cleanup
+    FastDeck order;                 // Which card indices are still in the stack, dealt by partial Fisher-Yates
+    Card* cardsByIndex[DECK_SIZE];  // Lookup from card index (see CardMask) to Card object
+    bool shuffled;                  // Deal random cards (otherwise straight off the top)
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_DECK, Object)
+
     Deck(Vector3 pos = {0, 0, 0});
     ~Deck();
     
@@ -20,15 +23,22 @@ public:
     void Draw(Camera3D camera) override;
     std::string GetType() const override;
     
-    void Shuffle();
+    void Shuffle();                  // Later draws come out in random order (only drawn cards get shuffled)
+    void Seed(uint64_t seed);        // Reorder the deck and restart the shuffle from a seed (for replays)
     Card* DrawCard();  // Pop from top of stack
     Card* Peek();      // Look at top without removing
-    void Reset();      // Push all cards back onto stack
+    void Reset();      // Push all cards back onto stack (O(1), dead cards too)
+    bool RemoveDead(int cardIndex);  // Take a known card out so it is never drawn
     void Cleanup();
     
     // Accessors
-    int GetCount() const { return cards.size(); }
-    bool IsEmpty() const { return cards.empty(); }
+    int GetCount() const { return order.GetRemaining(); }
+    bool IsEmpty() const { return order.IsEmpty(); }
+
+    // Bitboard accessors
+    Card* GetCard(int cardIndex) const;                  // Card object for an index (nullptr if out of range)
+    CardMask GetRemainingMask() const { return order.GetRemainingMask(); }
+    CardMask GetDealtMask() const { return CardMask::FullDeck() & ~order.GetRemainingMask(); }
 };
 
 #endif
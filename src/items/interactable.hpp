@@ -7,6 +7,8 @@
 
 class Interactable : public Object {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_INTERACTABLE, Object)
+
     float interactRange;
     bool canInteract;  // Whether this object can be interacted with
     std::function<void(Interactable*)> onInteract;
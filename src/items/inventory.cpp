@@ -17,22 +17,19 @@ bool Inventory::AddItem(Item* item) {
         return false;
     }
     
-    // Get the type string for this item (e.g., "card_spades_ace" or "chip_5")
-    std::string itemType = item->GetType();
-    if (itemType.empty()) {
-        return false;
-    }
+    // Stacking and sorting use type ids only - no GetType() strings on this path
+    int stackKey = item->GetStackKey();
     
     // Non-stackable items (cards, weapons, etc.) - always create new slot
     if (!item->CanStack()) {
-        stacks.push_back(ItemStack(item, 1, itemType));
+        stacks.push_back(ItemStack(item, 1, stackKey));
         Sort();  // Sort after adding
         return true;
     }
     
-    // Try to find existing stack with matching type for other items (chips)
+    // Try to find existing stack with matching key for other items (chips)
     for (size_t i = 0; i < stacks.size(); i++) {
-        if (stacks[i].typeString == itemType) {
+        if (stacks[i].stackKey == stackKey) {
             // Found matching stack, increment count
             stacks[i].count++;
             // No need to sort when stacking - position doesn't change
@@ -41,7 +38,7 @@ bool Inventory::AddItem(Item* item) {
     }
     
     // Create new stack
-    stacks.push_back(ItemStack(item, 1, itemType));
+    stacks.push_back(ItemStack(item, 1, stackKey));
     
     // Sort inventory after adding
     Sort();
@@ -63,6 +60,18 @@ bool Inventory::RemoveItem(int stackIndex) {
     return true;
 }
 
+bool Inventory::SetStackCount(int stackIndex, int count) {
+    if (stackIndex < 0 || stackIndex >= (int)stacks.size()) return false;
+
+    if (count <= 0) {
+        stacks.erase(stacks.begin() + stackIndex);
+    } else {
+        stacks[stackIndex].count = count;
+    }
+
+    return true;
+}
+
 void Inventory::Cleanup() {
     stacks.clear();
 }
@@ -73,16 +82,13 @@ void Inventory::Sort() {
         // Safety check: ensure items are valid
         if (!a.item || !b.item) return false;
         
-        const std::string& typeA = a.typeString;
-        const std::string& typeB = b.typeString;
-
         // Determine categories
-        bool aIsWeapon = (typeA.find("pistol") != std::string::npos);
-        bool bIsWeapon = (typeB.find("pistol") != std::string::npos);
-        bool aIsCard = (typeA.find("card") != std::string::npos);
-        bool bIsCard = (typeB.find("card") != std::string::npos);
-        bool aIsChip = (typeA.find("chip") != std::string::npos);
-        bool bIsChip = (typeB.find("chip") != std::string::npos);
+        bool aIsWeapon = a.item->IsA(TYPE_WEAPON);
+        bool bIsWeapon = b.item->IsA(TYPE_WEAPON);
+        bool aIsCard = a.item->IsA<Card>();
+        bool bIsCard = b.item->IsA<Card>();
+        bool aIsChip = a.item->IsA<Chip>();
+        bool bIsChip = b.item->IsA<Chip>();
 
         // Category ordering: weapons < cards < chips
         // If one is a weapon and the other isn't, weapon comes first
@@ -121,20 +127,20 @@ void Inventory::Sort() {
     });
 }
 
-int Inventory::CountItemsByType(const std::string& typeSubstring) const {
+int Inventory::CountItemsByType(ObjectTypeId type) const {
     int count = 0;
     for (size_t i = 0; i < stacks.size(); i++) {
-        if (stacks[i].item && stacks[i].item->GetType().find(typeSubstring) != std::string::npos) {
+        if (stacks[i].item && stacks[i].item->IsA(type)) {
             count += stacks[i].count;
         }
     }
     return count;
 }
 
-std::vector<int> Inventory::GetIndicesByType(const std::string& typeSubstring) const {
+std::vector<int> Inventory::GetIndicesByType(ObjectTypeId type) const {
     std::vector<int> indices;
     for (size_t i = 0; i < stacks.size(); i++) {
-        if (stacks[i].item && stacks[i].item->GetType().find(typeSubstring) != std::string::npos) {
+        if (stacks[i].item && stacks[i].item->IsA(type)) {
             indices.push_back(i);
         }
     }
@@ -144,10 +150,42 @@ std::vector<int> Inventory::GetIndicesByType(const std::string& typeSubstring) c
 int Inventory::GetTotalChipValue() const {
     int totalValue = 0;
     for (size_t i = 0; i < stacks.size(); i++) {
-        if (stacks[i].item && stacks[i].item->GetType().find("chip") != std::string::npos) {
-            Chip* chip = static_cast<Chip*>(stacks[i].item);
+        const Chip* chip = stacks[i].item ? stacks[i].item->As<Chip>() : nullptr;
+        if (chip) {
             totalValue += chip->value * stacks[i].count;
         }
     }
     return totalValue;
 }
+
+CardMask Inventory::GetCardMask() const {
+    CardMask mask;
+    for (size_t i = 0; i < stacks.size(); i++) {
+        const Card* card = stacks[i].item ? stacks[i].item->As<Card>() : nullptr;
+        if (card) {
+            mask.Add(card->GetIndex());
+        }
+    }
+    return mask;
+}
+
+ChipLedger Inventory::GetChipLedger() const {
+    ChipLedger ledger;
+    for (size_t i = 0; i < stacks.size(); i++) {
+        const Chip* chip = stacks[i].item ? stacks[i].item->As<Chip>() : nullptr;
+        if (chip) {
+            ledger.Add(chip->value, stacks[i].count);
+        }
+    }
+    return ledger;
+}
+
+int Inventory::FindChipStack(int value) const {
+    for (size_t i = 0; i < stacks.size(); i++) {
+        const Chip* chip = stacks[i].item ? stacks[i].item->As<Chip>() : nullptr;
+        if (chip) {
+            if (chip->value == value) return i;
+        }
+    }
+    return -1;
+}
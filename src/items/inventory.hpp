@@ -2,7 +2,9 @@
 #define INVENTORY_HPP
 
 #include <vector>
-#include <string>
+#include "gameplay/card_mask.hpp"
+#include "gameplay/chip_ledger.hpp"
+#include "core/type_id.hpp"
 
 // Forward declaration to avoid circular dependency
 class Item;
@@ -11,11 +13,11 @@ class ItemStack {
 public:
     Item* item;           // First item in stack
     int count;            // Number of items in stack
-    std::string typeString;  // Full type identifier (e.g., "card_spades_ace" or "chip_5")
-    
-    ItemStack() : item(nullptr), count(0), typeString("") {}
-    ItemStack(Item* i, int c, const std::string& type) 
-        : item(i), count(c), typeString(type) {}
+    int stackKey;         // Item::GetStackKey() - equal keys share a stack (item->GetType() names it when debugging)
+
+    ItemStack() : item(nullptr), count(0), stackKey(0) {}
+    ItemStack(Item* i, int c, int key)
+        : item(i), count(c), stackKey(key) {}
 };
 
 class Inventory {
@@ -28,6 +30,7 @@ public:
     
     bool AddItem(Item* item);
     bool RemoveItem(int stackIndex);
+    bool SetStackCount(int stackIndex, int count);  // Count <= 0 removes the stack (item is not deleted)
     void Cleanup();
     void Sort();  // Sort inventory by type: weapons, cards (by rank), chips (by value)
     
@@ -40,9 +43,12 @@ public:
     const std::vector<ItemStack>& GetStacks() const { return stacks; }
     
     // Helper methods to reduce code duplication
-    int CountItemsByType(const std::string& typeSubstring) const;
-    std::vector<int> GetIndicesByType(const std::string& typeSubstring) const;
+    int CountItemsByType(ObjectTypeId type) const;
+    std::vector<int> GetIndicesByType(ObjectTypeId type) const;
     int GetTotalChipValue() const;  // Get total value of all chips in inventory
+    CardMask GetCardMask() const;   // All cards in inventory as a bitboard
+    ChipLedger GetChipLedger() const;  // Chips in inventory as denomination counts
+    int FindChipStack(int value) const;  // Stack index holding chips of this value, or -1
 };
 
 #endif
@@ -5,6 +5,8 @@
 
 class Item : public Interactable {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_ITEM, Interactable)
+
     bool usable;  // Can this item be used via left click? (weapons=true, substances=true, cards/chips=false)
 
     Item(Vector3 pos = {0.0f, 0.0f, 0.0f});
@@ -17,6 +19,10 @@ public:
     // Default: true (stackable). Override in derived classes for unique items.
     virtual bool CanStack() const { return true; }
 
+    // Stackable items with equal keys share an inventory slot
+    // Default: one stack per class. Override when instances differ (e.g., chip value).
+    virtual int GetStackKey() const { return GetTypeId(); }
+
     // Virtual method to get display count text for inventory UI
     // Default: show stack count if > 1. Override for custom display (e.g., ammo count).
     virtual const char* GetDisplayCount(int stackCount) const;
@@ -8,6 +8,8 @@
 // This is a marker class that provides common functionality for all lights
 class Light : public Object {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_LIGHT, Object)
+
     Light(Vector3 position);
     virtual ~Light();
     
@@ -9,6 +9,8 @@ private:
     void* raylibLightPtr;  // Opaque pointer to raylib Light struct
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_LIGHT_BULB, Light)
+
     LightBulb(Vector3 position, Color lightColor);
     virtual ~LightBulb();
 
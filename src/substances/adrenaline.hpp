@@ -5,6 +5,8 @@
 
 class Adrenaline : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_ADRENALINE, Substance)
+
     Adrenaline(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Adrenaline();
 
@@ -5,6 +5,8 @@
 
 class Cocaine : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_COCAINE, Substance)
+
     Cocaine(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Cocaine();
 
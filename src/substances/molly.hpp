@@ -5,6 +5,8 @@
 
 class Molly : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_MOLLY, Substance)
+
     Molly(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Molly();
 
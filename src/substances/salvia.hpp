@@ -5,6 +5,8 @@
 
 class Salvia : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_SALVIA, Substance)
+
     Salvia(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Salvia();
 
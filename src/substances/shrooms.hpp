@@ -5,6 +5,8 @@
 
 class Shrooms : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_SHROOMS, Substance)
+
     Shrooms(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Shrooms();
 
@@ -11,6 +11,8 @@ protected:
     Color color;  // Visual color of the substance
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_SUBSTANCE, Item)
+
     Substance(Vector3 pos, Color substanceColor, PhysicsWorld* physics = nullptr);
     virtual ~Substance();
 
@@ -5,6 +5,8 @@
 
 class Vodka : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_VODKA, Substance)
+
     Vodka(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Vodka();
 
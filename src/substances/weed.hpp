@@ -5,6 +5,8 @@
 
 class Weed : public Substance {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_WEED, Substance)
+
     Weed(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Weed();
 
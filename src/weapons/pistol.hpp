@@ -5,6 +5,8 @@
 
 class Pistol : public Weapon {
 public:
+    DECLARE_OBJECT_TYPE(TYPE_PISTOL, Weapon)
+
     Pistol(Vector3 pos = {0.0f, 0.0f, 0.0f}, PhysicsWorld* physics = nullptr);
     virtual ~Pistol();
 
@@ -61,43 +61,40 @@ Person* Weapon::PerformRaycast(Vector3 rayStart, Vector3 rayDirection, Person* s
     Person* hitPerson = nullptr;
     float closestHit = maxDistance;
 
-    for (int i = 0; i < dom->GetCount(); i++) {
-        Object* obj = dom->GetObject(i);
-        if (!obj) continue;
-
-        std::string type = obj->GetType();
-        if (type.find("person") != std::string::npos) {
-            Person* person = static_cast<Person*>(obj);
-            
-            // Don't shoot yourself!
-            if (person == shooter) continue;
-
-            // Cylinder collision: check if ray intersects the person's hitbox
-            float personHeight = person->GetHeight();
-            float personTopY = person->position.y + 2.4f * personHeight;
-            float personBottomY = person->position.y;
-            float hitRadius = 0.5f;
-
-            // For each point along the ray, check cylinder intersection
-            for (float dist = 0; dist < maxDistance; dist += 0.1f) {
-                Vector3 rayPoint = {
-                    rayStart.x + rayDirection.x * dist,
-                    rayStart.y + rayDirection.y * dist,
-                    rayStart.z + rayDirection.z * dist
-                };
-
-                // Check if within height range
-                if (rayPoint.y >= personBottomY && rayPoint.y <= personTopY) {
-                    // Check horizontal distance
-                    float dx = rayPoint.x - person->position.x;
-                    float dz = rayPoint.z - person->position.z;
-                    float horizontalDist = sqrtf(dx*dx + dz*dz);
-
-                    if (horizontalDist < hitRadius && dist < closestHit) {
-                        hitPerson = person;
-                        closestHit = dist;
-                        break;  // Hit this person, stop checking this person
-                    }
+    // Only people whose bounds the ray passes near need the cylinder test
+    dom->QueryRay(rayStart, rayDirection, maxDistance, 0.0f, candidates, TypeBit(TYPE_PERSON));
+
+    for (Object* obj : candidates) {
+        Person* person = static_cast<Person*>(obj);
+
+        // Don't shoot yourself!
+        if (person == shooter) continue;
+
+        // Cylinder collision: check if ray intersects the person's hitbox
+        float personHeight = person->GetHeight();
+        float personTopY = person->position.y + 2.4f * personHeight;
+        float personBottomY = person->position.y;
+        float hitRadius = 0.5f;
+
+        // For each point along the ray, check cylinder intersection
+        for (float dist = 0; dist < maxDistance; dist += 0.1f) {
+            Vector3 rayPoint = {
+                rayStart.x + rayDirection.x * dist,
+                rayStart.y + rayDirection.y * dist,
+                rayStart.z + rayDirection.z * dist
+            };
+
+            // Check if within height range
+            if (rayPoint.y >= personBottomY && rayPoint.y <= personTopY) {
+                // Check horizontal distance
+                float dx = rayPoint.x - person->position.x;
+                float dz = rayPoint.z - person->position.z;
+                float horizontalDist = sqrtf(dx*dx + dz*dz);
+
+                if (horizontalDist < hitRadius && dist < closestHit) {
+                    hitPerson = person;
+                    closestHit = dist;
+                    break;  // Hit this person, stop checking this person
                 }
             }
         }
@@ -4,14 +4,18 @@
 #include "items/item.hpp"
 #include "core/rigidbody.hpp"
 #include "core/physics.hpp"
+#include <vector>
 
 class Weapon : public Item {
 protected:
     int ammo;
     int maxAmmo;
     RigidBody* rigidBody;
+    std::vector<Object*> candidates;   // Reused DOM query results for PerformRaycast
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_WEAPON, Item)
+
     Weapon(Vector3 pos, int initialAmmo, int maxAmmoCapacity, PhysicsWorld* physics = nullptr);
     virtual ~Weapon();
 
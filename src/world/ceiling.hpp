@@ -4,6 +4,7 @@
 #include "core/physics.hpp"
 #include "core/collider.hpp"
 #include "raylib.h"
+#include <cmath>
 
 class Ceiling : public Object {
 private:
@@ -13,12 +14,15 @@ private:
     Model model;
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_CEILING, Object)
+
     Ceiling(Vector3 position, Vector2 ceilingSize, Color ceilingColor, PhysicsWorld* physicsWorld);
     virtual ~Ceiling();
     
     // Override virtual functions
     void Draw(Camera3D camera) override;
     std::string GetType() const override;
+    float GetBoundingRadius() const override { return 0.5f * sqrtf(size.x * size.x + size.y * size.y); }
     
     // Accessor for collider
     Collider* GetCollider() { return &collider; }
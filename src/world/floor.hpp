@@ -4,6 +4,7 @@
 #include "core/physics.hpp"
 #include "core/collider.hpp"
 #include "raylib.h"
+#include <cmath>
 
 class Floor : public Object {
 private:
@@ -13,12 +14,15 @@ private:
     Model model;
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_FLOOR, Object)
+
     Floor(Vector3 position, Vector2 floorSize, Color floorColor, PhysicsWorld* physicsWorld);
     virtual ~Floor();
     
     // Override virtual functions
     void Draw(Camera3D camera) override;
     std::string GetType() const override;
+    float GetBoundingRadius() const override { return 0.5f * sqrtf(size.x * size.x + size.y * size.y); }
     
     // Accessor for collider
     Collider* GetCollider() { return &collider; }
@@ -13,6 +13,8 @@ private:
     void PerformSpawn();
 
 public:
+    DECLARE_OBJECT_TYPE(TYPE_SPAWNER, Object)
+
     // Constructor: spawns 'spawnCount' copies of 'obj' within 'spawnRadius'
     Spawner(Vector3 pos, float spawnRadius, Object* obj, int spawnCount);
     
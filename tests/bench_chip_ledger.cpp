@@ -0,0 +1,25 @@
+#include "catch_amalgamated.hpp"
+
+#include "gameplay/chip_ledger.hpp"
+
+// Chip breakdowns for bets and payouts (what PokerTable's old CalculateChipCombination did, now ChipLedger)
+TEST_CASE("ChipLedger - Chip combinations", "[benchmark][chip_ledger]") {
+    BENCHMARK("FromAmount for amounts 1..10k") {
+        int chips = 0;
+        for (int amount = 1; amount <= 10000; amount++) {
+            const ChipLedger ledger = ChipLedger::FromAmount(amount);
+            for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) chips += ledger.counts[d];
+        }
+        return chips;
+    };
+
+    BENCHMARK("Withdraw 10k bets with change") {
+        ChipLedger bankroll = ChipLedger::FromAmount(1000000);
+        int paidTotal = 0;
+        for (int bet = 1; bet <= 10000; bet++) {
+            ChipLedger paid;
+            if (bankroll.Withdraw(bet % 137 + 1, paid)) paidTotal += paid.Total();
+        }
+        return paidTotal;
+    };
+}
@@ -0,0 +1,32 @@
+#include "catch_amalgamated.hpp"
+
+#include "items/deck.hpp"
+
+// A 6-handed deal off the table deck: 12 hole cards + 5 board
+static int DealHand(Deck& deck) {
+    deck.Reset();
+    deck.Shuffle();
+    int checksum = 0;
+    for (int c = 0; c < 17; c++) {
+        checksum += deck.DrawCard()->GetIndex();
+    }
+    return checksum;
+}
+
+TEST_CASE("Deck - Shuffle and draw", "[benchmark][deck]") {
+    Deck deck;
+    deck.Seed(3);
+
+    BENCHMARK("Shuffle and draw 1k 6-handed hands") {
+        int checksum = 0;
+        for (int h = 0; h < 1000; h++) checksum += DealHand(deck);
+        return checksum;
+    };
+
+    BENCHMARK("Draw the whole deck unshuffled") {
+        Deck fresh;
+        int drawn = 0;
+        while (fresh.DrawCard()) drawn++;
+        return drawn;
+    };
+}
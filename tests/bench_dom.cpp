@@ -0,0 +1,127 @@
+#include "catch_amalgamated.hpp"
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "core/dom.hpp"
+#include "core/object.hpp"
+#include "core/rng.hpp"
+
+#define BENCH_DOM_OBJECTS 2000
+
+TEST_CASE("DOM - Add and remove", "[benchmark][dom]") {
+    std::vector<Object*> objects;
+    for (int i = 0; i < BENCH_DOM_OBJECTS; i++) {
+        objects.push_back(new Object({(float)i, 0, 0}));
+    }
+
+    BENCHMARK("AddObject 2000 objects") {
+        DOM dom;
+        for (Object* obj : objects) dom.AddObject(obj);
+        int count = dom.GetCount();
+        dom.Cleanup();
+        return count;
+    };
+
+    // Removal is a swap with the last object, so both ends should cost the same
+    BENCHMARK("RemoveObject 2000 objects, oldest first") {
+        DOM dom;
+        for (Object* obj : objects) dom.AddObject(obj);
+        for (Object* obj : objects) dom.RemoveObject(obj);
+        return dom.GetCount();
+    };
+
+    BENCHMARK("RemoveObject 2000 objects, newest first") {
+        DOM dom;
+        for (Object* obj : objects) dom.AddObject(obj);
+        for (int i = BENCH_DOM_OBJECTS - 1; i >= 0; i--) dom.RemoveObject(objects[i]);
+        return dom.GetCount();
+    };
+
+    BENCHMARK("AddObjects/RemoveObjects 2000 objects, deferred") {
+        DOM dom;
+        dom.AddObjects(objects);
+        dom.BeginDeferred();
+        dom.RemoveObjects(objects);
+        dom.Sync();
+        return dom.GetCount();
+    };
+
+    BENCHMARK("FindObjectByID over 2000 objects") {
+        DOM dom;
+        for (Object* obj : objects) dom.AddObject(obj);
+        Object* found = dom.FindObjectByID(objects[BENCH_DOM_OBJECTS / 2]->GetID());
+        dom.Cleanup();
+        return found;
+    };
+
+    for (Object* obj : objects) delete obj;
+}
+
+// ========== SPATIAL QUERIES ==========
+
+#define BENCH_SPATIAL_DENSITY 1.0f   // Items per square world unit, kept constant as the room grows
+
+// Items scattered over a square room sized for a constant density, so a fixed-size query
+// touches about the same number of items at 1k and 10k - only the linear scan should slow down
+static std::vector<Object*> ScatterRoom(int count, uint64_t seed) {
+    Rng rng(seed);
+    float side = sqrtf(count / BENCH_SPATIAL_DENSITY);
+    std::vector<Object*> objects;
+    for (int i = 0; i < count; i++) {
+        objects.push_back(new Object({(float)(rng.NextDouble() * side), 0.5f, (float)(rng.NextDouble() * side)}));
+    }
+    return objects;
+}
+
+static void BenchSpatialQueries(int count, bool indexed) {
+    std::vector<Object*> objects = ScatterRoom(count, 7);
+    DOM dom;
+    dom.SetSpatialIndexEnabled(indexed);
+    for (Object* obj : objects) dom.AddObject(obj);
+
+    float side = sqrtf(count / BENCH_SPATIAL_DENSITY);
+    Vector3 center = {side * 0.5f, 1.0f, side * 0.5f};
+    Vector3 forward = {1.0f, 0.0f, 0.0f};
+    std::vector<Object*> found;
+    std::string suffix = std::to_string(count) + (indexed ? " items, grid" : " items, linear");
+
+    BENCHMARK("QuerySphere r=3, " + suffix) {
+        dom.QuerySphere(center, 3.0f, found);
+        return found.size();
+    };
+
+    BENCHMARK("QueryCone 5m 15deg, " + suffix) {
+        dom.QueryCone(center, forward, 5.0f, 0.26f, found);
+        return found.size();
+    };
+
+    // Interaction-length ray, like Player::GetClosestInteractable
+    BENCHMARK("QueryRay 5m, " + suffix) {
+        dom.QueryRay(center, forward, 5.0f, 1.0f, found);
+        return found.size();
+    };
+
+    dom.Cleanup();
+    for (Object* obj : objects) delete obj;
+}
+
+TEST_CASE("DOM - Spatial queries", "[benchmark][dom][spatial_grid]") {
+    BenchSpatialQueries(1000, false);
+    BenchSpatialQueries(1000, true);
+    BenchSpatialQueries(10000, false);
+    BenchSpatialQueries(10000, true);
+
+    std::vector<Object*> objects = ScatterRoom(10000, 7);
+    DOM dom;
+    for (Object* obj : objects) dom.AddObject(obj);
+
+    // Per-frame upkeep when nothing crossed a cell boundary
+    BENCHMARK("UpdateSpatialIndex 10000 items, at rest") {
+        dom.UpdateSpatialIndex();
+        return dom.GetCount();
+    };
+
+    dom.Cleanup();
+    for (Object* obj : objects) delete obj;
+}
@@ -0,0 +1,90 @@
+#include "catch_amalgamated.hpp"
+#include <chrono>
+#include <cstdio>
+
+#include "core/thread_pool.hpp"
+#include "gameplay/equity_engine.hpp"
+
+#define BENCH_EQUITY_SAMPLES 200000
+
+static void ReportSampleRate(const char* label, const EquityRequest& request, ThreadPool* pool) {
+    int threads = pool ? pool->GetThreadCount() : 1;
+
+    auto start = std::chrono::steady_clock::now();
+    EquityResult result = EquityEngine::Calculate(request, pool);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double samplesPerSecond = result.samples / seconds;
+    printf("%-28s %8.2f M samples/sec  %6.2f M/sec/core  (%d threads, equity %.3f)\n",
+           label, samplesPerSecond / 1e6, samplesPerSecond / threads / 1e6, threads, result.equity);
+}
+
+TEST_CASE("EquityEngine - Throughput", "[benchmark][equity_engine]") {
+    EquityRequest request;
+    request.hole = CardMask::FromIndex(CardMask::CardIndex(0, 1)) | CardMask::FromIndex(CardMask::CardIndex(1, 13));
+    request.maxSamples = BENCH_EQUITY_SAMPLES;
+    request.seed = 1;
+
+    BENCHMARK("Preflop heads-up 200k samples (1 thread)") {
+        request.opponents = 1;
+        return EquityEngine::Calculate(request, nullptr).equity;
+    };
+
+    request.opponents = 1;
+    ReportSampleRate("Equity heads-up, 1 thread", request, nullptr);
+    ReportSampleRate("Equity heads-up, pool", request, ThreadPool::GetGlobal());
+
+    request.opponents = 5;
+    ReportSampleRate("Equity 6-way, 1 thread", request, nullptr);
+    ReportSampleRate("Equity 6-way, pool", request, ThreadPool::GetGlobal());
+}
+
+// Late streets: enumerating every completion against sampling the same spot
+TEST_CASE("EquityEngine - Exact against sampling", "[benchmark][equity_engine]") {
+    EquityRequest request;
+    request.hole = CardMask::FromIndex(CardMask::CardIndex(0, 1)) | CardMask::FromIndex(CardMask::CardIndex(0, 13));
+    request.board = CardMask::FromIndex(CardMask::CardIndex(0, 12)) | CardMask::FromIndex(CardMask::CardIndex(1, 5)) |
+                    CardMask::FromIndex(CardMask::CardIndex(2, 9));
+    request.opponents = 1;
+    request.maxSamples = 10000;
+    request.seed = 1;
+
+    BENCHMARK("Flop heads-up, exact (1 thread)") {
+        return EquityEngine::Enumerate(request, nullptr).equity;
+    };
+
+    // Monotone flop: three interchangeable suits fold most runouts together
+    CardMask monotone = CardMask::FromIndex(CardMask::CardIndex(0, 12)) |
+                        CardMask::FromIndex(CardMask::CardIndex(0, 5)) | CardMask::FromIndex(CardMask::CardIndex(0, 9));
+    CardMask flop = request.board;
+    request.board = monotone;
+    BENCHMARK("Monotone flop heads-up, exact (1 thread)") {
+        return EquityEngine::Enumerate(request, nullptr).equity;
+    };
+    request.board = flop;
+
+    request.board.Add(CardMask::CardIndex(3, 7));
+    BENCHMARK("Turn heads-up, exact (1 thread)") {
+        return EquityEngine::Enumerate(request, nullptr).equity;
+    };
+    BENCHMARK("Turn heads-up, 10k samples (1 thread)") {
+        return EquityEngine::Sample(request, nullptr).equity;
+    };
+
+    request.board.Add(CardMask::CardIndex(1, 2));
+    BENCHMARK("River heads-up, exact (1 thread)") {
+        return EquityEngine::Enumerate(request, nullptr).equity;
+    };
+    BENCHMARK("River heads-up, 10k samples (1 thread)") {
+        return EquityEngine::Sample(request, nullptr).equity;
+    };
+
+    request.opponents = 2;
+    BENCHMARK("River 3-way, exact (1 thread)") {
+        return EquityEngine::Enumerate(request, nullptr).equity;
+    };
+    BENCHMARK("River 3-way, 10k samples (1 thread)") {
+        return EquityEngine::Sample(request, nullptr).equity;
+    };
+}
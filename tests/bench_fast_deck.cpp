@@ -0,0 +1,35 @@
+#include "catch_amalgamated.hpp"
+#include <chrono>
+#include <cstdio>
+
+#include "gameplay/fast_deck.hpp"
+
+#define BENCH_DEAL_HANDS 2000000
+
+// Deal a 6-handed hand (12 hole cards + 5 board) per iteration
+static int DealHands(FastDeck& deck, int handCount) {
+    int checksum = 0;
+    for (int h = 0; h < handCount; h++) {
+        deck.Reset();
+        for (int c = 0; c < 17; c++) {
+            checksum += deck.Deal();
+        }
+    }
+    return checksum;
+}
+
+TEST_CASE("FastDeck - Throughput", "[benchmark][fast_deck]") {
+    FastDeck deck(1);
+
+    BENCHMARK("Deal 10k 6-handed hands") {
+        return DealHands(deck, 10000);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    int checksum = DealHands(deck, BENCH_DEAL_HANDS);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("%-28s %8.2f M deals/sec (%.1f M cards/sec, checksum %d)\n", "FastDeck 17-card deals",
+           BENCH_DEAL_HANDS / seconds / 1e6, BENCH_DEAL_HANDS * 17 / seconds / 1e6, checksum);
+}
@@ -0,0 +1,120 @@
+#include "catch_amalgamated.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "gameplay/hand_evaluator.hpp"
+
+#define BENCH_HAND_COUNT 100000
+
+// Pre-generate random 7-card hands so the timed loops only measure evaluation
+static std::vector<int> GenerateHands(int handCount, int cardsPerHand) {
+    std::mt19937 rng(42);
+    int deck[NUM_CARDS];
+    for (int i = 0; i < NUM_CARDS; i++) deck[i] = i;
+
+    std::vector<int> hands;
+    hands.reserve(handCount * cardsPerHand);
+    for (int h = 0; h < handCount; h++) {
+        // Partial shuffle - only the first cardsPerHand positions matter
+        for (int i = 0; i < cardsPerHand; i++) {
+            std::uniform_int_distribution<int> pick(i, NUM_CARDS - 1);
+            std::swap(deck[i], deck[pick(rng)]);
+            hands.push_back(deck[i]);
+        }
+    }
+    return hands;
+}
+
+static uint32_t EvaluateAll(const std::vector<int>& hands, int cardsPerHand) {
+    uint32_t checksum = 0;
+    for (size_t i = 0; i < hands.size(); i += cardsPerHand) {
+        checksum += HandEvaluator::Evaluate(&hands[i], cardsPerHand);
+    }
+    return checksum;
+}
+
+// Same hands as bitboards - the form simulations pass around
+static std::vector<CardMask> ToMasks(const std::vector<int>& hands, int cardsPerHand) {
+    std::vector<CardMask> masks;
+    masks.reserve(hands.size() / cardsPerHand);
+    for (size_t i = 0; i < hands.size(); i += cardsPerHand) {
+        CardMask mask;
+        for (int c = 0; c < cardsPerHand; c++) mask.Add(hands[i + c]);
+        masks.push_back(mask);
+    }
+    return masks;
+}
+
+static uint32_t EvaluateAll(const std::vector<CardMask>& masks) {
+    uint32_t checksum = 0;
+    for (CardMask mask : masks) {
+        checksum += HandEvaluator::Evaluate(mask);
+    }
+    return checksum;
+}
+
+// Same masks through the batch API (whatever kernel is active)
+static uint32_t EvaluateAllBatched(const std::vector<CardMask>& masks, std::vector<HandStrength>& out) {
+    HandEvaluator::EvaluateBatch(masks.data(), (int)masks.size(), out.data());
+    uint32_t checksum = 0;
+    for (HandStrength strength : out) checksum += strength;
+    return checksum;
+}
+
+template <typename Fn>
+static void ReportThroughput(const char* label, Fn evaluateAll) {
+    const int repeats = 20;
+    uint32_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        checksum += evaluateAll();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double handsPerSecond = (double)BENCH_HAND_COUNT * repeats / seconds;
+    printf("%-28s %8.2f M hands/sec (checksum %u)\n", label, handsPerSecond / 1e6, checksum);
+}
+
+TEST_CASE("HandEvaluator - Throughput", "[benchmark][hand_evaluator]") {
+    std::vector<int> fiveCardHands = GenerateHands(BENCH_HAND_COUNT, 5);
+    std::vector<int> sevenCardHands = GenerateHands(BENCH_HAND_COUNT, 7);
+    std::vector<CardMask> sevenCardMasks = ToMasks(sevenCardHands, 7);
+
+    BENCHMARK("Evaluate 100k 5-card hands") {
+        return EvaluateAll(fiveCardHands, 5);
+    };
+
+    BENCHMARK("Evaluate 100k 7-card hands") {
+        return EvaluateAll(sevenCardHands, 7);
+    };
+
+    BENCHMARK("Evaluate 100k 7-card masks") {
+        return EvaluateAll(sevenCardMasks);
+    };
+
+    ReportThroughput("HandEvaluator 5-card", [&] { return EvaluateAll(fiveCardHands, 5); });
+    ReportThroughput("HandEvaluator 7-card", [&] { return EvaluateAll(sevenCardHands, 7); });
+    ReportThroughput("HandEvaluator 7-card mask", [&] { return EvaluateAll(sevenCardMasks); });
+
+    // Batch throughput per kernel this CPU can run (checksums must all agree with the scalar loop)
+    std::vector<HandStrength> batchOut(sevenCardMasks.size());
+    EvaluatorKernel original = HandEvaluator::GetKernel();
+    const EvaluatorKernel kernels[] = {KERNEL_SCALAR, KERNEL_SSE4, KERNEL_AVX2};
+    for (EvaluatorKernel kernel : kernels) {
+        if (!HandEvaluator::SetKernel(kernel)) continue;
+
+        char label[64];
+        snprintf(label, sizeof(label), "EvaluateBatch 7-card %s", HandEvaluator::GetKernelName(kernel));
+        ReportThroughput(label, [&] { return EvaluateAllBatched(sevenCardMasks, batchOut); });
+    }
+    HandEvaluator::SetKernel(original);
+
+    BENCHMARK("EvaluateBatch 100k 7-card masks") {
+        return EvaluateAllBatched(sevenCardMasks, batchOut);
+    };
+}
@@ -0,0 +1,79 @@
+#include "catch_amalgamated.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "gameplay/hand_history.hpp"
+
+#define BENCH_HISTORY_BASE "bench_hand_history_tmp"
+#define BENCH_HISTORY_HANDS 200000
+
+// Record a long scripted session (calls with the odd min-raise) for the reader to scan
+static uint64_t RecordSession(int hands) {
+    PokerEngine engine(3);
+    for (int i = 0; i < 6; i++) engine.SitDown(i, 1000000);
+
+    HandHistoryRecorder history;
+    history.Open(BENCH_HISTORY_BASE);
+    Rng rng(4);
+    for (int h = 0; h < hands; h++) {
+        if (!engine.StartHand()) break;
+        history.BeginHand(engine);
+        while (engine.IsBetting()) {
+            PokerAction action(ACTION_CALL);
+            if (rng.Below(8) == 0) action = PokerAction(ACTION_RAISE, engine.GetMinRaise());
+            history.RecordAction(engine.GetCurrentSeat(), engine.GetPhase(), action);
+            engine.ApplyAction(action);
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) engine.ResolveShowdown();
+        history.EndHand(engine);
+    }
+    return history.GetHandCount();
+}
+
+// Scan every segment, touching each header and action
+static long long ScanHistory(uint64_t& hands) {
+    long long checksum = 0;
+    hands = 0;
+    for (const std::string& path : HandHistoryReader::ListSegments(BENCH_HISTORY_BASE)) {
+        HandHistoryReader reader;
+        if (!reader.Open(path)) continue;
+        HandView hand;
+        while (reader.Next(hand)) {
+            for (int i = 0; i < MAX_SEATS; i++) checksum += hand.header->payouts[i];
+            for (int a = 0; a < hand.header->actionCount; a++) checksum += hand.actions[a].amount;
+            hands++;
+        }
+    }
+    return checksum;
+}
+
+TEST_CASE("HandHistory - Throughput", "[benchmark][hand_history]") {
+    for (const std::string& path : HandHistoryReader::ListSegments(BENCH_HISTORY_BASE)) {
+        std::remove(path.c_str());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t recorded = RecordSession(BENCH_HISTORY_HANDS);
+    auto mid = std::chrono::steady_clock::now();
+    uint64_t scanned = 0;
+    long long checksum = ScanHistory(scanned);
+    auto end = std::chrono::steady_clock::now();
+
+    double playSeconds = std::chrono::duration<double>(mid - start).count();
+    double scanSeconds = std::chrono::duration<double>(end - mid).count();
+    printf("%-28s %8.2f M hands/sec (play + record)\n", "HandHistory record", recorded / playSeconds / 1e6);
+    printf("%-28s %8.2f M hands/sec (%llu hands, checksum %lld)\n", "HandHistory mmap scan",
+           scanned / scanSeconds / 1e6, (unsigned long long)scanned, checksum);
+
+    REQUIRE(scanned == recorded);
+
+    BENCHMARK("Scan recorded history") {
+        uint64_t hands = 0;
+        return ScanHistory(hands);
+    };
+
+    for (const std::string& path : HandHistoryReader::ListSegments(BENCH_HISTORY_BASE)) {
+        std::remove(path.c_str());
+    }
+}
@@ -0,0 +1,54 @@
+#include "catch_amalgamated.hpp"
+#include <chrono>
+#include <cstdio>
+
+#include "gameplay/hand_optimizer.hpp"
+#include "gameplay/fast_deck.hpp"
+
+#define BENCH_OPTIMIZER_SPOTS 2000
+#define BENCH_OPTIMIZER_HELD 47   // Everything left after a full board
+
+struct OptimizerSpot {
+    CardMask held;
+    CardMask board;
+};
+
+static void BuildSpots(OptimizerSpot* spots, int count, int heldCount) {
+    FastDeck deck(7);
+    for (int i = 0; i < count; i++) {
+        deck.Reset();
+        spots[i].board = CardMask();
+        spots[i].held = CardMask();
+        for (int c = 0; c < 5; c++) spots[i].board.Add(deck.Deal());
+        for (int c = 0; c < heldCount; c++) spots[i].held.Add(deck.Deal());
+    }
+}
+
+static void RunSpots(const OptimizerSpot* spots, int count, const char* label) {
+    long long evaluated = 0;
+    HandStrength checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        HandChoice choice = HandOptimizer::BestTwo(spots[i].held, spots[i].board);
+        evaluated += choice.evaluated;
+        checksum ^= choice.strength;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("%-28s %8.2f us/search (%.0f pairs scored, checksum %u)\n", label,
+           seconds / count * 1e6, (double)evaluated / count, checksum);
+}
+
+TEST_CASE("HandOptimizer - Best two of many", "[benchmark][hand_optimizer]") {
+    static OptimizerSpot spots[BENCH_OPTIMIZER_SPOTS];
+
+    BuildSpots(spots, BENCH_OPTIMIZER_SPOTS, 12);
+    RunSpots(spots, BENCH_OPTIMIZER_SPOTS, "Best two of 12 held");
+
+    BuildSpots(spots, BENCH_OPTIMIZER_SPOTS, BENCH_OPTIMIZER_HELD);
+    BENCHMARK("Best two of 47 held") {
+        return HandOptimizer::BestTwo(spots[0].held, spots[0].board).strength;
+    };
+    RunSpots(spots, BENCH_OPTIMIZER_SPOTS, "Best two of 47 held");
+}
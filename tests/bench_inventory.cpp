@@ -0,0 +1,61 @@
+#include "catch_amalgamated.hpp"
+#include <vector>
+
+#include "items/inventory.hpp"
+#include "items/card.hpp"
+#include "items/chip.hpp"
+
+#define BENCH_INVENTORY_CARDS 7
+#define BENCH_INVENTORY_CHIPS 200
+
+// Items a seated player typically carries: a hand's worth of cards and a pile of mixed chips
+struct InventoryItems {
+    std::vector<Item*> items;
+
+    InventoryItems() {
+        const int values[] = {100, 25, 10, 5, 1};
+        for (int i = 0; i < BENCH_INVENTORY_CARDS; i++) {
+            items.push_back(new Card(static_cast<Suit>(i % 4), static_cast<Rank>(RANK_KING - i), {0, 0, 0}, nullptr));
+        }
+        for (int i = 0; i < BENCH_INVENTORY_CHIPS; i++) {
+            items.push_back(new Chip(values[i % 5], {0, 0, 0}, nullptr));
+        }
+    }
+
+    ~InventoryItems() {
+        for (Item* item : items) delete item;
+    }
+};
+
+// Inventory stacks point at items it doesn't own, so the caller's copies are what get deleted
+static void Fill(Inventory& inv, const InventoryItems& source) {
+    for (Item* item : source.items) inv.AddItem(item);
+}
+
+TEST_CASE("Inventory - Hot paths", "[benchmark][inventory]") {
+    InventoryItems source;
+
+    BENCHMARK("AddItem 7 cards + 200 chips") {
+        Inventory inv;
+        Fill(inv, source);
+        int count = inv.GetStackCount();
+        inv.Cleanup();
+        return count;
+    };
+
+    Inventory inv;
+    Fill(inv, source);
+
+    BENCHMARK("Sort a filled inventory") {
+        inv.Sort();
+        return inv.GetStackCount();
+    };
+
+    BENCHMARK("GetTotalChipValue x1000") {
+        int total = 0;
+        for (int i = 0; i < 1000; i++) total += inv.GetTotalChipValue();
+        return total;
+    };
+
+    inv.Cleanup();
+}
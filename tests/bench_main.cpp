@@ -0,0 +1,70 @@
+#define CATCH_CONFIG_RUNNER
+#include "catch_amalgamated.hpp"
+#include "bench_report.hpp"
+#include <cstdio>
+#include <string>
+
+// Global variables needed by the game code
+bool g_showCollisionDebug = false;
+
+// Hands every finished BENCHMARK to BenchReport (Catch's JSON reporter doesn't include them)
+class BenchReportListener : public Catch::EventListenerBase {
+public:
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override {
+        BenchResult result;
+        result.name = stats.info.name;
+        result.meanNs = stats.mean.point.count();
+        result.lowNs = stats.mean.lower_bound.count();
+        result.highNs = stats.mean.upper_bound.count();
+        result.stddevNs = stats.standardDeviation.point.count();
+        result.samples = static_cast<int>(stats.samples.size());
+        BenchReport::Record(result);
+    }
+};
+CATCH_REGISTER_LISTENER(BenchReportListener)
+
+// Extra options on top of Catch's own:
+//   --json FILE         write every benchmark's result to FILE
+//   --compare FILE      compare against a baseline written by --json; exits non-zero on regressions
+//   --threshold PCT     how much slower than the baseline counts as a regression (default 10)
+int main(int argc, char* argv[]) {
+    Catch::Session session;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = BENCH_DEFAULT_THRESHOLD;
+
+    using namespace Catch::Clara;
+    session.cli(session.cli()
+        | Opt(jsonPath, "file")["--json"]("write benchmark results as JSON")
+        | Opt(baselinePath, "file")["--compare"]("compare benchmark results against a baseline JSON file")
+        | Opt(threshold, "percent")["--threshold"]("slowdown that counts as a regression"));
+
+    int parsed = session.applyCommandLine(argc, argv);
+    if (parsed != 0) return parsed;
+
+    // Read the baseline first so a bad path fails before minutes of benchmarking
+    std::vector<BenchResult> baseline;
+    if (!baselinePath.empty() && !BenchReport::ReadJson(baselinePath, baseline)) {
+        fprintf(stderr, "Could not read benchmark baseline: %s\n", baselinePath.c_str());
+        return 1;
+    }
+
+    // Benchmarks only cover headless gameplay code, so no window is needed
+    int result = session.run();
+
+    if (!jsonPath.empty()) {
+        if (!BenchReport::WriteJson(jsonPath, BenchReport::GetResults())) {
+            fprintf(stderr, "Could not write benchmark results: %s\n", jsonPath.c_str());
+            return 1;
+        }
+        printf("Wrote %d benchmark results to %s\n", (int)BenchReport::GetResults().size(), jsonPath.c_str());
+    }
+
+    if (!baselinePath.empty()) {
+        int regressions = BenchReport::Compare(baseline, BenchReport::GetResults(), threshold, stdout);
+        if (regressions > 0 && result == 0) result = 1;
+    }
+    return result;
+}
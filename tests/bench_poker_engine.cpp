@@ -0,0 +1,74 @@
+#include "catch_amalgamated.hpp"
+#include <chrono>
+#include <cstdio>
+
+#include "gameplay/poker_engine.hpp"
+
+#define BENCH_ENGINE_HANDS 200000
+#define BENCH_ENGINE_STACK 1000
+
+// Scripted player: mostly calls, sometimes folds or min-raises (cheap LCG so the policy isn't the bottleneck)
+template <class Engine>
+static PokerAction ScriptedAction(const Engine& engine, uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    uint32_t roll = (state >> 24) % 10;
+    if (roll == 0) return PokerAction(ACTION_FOLD);
+    if (roll == 1) return PokerAction(ACTION_RAISE, engine.GetMinRaise());
+    return PokerAction(ACTION_CALL);
+}
+
+// Play handCount hands with seatCount players on a Seats engine, topping stacks back up when someone busts
+template <int Seats>
+static int PlayHands(int seatCount, int handCount) {
+    PokerEngineT<Seats> engine(12345);
+    for (int i = 0; i < seatCount; i++) {
+        engine.SitDown(i, BENCH_ENGINE_STACK);
+    }
+
+    uint32_t state = 1;
+    int showdowns = 0;
+    for (int h = 0; h < handCount; h++) {
+        if (!engine.StartHand()) {
+            for (int i = 0; i < seatCount; i++) engine.SetStack(i, BENCH_ENGINE_STACK);
+            engine.StartHand();
+        }
+        while (engine.IsBetting()) {
+            engine.ApplyAction(ScriptedAction(engine, state));
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) {
+            engine.ResolveShowdown();
+            showdowns++;
+        }
+    }
+    return showdowns;
+}
+
+template <int Seats>
+static void ReportHandRate(const char* label, int seatCount) {
+    auto start = std::chrono::steady_clock::now();
+    int showdowns = PlayHands<Seats>(seatCount, BENCH_ENGINE_HANDS);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("%-28s %8.2f M hands/sec (%d showdowns)\n", label, BENCH_ENGINE_HANDS / seconds / 1e6, showdowns);
+}
+
+TEST_CASE("PokerEngine - Throughput", "[benchmark][poker_engine]") {
+    BENCHMARK("Play 10k heads-up hands") {
+        return PlayHands<2>(2, 10000);
+    };
+
+    BENCHMARK("Play 10k 8-handed hands") {
+        return PlayHands<8>(8, 10000);
+    };
+
+    ReportHandRate<2>("PokerEngine heads-up", 2);
+    ReportHandRate<6>("PokerEngine 6-max", 6);
+    ReportHandRate<8>("PokerEngine 8-max", 8);
+    ReportHandRate<9>("PokerEngine 9-max", 9);
+    ReportHandRate<10>("PokerEngine 10-max", 10);
+
+    // Same hands on the widest engine (what a live table runs on)
+    ReportHandRate<MAX_SEATS>("TableEngine heads-up", 2);
+    ReportHandRate<MAX_SEATS>("TableEngine 6-handed", 6);
+}
@@ -0,0 +1,94 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gameplay/poker_table.hpp"
+#include "entities/enemy.hpp"
+#include "items/chip.hpp"
+#include "core/dom.hpp"
+
+#define BENCH_ROOM_TABLES 48
+#define BENCH_HAND_CHIPS 1000   // 100-value chips per player: deep enough that checking down never busts anyone
+
+// Person who checks or calls the moment they're asked, so one Update plays a whole hand
+class CallingPerson : public Person {
+public:
+    CallingPerson(Vector3 pos, const std::string& personName) : Person(pos, personName) {}
+
+    int PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) override {
+        (void)currentBet; (void)callAmount; (void)maxRaise;
+        raiseAmount = minRaise;
+        return 1;
+    }
+};
+
+// A room of tables, each waiting on an enemy who is still thinking - the common case every frame
+TEST_CASE("PokerTable - Room update", "[benchmark][poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    std::vector<PokerTable*> tables;
+    std::vector<Enemy*> enemies;
+    for (int t = 0; t < BENCH_ROOM_TABLES; t++) {
+        PokerTable* table = new PokerTable({t * 10.0f, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+        dom.AddObject(table);
+        tables.push_back(table);
+
+        for (int s = 0; s < 2; s++) {
+            Enemy* enemy = new Enemy({t * 10.0f, 0, 0});
+            for (int c = 0; c < 5; c++) {
+                enemy->GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+            }
+            table->SeatPerson(enemy, s);
+            enemies.push_back(enemy);
+        }
+        table->Update(0.016f);  // Deal - the first enemy starts thinking
+    }
+
+    BENCHMARK("Update 48 tables waiting on a decision") {
+        int waiting = 0;
+        for (PokerTable* table : tables) {
+            table->Update(0.016f);
+            waiting += table->GetState() == TABLE_AWAIT_BET;
+        }
+        return waiting;
+    };
+
+    for (int t = 0; t < BENCH_ROOM_TABLES; t++) {
+        tables[t]->UnseatPerson(enemies[2 * t]);
+        tables[t]->UnseatPerson(enemies[2 * t + 1]);
+    }
+    for (Enemy* enemy : enemies) delete enemy;
+    dom.Cleanup();
+    for (PokerTable* table : tables) delete table;
+}
+
+// Deal, bet every street, show down and pay out - the table side of a hand with no thinking delay
+TEST_CASE("PokerTable - Full headless hand", "[benchmark][poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+
+    CallingPerson alice({0, 0, 0}, "Alice");
+    CallingPerson bob({1, 0, 0}, "Bob");
+    Chip aliceChip(100, {0, 0, 0}, nullptr);
+    Chip bobChip(100, {0, 0, 0}, nullptr);
+    alice.GetInventory()->AddItem(&aliceChip);
+    bob.GetInventory()->AddItem(&bobChip);
+    alice.GetInventory()->SetStackCount(0, BENCH_HAND_CHIPS);
+    bob.GetInventory()->SetStackCount(0, BENCH_HAND_CHIPS);
+    table.SeatPerson(&alice, 0);
+    table.SeatPerson(&bob, 1);
+
+    BENCHMARK("Play one heads-up hand through PokerTable") {
+        table.Update(0.016f);
+        return table.GetEngine().GetPhase();
+    };
+
+    table.UnseatPerson(&alice);
+    table.UnseatPerson(&bob);
+    dom.Cleanup();
+}
@@ -0,0 +1,159 @@
+#include "bench_report.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+static std::vector<BenchResult> results;
+
+// ========== RESULTS ==========
+
+void BenchReport::Record(const BenchResult& result) {
+    results.push_back(result);
+}
+
+const std::vector<BenchResult>& BenchReport::GetResults() {
+    return results;
+}
+
+void BenchReport::Clear() {
+    results.clear();
+}
+
+// ========== JSON ==========
+
+static void AppendString(std::string& out, const std::string& value) {
+    out += '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (c == '\n') {
+            out += "\\n";
+            continue;
+        }
+        out += c;
+    }
+    out += '"';
+}
+
+static void AppendNumber(std::string& out, const char* key, double value) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), ", \"%s\": %.3f", key, value);
+    out += buffer;
+}
+
+std::string BenchReport::ToJson(const std::vector<BenchResult>& list) {
+    std::string out = "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < list.size(); i++) {
+        const BenchResult& r = list[i];
+        out += "    {\"name\": ";
+        AppendString(out, r.name);
+        AppendNumber(out, "mean_ns", r.meanNs);
+        AppendNumber(out, "low_ns", r.lowNs);
+        AppendNumber(out, "high_ns", r.highNs);
+        AppendNumber(out, "stddev_ns", r.stddevNs);
+        out += ", \"samples\": " + std::to_string(r.samples) + "}";
+        out += (i + 1 < list.size()) ? ",\n" : "\n";
+    }
+    out += "  ]\n}\n";
+    return out;
+}
+
+bool BenchReport::WriteJson(const std::string& path, const std::vector<BenchResult>& list) {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    std::string json = ToJson(list);
+    bool ok = fwrite(json.data(), 1, json.size(), f) == json.size();
+    return fclose(f) == 0 && ok;
+}
+
+// Value of "key": <number> inside [begin, end) of text
+static bool FindNumber(const std::string& text, size_t begin, size_t end, const char* key, double& value) {
+    std::string pattern = std::string("\"") + key + "\":";
+    size_t at = text.find(pattern, begin);
+    if (at == std::string::npos || at >= end) return false;
+    const char* start = text.c_str() + at + pattern.size();
+    char* stop = nullptr;
+    value = strtod(start, &stop);
+    return stop != start;
+}
+
+bool BenchReport::ParseJson(const std::string& text, std::vector<BenchResult>& out) {
+    out.clear();
+    if (text.find("\"benchmarks\"") == std::string::npos) return false;
+
+    const std::string nameKey = "\"name\":";
+    size_t at = text.find(nameKey);
+    while (at != std::string::npos) {
+        size_t pos = text.find('"', at + nameKey.size());
+        if (pos == std::string::npos) return false;
+
+        // Unescape the name up to its closing quote
+        BenchResult r;
+        for (pos++; pos < text.size() && text[pos] != '"'; pos++) {
+            if (text[pos] == '\\' && pos + 1 < text.size()) {
+                pos++;
+                r.name += text[pos] == 'n' ? '\n' : text[pos];
+            } else {
+                r.name += text[pos];
+            }
+        }
+        if (pos >= text.size()) return false;
+
+        size_t end = text.find('}', pos);
+        if (end == std::string::npos) return false;
+        double samples = 0.0;
+        if (!FindNumber(text, pos, end, "mean_ns", r.meanNs)) return false;
+        FindNumber(text, pos, end, "low_ns", r.lowNs);
+        FindNumber(text, pos, end, "high_ns", r.highNs);
+        FindNumber(text, pos, end, "stddev_ns", r.stddevNs);
+        FindNumber(text, pos, end, "samples", samples);
+        r.samples = static_cast<int>(samples);
+        out.push_back(r);
+
+        at = text.find(nameKey, end);
+    }
+    return true;
+}
+
+bool BenchReport::ReadJson(const std::string& path, std::vector<BenchResult>& out) {
+    std::ifstream file(path);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return ParseJson(buffer.str(), out);
+}
+
+// ========== COMPARISON ==========
+
+int BenchReport::Compare(const std::vector<BenchResult>& baseline, const std::vector<BenchResult>& current,
+                         double thresholdPercent, FILE* out) {
+    int regressions = 0;
+    fprintf(out, "%-48s %14s %14s %9s\n", "benchmark", "baseline", "current", "change");
+
+    for (const BenchResult& now : current) {
+        const BenchResult* before = nullptr;
+        for (const BenchResult& b : baseline) {
+            if (b.name == now.name) before = &b;
+        }
+        if (!before || before->meanNs <= 0.0) {
+            fprintf(out, "%-48s %14s %11.1f us %9s\n", now.name.c_str(), "-", now.meanNs / 1000.0, "new");
+            continue;
+        }
+
+        double change = (now.meanNs - before->meanNs) / before->meanNs * 100.0;
+        bool regressed = change > thresholdPercent;
+        if (regressed) regressions++;
+        fprintf(out, "%-48s %11.1f us %11.1f us %+8.1f%%%s\n", now.name.c_str(), before->meanNs / 1000.0,
+                now.meanNs / 1000.0, change, regressed ? "  REGRESSION" : "");
+    }
+
+    for (const BenchResult& b : baseline) {
+        bool found = false;
+        for (const BenchResult& now : current) {
+            if (now.name == b.name) found = true;
+        }
+        if (!found) fprintf(out, "%-48s %11.1f us %14s %9s\n", b.name.c_str(), b.meanNs / 1000.0, "-", "missing");
+    }
+
+    fprintf(out, "%d regression(s) over %.1f%%\n", regressions, thresholdPercent);
+    return regressions;
+}
@@ -0,0 +1,44 @@
+#ifndef BENCH_REPORT_HPP
+#define BENCH_REPORT_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define BENCH_DEFAULT_THRESHOLD 10.0   // Percent slower than the baseline that counts as a regression
+
+// One BENCHMARK's result (Catch's estimates, in nanoseconds per run)
+struct BenchResult {
+    std::string name;
+    double meanNs;
+    double lowNs;       // Confidence interval of the mean
+    double highNs;
+    double stddevNs;
+    int samples;
+
+    BenchResult() : meanNs(0.0), lowNs(0.0), highNs(0.0), stddevNs(0.0), samples(0) {}
+};
+
+// Collects BENCHMARK results as they finish, writes them as JSON and compares them against a stored run
+// Catch's own JSON reporter leaves benchmarks out, so bench_main registers a listener that feeds this
+class BenchReport {
+public:
+    static void Record(const BenchResult& result);
+    static const std::vector<BenchResult>& GetResults();
+    static void Clear();
+
+    // {"benchmarks": [{"name": ..., "mean_ns": ..., ...}, ...]}
+    static std::string ToJson(const std::vector<BenchResult>& results);
+    static bool WriteJson(const std::string& path, const std::vector<BenchResult>& results);
+
+    // Reads files written by WriteJson (not a general JSON parser)
+    static bool ParseJson(const std::string& text, std::vector<BenchResult>& out);
+    static bool ReadJson(const std::string& path, std::vector<BenchResult>& out);
+
+    // Print each benchmark against its baseline; returns how many got more than thresholdPercent slower
+    // Benchmarks missing from either side are listed but never count as regressions
+    static int Compare(const std::vector<BenchResult>& baseline, const std::vector<BenchResult>& current,
+                       double thresholdPercent, FILE* out);
+};
+
+#endif
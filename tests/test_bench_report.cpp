@@ -0,0 +1,58 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bench_report.hpp"
+
+static BenchResult MakeResult(const std::string& name, double meanNs) {
+    BenchResult r;
+    r.name = name;
+    r.meanNs = meanNs;
+    r.lowNs = meanNs * 0.9;
+    r.highNs = meanNs * 1.1;
+    r.stddevNs = meanNs * 0.05;
+    r.samples = 100;
+    return r;
+}
+
+TEST_CASE("BenchReport - JSON round trip", "[bench_report]") {
+    std::vector<BenchResult> written = {MakeResult("Evaluate 100k 7-card hands", 1234567.5),
+                                        MakeResult("Name with \"quotes\" and \\slashes\\", 42.0)};
+
+    std::vector<BenchResult> read;
+    REQUIRE(BenchReport::ParseJson(BenchReport::ToJson(written), read));
+    REQUIRE(read.size() == written.size());
+    for (size_t i = 0; i < read.size(); i++) {
+        REQUIRE(read[i].name == written[i].name);
+        REQUIRE(read[i].meanNs == Catch::Approx(written[i].meanNs));
+        REQUIRE(read[i].highNs == Catch::Approx(written[i].highNs));
+        REQUIRE(read[i].samples == 100);
+    }
+
+    SECTION("Empty runs and bad files") {
+        REQUIRE(BenchReport::ParseJson(BenchReport::ToJson({}), read));
+        REQUIRE(read.empty());
+        REQUIRE_FALSE(BenchReport::ParseJson("not json", read));
+        REQUIRE_FALSE(BenchReport::ReadJson("missing_bench_baseline.json", read));
+    }
+}
+
+TEST_CASE("BenchReport - Compare against a baseline", "[bench_report]") {
+    std::vector<BenchResult> baseline = {MakeResult("a", 1000.0), MakeResult("b", 1000.0),
+                                         MakeResult("gone", 1000.0)};
+    std::vector<BenchResult> current = {MakeResult("a", 1050.0), MakeResult("b", 1200.0),
+                                        MakeResult("new", 1000.0)};
+
+    FILE* sink = tmpfile();
+    REQUIRE(sink != nullptr);
+
+    // Only "b" is past 10%; added and removed benchmarks never count
+    REQUIRE(BenchReport::Compare(baseline, current, 10.0, sink) == 1);
+    REQUIRE(BenchReport::Compare(baseline, current, 25.0, sink) == 0);
+    REQUIRE(BenchReport::Compare(baseline, current, 1.0, sink) == 2);
+
+    // Getting faster is never a regression
+    REQUIRE(BenchReport::Compare(current, baseline, 0.0, sink) == 0);
+    fclose(sink);
+}
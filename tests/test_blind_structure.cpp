@@ -0,0 +1,56 @@
+#include "catch_amalgamated.hpp"
+#include "gameplay/blind_structure.hpp"
+
+TEST_CASE("BlindStructure - Levels", "[blind_structure]") {
+    SECTION("Default is the fixed table blinds") {
+        BlindStructure structure;
+        BlindLevel level = structure.GetLevel(1000);
+        REQUIRE(level.smallBlind == SMALL_BLIND_AMOUNT);
+        REQUIRE(level.bigBlind == BIG_BLIND_AMOUNT);
+        REQUIRE(level.ante == 0);
+        REQUIRE(structure.IsValid());
+    }
+
+    SECTION("Fixed blinds never move") {
+        BlindStructure structure = BlindStructure::Fixed(25, 50, 5);
+        REQUIRE(structure.GetLevel(0).bigBlind == 50);
+        REQUIRE(structure.GetLevel(500).bigBlind == 50);
+        REQUIRE(structure.GetLevel(500).ante == 5);
+    }
+
+    SECTION("Doubling every N hands") {
+        BlindStructure structure = BlindStructure::Doubling(5, 10, 1, 10);
+        REQUIRE(structure.GetLevel(9).bigBlind == 10);
+        REQUIRE(structure.GetLevel(10).bigBlind == 20);
+        REQUIRE(structure.GetLevel(10).smallBlind == 10);
+        REQUIRE(structure.GetLevel(10).ante == 2);
+        REQUIRE(structure.GetLevel(35).bigBlind == 80);
+    }
+
+    SECTION("Doubling stops short of overflowing") {
+        BlindStructure structure = BlindStructure::Doubling(5, 10, 0, 1);
+        BlindLevel level = structure.GetLevel(100);
+        REQUIRE(level.bigBlind > 0);
+        REQUIRE(level.smallBlind <= level.bigBlind);
+    }
+
+    SECTION("A schedule stays on its last level") {
+        BlindStructure structure = BlindStructure::Fixed(5, 10);
+        structure.AddLevel(BlindLevel(10, 20));
+        structure.AddLevel(BlindLevel(20, 40, 5));
+        structure.SetHandsPerLevel(5);
+        REQUIRE(structure.GetLevelCount() == 3);
+        REQUIRE(structure.GetLevel(4).bigBlind == 10);
+        REQUIRE(structure.GetLevel(5).bigBlind == 20);
+        REQUIRE(structure.GetLevel(14).bigBlind == 40);
+        REQUIRE(structure.GetLevel(100).bigBlind == 40);
+        REQUIRE(structure.GetLevel(100).ante == 5);
+    }
+
+    SECTION("Validation") {
+        REQUIRE_FALSE(BlindStructure::Fixed(10, 5).IsValid());
+        REQUIRE_FALSE(BlindStructure::Fixed(-1, 5).IsValid());
+        REQUIRE_FALSE(BlindStructure::Fixed(5, 10, -2).IsValid());
+        REQUIRE(BlindStructure::Fixed(0, 0).IsValid());
+    }
+}
@@ -0,0 +1,130 @@
+#include "catch_amalgamated.hpp"
+#include "gameplay/card_mask.hpp"
+#include "items/deck.hpp"
+#include "items/inventory.hpp"
+
+TEST_CASE("CardMask - Card indices", "[card_mask]") {
+    SECTION("Ace is the highest rank index") {
+        REQUIRE(CardMask::RankIndex(RANK_ACE) == 12);
+        REQUIRE(CardMask::RankIndex(RANK_TWO) == 0);
+        REQUIRE(CardMask::RankIndex(RANK_KING) == 11);
+    }
+
+    SECTION("Card index combines suit and rank") {
+        REQUIRE(CardMask::CardIndex(SUIT_HEARTS, RANK_TWO) == 0);
+        REQUIRE(CardMask::CardIndex(SUIT_SPADES, RANK_ACE) == 51);
+        REQUIRE(CardMask::SuitOf(51) == SUIT_SPADES);
+        REQUIRE(CardMask::RankOf(51) == 12);
+    }
+
+    SECTION("Each suit gets its own 16-bit lane") {
+        REQUIRE(CardMask::BitOf(0) == 1ULL);
+        REQUIRE(CardMask::BitOf(13) == (1ULL << 16));
+        REQUIRE(CardMask::BitOf(51) == (1ULL << 60));
+    }
+}
+
+TEST_CASE("CardMask - Set operations", "[card_mask]") {
+    SECTION("Empty mask") {
+        CardMask mask;
+        REQUIRE(mask.IsEmpty());
+        REQUIRE(mask.Count() == 0);
+    }
+
+    SECTION("Add, Has and Remove") {
+        CardMask mask;
+        mask.Add(5);
+        mask.Add(40);
+        mask.Add(5);  // Adding twice is a no-op
+        REQUIRE(mask.Count() == 2);
+        REQUIRE(mask.Has(5));
+        REQUIRE(mask.Has(40));
+        REQUIRE_FALSE(mask.Has(6));
+
+        mask.Remove(5);
+        REQUIRE_FALSE(mask.Has(5));
+        REQUIRE(mask.Count() == 1);
+    }
+
+    SECTION("Full deck holds 52 cards and its complement is empty") {
+        REQUIRE(CardMask::FullDeck().Count() == NUM_CARDS);
+        REQUIRE((~CardMask::FullDeck()).IsEmpty());
+        REQUIRE((~CardMask()).Count() == NUM_CARDS);
+    }
+
+    SECTION("Union and intersection") {
+        CardMask a = CardMask::FromIndex(1) | CardMask::FromIndex(2);
+        CardMask b = CardMask::FromIndex(2) | CardMask::FromIndex(3);
+        REQUIRE((a | b).Count() == 3);
+        REQUIRE((a & b) == CardMask::FromIndex(2));
+    }
+
+    SECTION("Suit and rank masks") {
+        CardMask mask;
+        mask.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_ACE));
+        mask.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_TWO));
+        mask.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_TWO));
+        REQUIRE(mask.SuitMask(SUIT_CLUBS) == ((1u << 12) | 1u));
+        REQUIRE(mask.SuitMask(SUIT_HEARTS) == 1u);
+        REQUIRE(mask.SuitMask(SUIT_SPADES) == 0u);
+        REQUIRE(mask.RankMask() == ((1u << 12) | 1u));
+    }
+
+    SECTION("PopFirst visits every card once in index order") {
+        CardMask mask = CardMask::FullDeck();
+        int expected = 0;
+        while (!mask.IsEmpty()) {
+            REQUIRE(mask.PopFirst() == expected);
+            expected++;
+        }
+        REQUIRE(expected == NUM_CARDS);
+    }
+}
+
+TEST_CASE("CardMask - Card and Deck conversions", "[card_mask]") {
+    SECTION("Card reports its index and mask") {
+        Card card(SUIT_DIAMONDS, RANK_KING);
+        REQUIRE(card.GetIndex() == CardMask::CardIndex(SUIT_DIAMONDS, RANK_KING));
+        REQUIRE(card.GetMask() == CardMask::FromIndex(card.GetIndex()));
+    }
+
+    SECTION("Deck looks up cards by index") {
+        Deck deck({0, 0, 0});
+        for (int i = 0; i < NUM_CARDS; i++) {
+            Card* card = deck.GetCard(i);
+            REQUIRE(card != nullptr);
+            REQUIRE(card->GetIndex() == i);
+        }
+        REQUIRE(deck.GetCard(-1) == nullptr);
+        REQUIRE(deck.GetCard(NUM_CARDS) == nullptr);
+    }
+
+    SECTION("Deck tracks remaining and dealt cards") {
+        Deck deck({0, 0, 0});
+        REQUIRE(deck.GetRemainingMask() == CardMask::FullDeck());
+
+        Card* a = deck.DrawCard();
+        Card* b = deck.DrawCard();
+        CardMask dealt = a->GetMask() | b->GetMask();
+        REQUIRE(deck.GetDealtMask() == dealt);
+        REQUIRE(deck.GetRemainingMask().Count() == deck.GetCount());
+        REQUIRE((deck.GetRemainingMask() & dealt).IsEmpty());
+
+        deck.Reset();
+        REQUIRE(deck.GetRemainingMask() == CardMask::FullDeck());
+    }
+
+    SECTION("Card list and inventory produce the same mask") {
+        Deck deck({0, 0, 0});
+        std::vector<Card*> cards = {deck.GetCard(3), deck.GetCard(17), deck.GetCard(44)};
+
+        Inventory inv;
+        for (Card* card : cards) {
+            inv.AddItem(card);
+        }
+
+        CardMask mask = Card::ToMask(cards);
+        REQUIRE(mask.Count() == 3);
+        REQUIRE(inv.GetCardMask() == mask);
+    }
+}
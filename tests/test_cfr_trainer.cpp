@@ -0,0 +1,230 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/thread_pool.hpp"
+#include "entities/enemy.hpp"
+#include "gameplay/cfr_trainer.hpp"
+#include "gameplay/strategy_table.hpp"
+
+#define TEST_STRATEGY_PATH "test_strategy_table_tmp.bin"
+#define TEST_CHECKPOINT_PATH "test_cfr_checkpoint_tmp.ckpt"
+
+// Small enough to train in a test run
+static CfrConfig SmallConfig() {
+    CfrConfig config;
+    config.seed = 5;
+    config.bucketSamples = 8;
+    config.jobs = 4;
+    config.jobDeals = 2;
+    return config;
+}
+
+static void RequireSameStrategies(const CfrTrainer& a, const CfrTrainer& b) {
+    double pa[STRATEGY_ACTIONS], pb[STRATEGY_ACTIONS];
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        a.GetAverageStrategy(infoset, pa);
+        b.GetAverageStrategy(infoset, pb);
+        for (int k = 0; k < STRATEGY_ACTIONS; k++) REQUIRE(pa[k] == pb[k]);
+        a.GetCurrentStrategy(infoset, pa);
+        b.GetCurrentStrategy(infoset, pb);
+        for (int k = 0; k < STRATEGY_ACTIONS; k++) REQUIRE(pa[k] == pb[k]);
+    }
+}
+
+TEST_CASE("StrategyTable - Abstraction", "[strategy_table]") {
+    SECTION("Infoset indices cover the table once") {
+        std::vector<int> seen(STRATEGY_INFOSETS, 0);
+        for (int street = 0; street < STRATEGY_STREETS; street++)
+            for (int raises = 0; raises < STRATEGY_RAISE_STATES; raises++)
+                for (int facing = 0; facing < 2; facing++)
+                    for (int pot = 0; pot < STRATEGY_POT_BUCKETS; pot++)
+                        for (int eq = 0; eq < STRATEGY_EQUITY_BUCKETS; eq++)
+                            seen[StrategyTable::InfosetIndex(street, raises, facing != 0, pot, eq)]++;
+        for (int count : seen) REQUIRE(count == 1);
+
+        // More raises than a heads-up street allows share the last state
+        REQUIRE(StrategyTable::InfosetIndex(1, 5, true, 0, 0) == StrategyTable::InfosetIndex(1, 2, true, 0, 0));
+    }
+
+    SECTION("Buckets") {
+        REQUIRE(StrategyTable::StreetOf(0) == 0);
+        REQUIRE(StrategyTable::StreetOf(3) == 1);
+        REQUIRE(StrategyTable::StreetOf(4) == 2);
+        REQUIRE(StrategyTable::StreetOf(5) == 3);
+
+        REQUIRE(StrategyTable::PotBucket(30, 10) == 0);
+        REQUIRE(StrategyTable::PotBucket(40, 10) == 1);
+        REQUIRE(StrategyTable::PotBucket(200, 10) == 2);
+        REQUIRE(StrategyTable::PotBucket(5000, 10) == 3);
+
+        REQUIRE(StrategyTable::EquityBucket(0.0) == 0);
+        REQUIRE(StrategyTable::EquityBucket(0.5) == STRATEGY_EQUITY_BUCKETS / 2);
+        REQUIRE(StrategyTable::EquityBucket(1.0) == STRATEGY_EQUITY_BUCKETS - 1);
+    }
+
+    SECTION("Quantizing keeps the total") {
+        const double cases[][STRATEGY_ACTIONS] = {
+            {1.0 / 3, 1.0 / 3, 1.0 / 3}, {0.0, 1.0, 0.0}, {0.001, 0.5, 0.499}, {0.2, 0.2, 0.6}};
+        for (const auto& probs : cases) {
+            uint8_t out[STRATEGY_ACTIONS];
+            StrategyTable::Quantize(probs, out);
+            REQUIRE(out[0] + out[1] + out[2] == STRATEGY_QUANT);
+            for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+                REQUIRE(std::abs(out[a] - probs[a] * STRATEGY_QUANT) <= 1.0);
+            }
+        }
+    }
+}
+
+TEST_CASE("StrategyTable - File round trip", "[strategy_table]") {
+    std::vector<uint8_t> probs(STRATEGY_INFOSETS * STRATEGY_ACTIONS);
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        double p[STRATEGY_ACTIONS] = {0.25, 0.5, 0.25};
+        if (infoset == 7) {
+            p[0] = 0.0;
+            p[1] = 0.0;
+            p[2] = 1.0;
+        }
+        StrategyTable::Quantize(p, &probs[infoset * STRATEGY_ACTIONS]);
+    }
+
+    StrategyTableHeader header;
+    memset(&header, 0, sizeof(header));
+    header.iterations = 42;
+    REQUIRE(StrategyTable::Write(TEST_STRATEGY_PATH, header, probs.data()));
+
+    StrategyTable table;
+    REQUIRE(table.Open(TEST_STRATEGY_PATH));
+    REQUIRE(table.GetHeader()->iterations == 42);
+    REQUIRE(table.SampleAction(7, 0) == 2);
+    REQUIRE(table.SampleAction(7, STRATEGY_QUANT - 1) == 2);
+    REQUIRE(table.SampleAction(0, 0) == 0);
+    REQUIRE(table.SampleAction(0, STRATEGY_QUANT / 2) == 1);
+    REQUIRE(table.SampleAction(0, STRATEGY_QUANT - 1) == 2);
+    table.Close();
+
+    // A truncated file is rejected
+    FILE* f = fopen(TEST_STRATEGY_PATH, "wb");
+    fwrite(&header, sizeof(header), 1, f);
+    fclose(f);
+    REQUIRE_FALSE(table.Open(TEST_STRATEGY_PATH));
+    REQUIRE_FALSE(table.IsLoaded());
+    std::remove(TEST_STRATEGY_PATH);
+}
+
+TEST_CASE("CfrTrainer - Training", "[cfr]") {
+    CfrTrainer trainer(SmallConfig());
+
+    // Untrained, everything checks or calls
+    double probs[STRATEGY_ACTIONS];
+    trainer.GetAverageStrategy(0, probs);
+    REQUIRE(probs[1] == 1.0);
+    double untrained = trainer.Exploitability(40, 99, nullptr);
+
+    trainer.Train(12, nullptr);
+    REQUIRE(trainer.GetIterations() == 12);
+    REQUIRE(trainer.GetDeals() == 12 * 4 * 2);
+
+    SECTION("Strategies are distributions") {
+        int reached = 0;
+        for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+            trainer.GetAverageStrategy(infoset, probs);
+            double total = probs[0] + probs[1] + probs[2];
+            REQUIRE(total == Catch::Approx(1.0));
+            for (int a = 0; a < STRATEGY_ACTIONS; a++) REQUIRE(probs[a] >= 0.0);
+            if (probs[1] != 1.0) reached++;
+        }
+        REQUIRE(reached > 0);
+
+        // Folding is never trained where there is nothing to call
+        trainer.GetAverageStrategy(StrategyTable::InfosetIndex(1, 0, false, 1, 3), probs);
+        REQUIRE(probs[0] == 0.0);
+    }
+
+    SECTION("Always calling is easy to exploit; training closes some of that") {
+        double trained = trainer.Exploitability(40, 99, nullptr);
+        REQUIRE(untrained > 0.0);
+        REQUIRE(trained < untrained);
+    }
+}
+
+TEST_CASE("CfrTrainer - Same result on any thread count", "[cfr]") {
+    CfrTrainer single(SmallConfig());
+    single.Train(3, nullptr);
+
+    ThreadPool pool(3);
+    CfrTrainer pooled(SmallConfig());
+    pooled.Train(3, &pool);
+    RequireSameStrategies(single, pooled);
+
+    REQUIRE(single.Exploitability(16, 7, nullptr) == pooled.Exploitability(16, 7, &pool));
+}
+
+TEST_CASE("CfrTrainer - Checkpoint and resume", "[cfr]") {
+    CfrTrainer straight(SmallConfig());
+    straight.Train(4, nullptr);
+
+    CfrTrainer first(SmallConfig());
+    first.Train(2, nullptr);
+    REQUIRE(first.SaveCheckpoint(TEST_CHECKPOINT_PATH));
+
+    // The checkpoint brings its own seed and job layout
+    CfrConfig other;
+    other.seed = 1234;
+    CfrTrainer resumed(other);
+    REQUIRE(resumed.LoadCheckpoint(TEST_CHECKPOINT_PATH));
+    REQUIRE(resumed.GetIterations() == 2);
+    REQUIRE(resumed.GetConfig().seed == SmallConfig().seed);
+    resumed.Train(2, nullptr);
+    RequireSameStrategies(straight, resumed);
+
+    REQUIRE_FALSE(resumed.LoadCheckpoint("missing_checkpoint.ckpt"));
+    std::remove(TEST_CHECKPOINT_PATH);
+
+    // The trained table loads back
+    REQUIRE(resumed.WriteTable(TEST_STRATEGY_PATH, 12.5f));
+    StrategyTable table;
+    REQUIRE(table.Open(TEST_STRATEGY_PATH));
+    REQUIRE(table.GetHeader()->iterations == 4);
+    REQUIRE(table.GetHeader()->exploitability == 12.5f);
+    table.Close();
+    std::remove(TEST_STRATEGY_PATH);
+}
+
+TEST_CASE("Enemy - Strategy table decisions", "[enemy][strategy_table]") {
+    // Raise everywhere
+    std::vector<uint8_t> probs(STRATEGY_INFOSETS * STRATEGY_ACTIONS);
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        probs[infoset * STRATEGY_ACTIONS + 2] = STRATEGY_QUANT;
+    }
+    StrategyTableHeader header;
+    memset(&header, 0, sizeof(header));
+    REQUIRE(StrategyTable::Write(TEST_STRATEGY_PATH, header, probs.data()));
+    StrategyTable table;
+    REQUIRE(table.Open(TEST_STRATEGY_PATH));
+
+    TableView view;
+    view.pot = 30;
+    view.bigBlind = 10;
+    int raiseAmount = 0;
+
+    SECTION("Pot-sized raise") {
+        REQUIRE(Enemy::ChooseStrategyAction(table, 0.6, view, 20, 10, 30, 1000, 100, raiseAmount) == 2);
+        REQUIRE(raiseAmount == 20 + 30 + 10);
+    }
+
+    SECTION("Clamped to the raise range") {
+        REQUIRE(Enemy::ChooseStrategyAction(table, 0.6, view, 20, 10, 30, 45, 100, raiseAmount) == 2);
+        REQUIRE(raiseAmount == 45);
+    }
+
+    SECTION("No raise available becomes a call") {
+        REQUIRE(Enemy::ChooseStrategyAction(table, 0.6, view, 20, 10, 31, 30, 100, raiseAmount) == 1);
+    }
+
+    table.Close();
+    std::remove(TEST_STRATEGY_PATH);
+}
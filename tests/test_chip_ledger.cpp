@@ -0,0 +1,82 @@
+#include "catch_amalgamated.hpp"
+#include <random>
+
+#include "gameplay/chip_ledger.hpp"
+
+TEST_CASE("ChipLedger - Denominations", "[chip_ledger]") {
+    SECTION("Values map to slots") {
+        REQUIRE(ChipLedger::IndexOf(100) == 0);
+        REQUIRE(ChipLedger::IndexOf(1) == CHIP_DENOMINATION_COUNT - 1);
+        REQUIRE(ChipLedger::IndexOf(50) == -1);
+    }
+
+    SECTION("FromAmount uses the fewest chips") {
+        ChipLedger ledger = ChipLedger::FromAmount(283);
+        REQUIRE(ledger.GetCount(100) == 2);
+        REQUIRE(ledger.GetCount(25) == 3);
+        REQUIRE(ledger.GetCount(10) == 0);
+        REQUIRE(ledger.GetCount(5) == 1);
+        REQUIRE(ledger.GetCount(1) == 3);
+        REQUIRE(ledger.Total() == 283);
+    }
+
+    SECTION("Empty and negative amounts make an empty ledger") {
+        REQUIRE(ChipLedger::FromAmount(0).Total() == 0);
+        REQUIRE(ChipLedger::FromAmount(-5).Total() == 0);
+    }
+}
+
+TEST_CASE("ChipLedger - Withdraw", "[chip_ledger]") {
+    SECTION("Exact chips are paid directly") {
+        ChipLedger bankroll;
+        bankroll.Add(25, 4);
+        bankroll.Add(5, 2);
+
+        ChipLedger paid;
+        REQUIRE(bankroll.Withdraw(55, paid));
+        REQUIRE(paid.GetCount(25) == 2);
+        REQUIRE(paid.GetCount(5) == 1);
+        REQUIRE(bankroll.Total() == 55);
+    }
+
+    SECTION("A larger chip is broken for change") {
+        ChipLedger bankroll;
+        bankroll.Add(100, 5);
+
+        ChipLedger paid;
+        REQUIRE(bankroll.Withdraw(15, paid));
+        REQUIRE(paid.Total() == 15);
+        REQUIRE(bankroll.Total() == 485);
+        REQUIRE(bankroll.GetCount(100) == 4);
+    }
+
+    SECTION("Can't withdraw more than the ledger holds") {
+        ChipLedger bankroll = ChipLedger::FromAmount(40);
+        ChipLedger before = bankroll;
+        ChipLedger paid;
+        REQUIRE_FALSE(bankroll.Withdraw(41, paid));
+        REQUIRE(bankroll == before);
+        REQUIRE(paid.Total() == 0);
+    }
+
+    SECTION("Random bets always conserve chips") {
+        std::mt19937 rng(99);
+        for (int trial = 0; trial < 2000; trial++) {
+            ChipLedger bankroll;
+            for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+                bankroll.counts[d] = rng() % 6;
+            }
+            int total = bankroll.Total();
+            if (total == 0) continue;
+
+            int amount = 1 + rng() % total;
+            ChipLedger paid;
+            REQUIRE(bankroll.Withdraw(amount, paid));
+            REQUIRE(paid.Total() == amount);
+            REQUIRE(bankroll.Total() == total - amount);
+            for (int d = 0; d < CHIP_DENOMINATION_COUNT; d++) {
+                REQUIRE(bankroll.counts[d] >= 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#include "catch_amalgamated.hpp"
+
+#include "items/chip_pool.hpp"
+
+TEST_CASE("ChipPool - Reuse", "[chip_pool]") {
+    ChipPool pool;
+
+    SECTION("Acquire creates chips of the requested value") {
+        Chip* chip = pool.Acquire(25);
+        REQUIRE(chip != nullptr);
+        REQUIRE(chip->value == 25);
+        REQUIRE(pool.GetAllocatedCount() == 1);
+        pool.Release(chip);
+    }
+
+    SECTION("Invalid values are rejected") {
+        REQUIRE(pool.Acquire(50) == nullptr);
+        REQUIRE(pool.GetAllocatedCount() == 0);
+    }
+
+    SECTION("Released chips are handed out again") {
+        Chip* first = pool.Acquire(100);
+        pool.Release(first);
+        REQUIRE(pool.GetFreeCount(100) == 1);
+
+        Chip* second = pool.Acquire(100);
+        REQUIRE(second == first);
+        REQUIRE(pool.GetAllocatedCount() == 1);
+        REQUIRE(pool.GetFreeCount(100) == 0);
+        pool.Release(second);
+    }
+
+    SECTION("Reserve pre-creates idle chips") {
+        pool.Reserve(ChipLedger::FromAmount(130));
+        REQUIRE(pool.GetFreeCount(100) == 1);
+        REQUIRE(pool.GetFreeCount(25) == 1);
+        REQUIRE(pool.GetFreeCount(5) == 1);
+        int allocated = pool.GetAllocatedCount();
+
+        Chip* chip = pool.Acquire(25);
+        REQUIRE(pool.GetAllocatedCount() == allocated);
+        pool.Release(chip);
+    }
+}
@@ -0,0 +1,184 @@
+#include "catch_amalgamated.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "entities/enemy.hpp"
+#include "gameplay/decision_service.hpp"
+#include "items/card.hpp"
+#include "items/chip.hpp"
+
+// Job that holds its worker until released
+static DecisionResult BlockUntil(const std::atomic<bool>* release, int action) {
+    while (!release->load()) std::this_thread::sleep_for(std::chrono::microseconds(100));
+    DecisionResult result;
+    result.action = action;
+    return result;
+}
+
+// Poll like a frame loop would, giving up after a while
+static bool PollUntilReady(PendingDecision& decision) {
+    for (int frame = 0; frame < 5000 && !decision.IsReady(); frame++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return decision.IsReady();
+}
+
+TEST_CASE("DecisionService - Inline", "[decision_service]") {
+    DecisionService service(0);
+    REQUIRE(service.IsInline());
+    REQUIRE(service.GetThreadCount() == 0);
+
+    PendingDecision decision = service.Submit([] {
+        DecisionResult result;
+        result.action = 2;
+        result.raiseAmount = 40;
+        return result;
+    });
+    REQUIRE(decision.IsReady());
+    DecisionResult result = decision.Take();
+    REQUIRE(result.action == 2);
+    REQUIRE(result.raiseAmount == 40);
+    REQUIRE_FALSE(decision.IsValid());
+    REQUIRE_FALSE(decision.IsReady());
+}
+
+TEST_CASE("DecisionService - Workers", "[decision_service]") {
+    DecisionService service(2);
+    REQUIRE_FALSE(service.IsInline());
+    REQUIRE(service.GetThreadCount() == 2);
+    std::atomic<bool> release(false);
+
+    SECTION("Polling never blocks while the job runs") {
+        PendingDecision decision = service.Submit([&release] { return BlockUntil(&release, 1); });
+        REQUIRE(decision.IsValid());
+        REQUIRE_FALSE(decision.IsReady());
+
+        release = true;
+        REQUIRE(PollUntilReady(decision));
+        REQUIRE(decision.Take().action == 1);
+    }
+
+    SECTION("Decisions run side by side") {
+        PendingDecision first = service.Submit([&release] { return BlockUntil(&release, 0); });
+        PendingDecision second = service.Submit([] {
+            DecisionResult result;
+            result.action = 2;
+            return result;
+        });
+
+        // The second finishes while the first still holds its worker
+        REQUIRE(PollUntilReady(second));
+        REQUIRE_FALSE(first.IsReady());
+        release = true;
+        REQUIRE(PollUntilReady(first));
+    }
+
+    SECTION("Dropping a pending decision is safe") {
+        PendingDecision decision = service.Submit([&release] { return BlockUntil(&release, 1); });
+        decision.Reset();
+        REQUIRE_FALSE(decision.IsValid());
+        release = true;
+        service.Wait();
+    }
+}
+
+TEST_CASE("Enemy - Decisions run on the decision service", "[enemy][decision_service]") {
+    DecisionService workers(1);
+    DecisionService* previous = DecisionService::GetGlobal();
+    DecisionService::SetGlobal(&workers);
+
+    Enemy enemy({0, 0, 0});
+    Card ace(SUIT_SPADES, RANK_ACE, {0, 0, 0}, nullptr);
+    Card king(SUIT_SPADES, RANK_KING, {0, 0, 0}, nullptr);
+    Chip chip(100, {0, 0, 0}, nullptr);
+    enemy.GetInventory()->AddItem(&ace);
+    enemy.GetInventory()->AddItem(&king);
+    enemy.GetInventory()->AddItem(&chip);
+
+    TableView view;
+    view.liveOpponents = 1;
+    view.pot = 30;
+    view.bigBlind = 10;
+    enemy.SetTableView(view);
+
+    BetRequest request;
+    request.currentBet = 10;
+    request.callAmount = 10;
+    request.minRaise = 20;
+    request.maxRaise = 100;
+
+    int answers = 0;
+    int answered = -1;
+    auto onDecided = [&answers, &answered](int action, int raiseAmount) {
+        (void)raiseAmount;
+        answers++;
+        answered = action;
+    };
+
+    SECTION("The thinking delay is a minimum, not the whole story") {
+        // Occupy the only worker so the enemy's decision has to queue behind it
+        std::atomic<bool> release(false);
+        PendingDecision blocker = workers.Submit([&release] { return BlockUntil(&release, 0); });
+
+        enemy.RequestBet(request, onDecided);
+        REQUIRE(enemy.IsThinking());
+        enemy.Update(0.5f);
+        REQUIRE(answers == 0);
+
+        // Delay over, decision still queued: keep thinking without blocking the frame
+        enemy.Update(5.0f);
+        enemy.Update(0.016f);
+        REQUIRE(answers == 0);
+        REQUIRE(enemy.IsThinking());
+
+        release = true;
+        for (int frame = 0; frame < 5000 && answers == 0; frame++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            enemy.Update(0.016f);
+        }
+        REQUIRE(answers == 1);
+        REQUIRE(answered >= 0);
+        REQUIRE(answered <= 2);
+        REQUIRE_FALSE(enemy.IsThinking());
+        REQUIRE(enemy.GetLastEquity() > 0.0);
+    }
+
+    SECTION("Cancelling drops the decision") {
+        enemy.RequestBet(request, onDecided);
+        enemy.CancelBet();
+        REQUIRE_FALSE(enemy.IsThinking());
+        workers.Wait();
+        enemy.Update(5.0f);
+        REQUIRE(answers == 0);
+    }
+
+    workers.Wait();
+    DecisionService::SetGlobal(previous);
+    enemy.GetInventory()->Cleanup();
+}
+
+TEST_CASE("Enemy - Decide from a snapshot", "[enemy]") {
+    // Royal flush on the river facing a bet: raise
+    DecisionSnapshot snapshot;
+    snapshot.hole = CardMask::FromIndex(CardMask::CardIndex(SUIT_SPADES, RANK_ACE)) |
+                    CardMask::FromIndex(CardMask::CardIndex(SUIT_SPADES, RANK_KING));
+    for (int rank : {RANK_QUEEN, RANK_JACK, RANK_TEN}) {
+        snapshot.view.board.Add(CardMask::CardIndex(SUIT_SPADES, rank));
+    }
+    snapshot.view.board.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_TWO));
+    snapshot.view.board.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_THREE));
+    snapshot.view.liveOpponents = 1;
+    snapshot.view.pot = 100;
+    snapshot.chips = 1000;
+    snapshot.bet.currentBet = 20;
+    snapshot.bet.callAmount = 20;
+    snapshot.bet.minRaise = 40;
+    snapshot.bet.maxRaise = 1000;
+
+    DecisionResult result = Enemy::Decide(snapshot);
+    REQUIRE(result.equity == 1.0);
+    REQUIRE(result.action == 2);
+    REQUIRE(result.raiseAmount >= 40);
+    REQUIRE(result.raiseAmount <= 1000);
+}
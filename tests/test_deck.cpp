@@ -276,3 +276,46 @@ TEST_CASE("Deck - Edge Cases", "[deck]") {
         }
     }
 }
+
+TEST_CASE("Deck - Seeded shuffles", "[deck]") {
+    SECTION("Same seed draws the same cards") {
+        Deck deck1({0, 0, 0});
+        Deck deck2({0, 0, 0});
+        deck1.Seed(1234);
+        deck2.Seed(1234);
+        deck1.Shuffle();
+        deck2.Shuffle();
+
+        for (int i = 0; i < 52; i++) {
+            REQUIRE(deck1.DrawCard()->GetIndex() == deck2.DrawCard()->GetIndex());
+        }
+    }
+
+    SECTION("Reseeding replays the shuffle") {
+        Deck deck({0, 0, 0});
+        deck.Seed(77);
+        deck.Shuffle();
+        int first[5];
+        for (int i = 0; i < 5; i++) first[i] = deck.DrawCard()->GetIndex();
+
+        deck.Seed(77);
+        for (int i = 0; i < 5; i++) {
+            REQUIRE(deck.DrawCard()->GetIndex() == first[i]);
+        }
+    }
+
+    SECTION("Dead cards are never drawn") {
+        Deck deck({0, 0, 0});
+        deck.Shuffle();
+        REQUIRE(deck.RemoveDead(CardMask::CardIndex(SUIT_SPADES, RANK_ACE)));
+        REQUIRE_FALSE(deck.RemoveDead(CardMask::CardIndex(SUIT_SPADES, RANK_ACE)));
+        REQUIRE(deck.GetCount() == 51);
+
+        while (!deck.IsEmpty()) {
+            REQUIRE(deck.DrawCard()->GetIndex() != CardMask::CardIndex(SUIT_SPADES, RANK_ACE));
+        }
+
+        deck.Reset();
+        REQUIRE(deck.GetCount() == 52);
+    }
+}
@@ -1,6 +1,10 @@
 #include "catch_amalgamated.hpp"
 #include "core/dom.hpp"
 #include "core/object.hpp"
+#include "items/chip.hpp"
+#include "rendering/light.hpp"
+#include "world/wall.hpp"
+#include <algorithm>
 
 TEST_CASE("DOM - Construction", "[dom]") {
     DOM dom;
@@ -100,6 +104,196 @@ TEST_CASE("DOM - Cleanup", "[dom]") {
     delete obj2;
 }
 
+TEST_CASE("DOM - Category lists", "[dom]") {
+    DOM dom;
+    Object* plain = new Object({0, 0, 0});
+    Chip* chip = new Chip(5, {1, 0, 0});
+    Light* light = new Light({0, 3, 0});
+    Wall* wall = new Wall({0, 1, 5}, {10, 2, 0.2f}, nullptr);
+    dom.AddObject(plain);
+    dom.AddObject(chip);
+    dom.AddObject(light);
+    dom.AddObject(wall);
+
+    auto listed = [&](ObjectCategory category, Object* obj) {
+        const std::vector<Object*>& list = dom.GetCategory(category);
+        return std::find(list.begin(), list.end(), obj) != list.end();
+    };
+
+    SECTION("Objects land in the lists they belong to") {
+        REQUIRE(dom.GetCategory(CATEGORY_LIGHTS).size() == 1);
+        REQUIRE(listed(CATEGORY_LIGHTS, light));
+        REQUIRE(dom.GetCategory(CATEGORY_INTERACTABLES).size() == 1);
+        REQUIRE(listed(CATEGORY_INTERACTABLES, chip));
+        REQUIRE(dom.GetCategory(CATEGORY_STATIC_COLLIDERS).size() == 1);
+        REQUIRE(listed(CATEGORY_STATIC_COLLIDERS, wall));
+        REQUIRE(dom.GetCategory(CATEGORY_POKER_TABLES).empty());
+        REQUIRE(dom.GetCategory(CATEGORY_LIT).size() + dom.GetCategory(CATEGORY_UNLIT).size() == 4);
+        REQUIRE(listed(CATEGORY_LIT, plain));
+        REQUIRE(listed(CATEGORY_UNLIT, chip));
+        REQUIRE(listed(CATEGORY_UNLIT, light));
+    }
+
+    SECTION("Removing swaps the last member into the gap") {
+        dom.RemoveObject(plain);
+        REQUIRE_FALSE(listed(CATEGORY_LIT, plain));
+        dom.RemoveObject(chip);
+        REQUIRE_FALSE(listed(CATEGORY_UNLIT, chip));
+        REQUIRE_FALSE(listed(CATEGORY_INTERACTABLES, chip));
+        REQUIRE(listed(CATEGORY_UNLIT, light));
+
+        // The moved member can still be removed
+        dom.RemoveObject(light);
+        REQUIRE(dom.GetCategory(CATEGORY_UNLIT).empty());
+        REQUIRE(dom.GetCategory(CATEGORY_LIGHTS).empty());
+
+        // Re-adding lists it again
+        dom.AddObject(chip);
+        REQUIRE(listed(CATEGORY_INTERACTABLES, chip));
+        dom.AddObject(plain);
+        dom.AddObject(light);
+    }
+
+    SECTION("Cleanup empties every list and objects can join another DOM") {
+        dom.Cleanup();
+        for (int c = 0; c < CATEGORY_COUNT; c++) {
+            REQUIRE(dom.GetCategory((ObjectCategory)c).empty());
+        }
+
+        DOM other;
+        other.AddObject(chip);
+        REQUIRE(other.GetCategory(CATEGORY_INTERACTABLES).size() == 1);
+        other.RemoveObject(chip);
+        REQUIRE(other.GetCategory(CATEGORY_INTERACTABLES).empty());
+        dom.AddObject(plain);
+        dom.AddObject(chip);
+        dom.AddObject(light);
+        dom.AddObject(wall);
+    }
+
+    for (Object* obj : dom.GetObjects()) delete obj;
+    dom.Cleanup();
+}
+
+TEST_CASE("DOM - Removal keeps the list dense", "[dom]") {
+    DOM dom;
+    std::vector<Object*> objects;
+    for (int i = 0; i < 50; i++) objects.push_back(new Object({(float)i, 0, 0}));
+    dom.AddObjects(objects);
+    REQUIRE(dom.GetCount() == 50);
+
+    // Remove every third object in a scattered order, so plenty of others get moved around
+    std::vector<bool> removed(50, false);
+    for (int i = 0; i < 50; i += 3) {
+        int index = (i * 7) % 50;
+        dom.RemoveObject(objects[index]);
+        removed[index] = true;
+    }
+    std::vector<Object*> kept;
+    for (int i = 0; i < 50; i++) {
+        if (!removed[i]) kept.push_back(objects[i]);
+    }
+
+    REQUIRE(dom.GetCount() == (int)kept.size());
+    std::vector<Object*> remaining = dom.GetObjects();
+    std::sort(remaining.begin(), remaining.end());
+    std::sort(kept.begin(), kept.end());
+    REQUIRE(remaining == kept);
+
+    // Removing twice or removing a stranger changes nothing
+    dom.RemoveObject(objects[0]);
+    Object stranger({0, 0, 0});
+    dom.RemoveObject(&stranger);
+    REQUIRE(dom.GetCount() == (int)kept.size());
+
+    dom.RemoveObjects(kept);
+    REQUIRE(dom.GetCount() == 0);
+    for (Object* obj : objects) delete obj;
+}
+
+TEST_CASE("DOM - Deferred changes", "[dom]") {
+    DOM dom;
+    Object* a = new Object({0, 0, 0});
+    Object* b = new Object({1, 0, 0});
+    Object* c = new Object({2, 0, 0});
+    dom.AddObject(a);
+    dom.AddObject(b);
+    dom.AddObject(c);
+
+    std::vector<Object*> found;
+
+    SECTION("Adds wait for Sync") {
+        Object* late = new Object({0, 0, 1});
+        dom.BeginDeferred();
+        REQUIRE(dom.IsDeferring());
+        dom.AddObject(late);
+        REQUIRE(dom.GetCount() == 3);
+        dom.Sync();
+        REQUIRE_FALSE(dom.IsDeferring());
+        REQUIRE(dom.GetCount() == 4);
+        REQUIRE(dom.GetObject(3) == late);
+    }
+
+    SECTION("Removes leave a gap until Sync but leave queries at once") {
+        dom.BeginDeferred();
+        dom.RemoveAndDelete(a);
+        a = nullptr;
+        REQUIRE(dom.GetCount() == 3);
+        REQUIRE(dom.GetObject(0) == nullptr);
+        dom.QuerySphere({0, 0, 0}, 1.5f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == b);
+
+        dom.Sync();
+        REQUIRE(dom.GetCount() == 2);
+        REQUIRE(dom.GetObject(0) != nullptr);
+        REQUIRE(dom.GetObject(1) != nullptr);
+
+        // Slots are still right after compaction
+        dom.RemoveObject(c);
+        REQUIRE(dom.GetCount() == 1);
+        REQUIRE(dom.GetObject(0) == b);
+        delete c;
+    }
+
+    SECTION("A loop over the list can remove what it visits") {
+        dom.BeginDeferred();
+        int visited = 0;
+        for (int i = 0; i < dom.GetCount(); i++) {
+            Object* obj = dom.GetObject(i);
+            if (!obj) continue;
+            visited++;
+            dom.RemoveObject(obj);
+        }
+        dom.Sync();
+        REQUIRE(visited == 3);
+        REQUIRE(dom.GetCount() == 0);
+        dom.AddObjects(std::vector<Object*>{a, b, c});
+    }
+
+    SECTION("Add then remove before Sync cancels out") {
+        Object* temp = new Object({5, 0, 0});
+        dom.BeginDeferred();
+        dom.AddObject(temp);
+        dom.RemoveObject(temp);
+        dom.Sync();
+        REQUIRE(dom.GetCount() == 3);
+        delete temp;
+    }
+
+    SECTION("Objects deleted before Sync are not added") {
+        Object* temp = new Object({5, 0, 0});
+        dom.BeginDeferred();
+        dom.AddObject(temp);
+        delete temp;
+        dom.Sync();
+        REQUIRE(dom.GetCount() == 3);
+    }
+
+    for (Object* obj : dom.GetObjects()) delete obj;
+    dom.Cleanup();
+}
+
 TEST_CASE("DOM - Global Instance", "[dom]") {
     // Save original global DOM (set by test_main.cpp)
     DOM* originalGlobal = DOM::GetGlobal();
@@ -51,3 +51,45 @@ TEST_CASE("Enemy - Seating", "[enemy]") {
         REQUIRE(enemy.IsSeated() == true);
     }
 }
+
+TEST_CASE("Enemy - ChooseAction", "[enemy]") {
+    int raiseAmount = 0;
+
+    SECTION("Folds a weak hand facing a bet") {
+        REQUIRE(Enemy::ChooseAction(0.2, 1, 100, 50, 1000, 60, 1000, raiseAmount) == 0);
+    }
+
+    SECTION("Checks a weak hand when calling is free") {
+        REQUIRE(Enemy::ChooseAction(0.2, 1, 100, 0, 1000, 60, 1000, raiseAmount) == 1);
+    }
+
+    SECTION("Calls when equity beats the pot odds") {
+        // Needs 50 / (150 + 50) = 25% to call
+        REQUIRE(Enemy::ChooseAction(0.3, 3, 150, 50, 1000, 60, 1000, raiseAmount) == 1);
+    }
+
+    SECTION("Raises a strong hand within the allowed range") {
+        REQUIRE(Enemy::ChooseAction(0.9, 1, 100, 10, 1000, 60, 1000, raiseAmount) == 2);
+        REQUIRE(raiseAmount >= 60);
+        REQUIRE(raiseAmount <= 1000);
+    }
+
+    SECTION("Calls instead of raising when a raise is impossible") {
+        REQUIRE(Enemy::ChooseAction(0.9, 1, 100, 10, 1000, 1001, 1000, raiseAmount) == 1);
+    }
+
+    SECTION("Folds when the call is unaffordable") {
+        REQUIRE(Enemy::ChooseAction(0.9, 1, 100, 500, 200, 510, 200, raiseAmount) == 0);
+    }
+
+    SECTION("Raise sizing follows the BettingAI params") {
+        BettingAIParams timid;
+        timid.raiseFraction = 0.0;
+        REQUIRE(BettingAI::ChooseAction(0.9, 1, 100, 10, 1000, 60, 1000, raiseAmount, timid) == 2);
+        REQUIRE(raiseAmount == 60);
+
+        BettingAIParams passive;
+        passive.raiseFactor = 2.5;  // Needs more than 100% equity heads-up, so never raises
+        REQUIRE(BettingAI::ChooseAction(0.9, 1, 100, 10, 1000, 60, 1000, raiseAmount, passive) == 1);
+    }
+}
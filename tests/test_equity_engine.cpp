@@ -0,0 +1,292 @@
+#include "catch_amalgamated.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool.hpp"
+#include "gameplay/equity_engine.hpp"
+#include "gameplay/hand_evaluator.hpp"
+
+static CardMask Cards(std::initializer_list<int> indices) {
+    CardMask mask;
+    for (int index : indices) mask.Add(index);
+    return mask;
+}
+
+// Card index shorthand (rank index 0 = two ... 12 = ace)
+static int C(int rankIndex, int suit) {
+    return suit * NUM_RANKS + rankIndex;
+}
+
+TEST_CASE("ThreadPool - Runs submitted tasks", "[thread_pool]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.GetThreadCount() == 4);
+
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 100; i++) {
+        pool.Submit([&counter] { counter++; });
+    }
+    pool.Wait();
+    REQUIRE(counter == 100);
+
+    SECTION("Pool is reusable after Wait") {
+        pool.Submit([&counter] { counter += 10; });
+        pool.Wait();
+        REQUIRE(counter == 110);
+    }
+}
+
+TEST_CASE("ThreadPool - Work stealing", "[thread_pool]") {
+    ThreadPool pool(4);
+
+    SECTION("Tasks submitted from inside a task are waited for") {
+        std::atomic<int> counter(0);
+        for (int i = 0; i < 8; i++) {
+            pool.Submit([&pool, &counter] {
+                for (int j = 0; j < 50; j++) {
+                    pool.Submit([&counter] { counter++; });
+                }
+            });
+        }
+        pool.Wait();
+        REQUIRE(counter == 400);
+    }
+
+    SECTION("Idle workers steal from a busy queue") {
+        // One task fans out on a single worker's queue; the other workers must pick it up
+        std::atomic<int> counter(0);
+        std::mutex idsMutex;
+        std::vector<std::thread::id> ids;
+        pool.Submit([&] {
+            for (int j = 0; j < 64; j++) {
+                pool.Submit([&] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    std::lock_guard<std::mutex> lock(idsMutex);
+                    if (std::find(ids.begin(), ids.end(), std::this_thread::get_id()) == ids.end()) {
+                        ids.push_back(std::this_thread::get_id());
+                    }
+                    counter++;
+                });
+            }
+        });
+        pool.Wait();
+        REQUIRE(counter == 64);
+        REQUIRE(ids.size() > 1);
+    }
+}
+
+TEST_CASE("EquityEngine - Known matchups", "[equity_engine]") {
+    ThreadPool pool(2);
+
+    SECTION("Pocket aces against one random hand win about 85%") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(12, 1)});
+        request.opponents = 1;
+        request.maxSamples = 20000;
+        request.seed = 7;
+
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE(result.samples == 20000);
+        REQUIRE(result.equity == Catch::Approx(0.852).margin(0.015));
+        REQUIRE(result.margin > 0.0);
+        REQUIRE(result.margin < 0.01);
+    }
+
+    SECTION("More opponents lower equity") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(12, 1)});
+        request.maxSamples = 10000;
+        request.seed = 7;
+
+        request.opponents = 1;
+        double headsUp = EquityEngine::Calculate(request, &pool).equity;
+        request.opponents = 5;
+        double sixWay = EquityEngine::Calculate(request, &pool).equity;
+        REQUIRE(sixWay < headsUp);
+    }
+
+    SECTION("Royal flush on a complete board cannot lose") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 2), C(11, 2)});
+        request.board = Cards({C(10, 2), C(9, 2), C(8, 2), C(0, 0), C(1, 1)});
+        request.opponents = 3;
+        request.maxSamples = 2000;
+        request.seed = 1;
+
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE(result.win == 1.0);
+        REQUIRE(result.equity == 1.0);
+    }
+
+    SECTION("Board that plays for everyone is a split") {
+        EquityRequest request;
+        request.hole = Cards({C(0, 0), C(1, 1)});
+        request.board = Cards({C(12, 3), C(11, 3), C(10, 3), C(9, 3), C(8, 3)});
+        request.opponents = 1;
+        request.maxSamples = 1000;
+        request.seed = 1;
+
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE(result.tie == 1.0);
+        REQUIRE(result.equity == Catch::Approx(0.5));
+    }
+}
+
+TEST_CASE("EquityEngine - Budgets", "[equity_engine]") {
+    ThreadPool pool(2);
+    EquityRequest request;
+    request.hole = Cards({C(5, 0), C(6, 0)});
+    request.opponents = 2;
+
+    SECTION("Same seed gives the same result") {
+        request.maxSamples = 5000;
+        request.seed = 99;
+        EquityResult a = EquityEngine::Calculate(request, &pool);
+        EquityResult b = EquityEngine::Calculate(request, &pool);
+        REQUIRE(a.equity == b.equity);
+        REQUIRE(a.samples == b.samples);
+    }
+
+    SECTION("Time budget stops early") {
+        request.maxSamples = 100000000;
+        request.maxSeconds = 0.01f;
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE(result.samples > 0);
+        REQUIRE(result.samples < 100000000);
+    }
+
+    SECTION("Runs without a pool") {
+        request.maxSamples = 1000;
+        EquityResult result = EquityEngine::Calculate(request, nullptr);
+        REQUIRE(result.samples == 1000);
+    }
+
+    SECTION("No opponents means the pot is ours") {
+        request.opponents = 0;
+        REQUIRE(EquityEngine::Calculate(request, &pool).equity == 1.0);
+    }
+}
+
+TEST_CASE("EquityEngine - Exact enumeration", "[equity_engine]") {
+    ThreadPool pool(2);
+
+    SECTION("Completion counts") {
+        REQUIRE(EquityEngine::CountCompletions(45, 0, 1) == 990.0);
+        REQUIRE(EquityEngine::CountCompletions(46, 1, 1) == 46.0 * 990.0);
+        REQUIRE(EquityEngine::CountCompletions(47, 2, 1) == 1081.0 * 990.0);
+        REQUIRE(EquityEngine::CountCompletions(45, 0, 2) == 990.0 * 903.0);
+    }
+
+    SECTION("Late streets switch to exact results automatically") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(11, 0)});
+        request.board = Cards({C(10, 0), C(3, 1), C(0, 2), C(7, 3)});
+        request.maxSamples = 500;
+
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE(result.exact);
+        REQUIRE(result.samples == 46 * 990);
+        REQUIRE(result.margin == 0.0);
+        REQUIRE(result.equity == Catch::Approx(result.win + result.tie / 2.0));
+
+        // Same answer on any thread count, and from the sampler within its margin
+        EquityResult single = EquityEngine::Enumerate(request, nullptr);
+        REQUIRE(single.equity == Catch::Approx(result.equity).epsilon(1e-12));
+        request.maxSamples = 200000;
+        request.seed = 3;
+        EquityResult sampled = EquityEngine::Sample(request, &pool);
+        REQUIRE_FALSE(sampled.exact);
+        REQUIRE(std::abs(sampled.equity - result.equity) < 2.0 * sampled.margin + 1e-3);
+
+        // A threshold of 0 always samples
+        request.maxSamples = 500;
+        request.exactThreshold = 0;
+        REQUIRE_FALSE(EquityEngine::Calculate(request, &pool).exact);
+    }
+
+    SECTION("Early streets keep sampling") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(11, 0)});
+        request.board = Cards({C(10, 0), C(3, 1), C(0, 2)});
+        request.maxSamples = 1000;
+        EquityResult result = EquityEngine::Calculate(request, &pool);
+        REQUIRE_FALSE(result.exact);
+        REQUIRE(result.samples == 1000);
+    }
+
+    SECTION("River against one hand counts every holding") {
+        // Top set on a dry river: every one of the 990 holdings is counted once
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(12, 1)});
+        request.board = Cards({C(12, 2), C(7, 3), C(3, 0), C(0, 1), C(5, 2)});
+        EquityResult result = EquityEngine::Calculate(request, nullptr);
+        REQUIRE(result.exact);
+        REQUIRE(result.samples == 990);
+
+        // Same counts by brute force with the plain evaluator
+        HandStrength ours = HandEvaluator::Evaluate(request.hole | request.board);
+        int wins = 0, ties = 0, total = 0;
+        CardMask live = ~(request.hole | request.board);
+        for (int a = 0; a < NUM_CARDS; a++) {
+            for (int b = a + 1; b < NUM_CARDS; b++) {
+                if (!live.Has(a) || !live.Has(b)) continue;
+                HandStrength theirs = HandEvaluator::Evaluate(request.board | Cards({a, b}));
+                total++;
+                if (theirs < ours) wins++;
+                else if (theirs == ours) ties++;
+            }
+        }
+        REQUIRE(total == 990);
+        REQUIRE(result.win == Catch::Approx((double)wins / total));
+        REQUIRE(result.tie == Catch::Approx((double)ties / total));
+    }
+
+    SECTION("Suit isomorphism doesn't change the answer") {
+        // Monotone flop: the three other suits are interchangeable, so most runouts are folded together
+        EquityRequest request;
+        request.hole = Cards({C(12, 3), C(2, 3)});
+        request.board = Cards({C(9, 3), C(6, 3), C(1, 2)});
+        EquityResult exact = EquityEngine::Enumerate(request, &pool);
+        REQUIRE(exact.samples == 1081 * 990);
+
+        // Brute force over every turn/river and opponent holding
+        CardMask known = request.hole | request.board;
+        double equity = 0.0;
+        long long total = 0;
+        for (int t = 0; t < NUM_CARDS; t++) {
+            for (int r = t + 1; r < NUM_CARDS; r++) {
+                if (known.Has(t) || known.Has(r)) continue;
+                CardMask board = request.board | Cards({t, r});
+                HandStrength ours = HandEvaluator::Evaluate(request.hole | board);
+                for (int a = 0; a < NUM_CARDS; a++) {
+                    for (int b = a + 1; b < NUM_CARDS; b++) {
+                        if ((known | board).Has(a) || (known | board).Has(b)) continue;
+                        HandStrength theirs = HandEvaluator::Evaluate(board | Cards({a, b}));
+                        equity += (ours > theirs) ? 1.0 : (ours == theirs) ? 0.5 : 0.0;
+                        total++;
+                    }
+                }
+            }
+        }
+        REQUIRE(total == 1081LL * 990LL);
+        REQUIRE(exact.equity == Catch::Approx(equity / total).epsilon(1e-9));
+    }
+
+    SECTION("Multiway river") {
+        EquityRequest request;
+        request.hole = Cards({C(12, 0), C(12, 1)});
+        request.board = Cards({C(12, 2), C(7, 3), C(3, 0), C(0, 1), C(5, 2)});
+        request.opponents = 2;
+        EquityResult exact = EquityEngine::Enumerate(request, &pool);
+        REQUIRE(exact.samples == 990 * 903);
+
+        request.maxSamples = 100000;
+        request.seed = 11;
+        EquityResult sampled = EquityEngine::Sample(request, &pool);
+        REQUIRE(std::abs(sampled.equity - exact.equity) < 2.0 * sampled.margin + 1e-3);
+    }
+}
@@ -0,0 +1,104 @@
+#include "catch_amalgamated.hpp"
+
+#include "gameplay/fast_deck.hpp"
+
+TEST_CASE("Rng - Seeding", "[rng]") {
+    SECTION("Same seed gives the same sequence") {
+        Rng a(42);
+        Rng b(42);
+        for (int i = 0; i < 100; i++) {
+            REQUIRE(a.Next() == b.Next());
+        }
+    }
+
+    SECTION("Different seeds diverge") {
+        Rng a(1);
+        Rng b(2);
+        REQUIRE(a.Next() != b.Next());
+    }
+
+    SECTION("Below stays in range and covers it") {
+        Rng rng(7);
+        int counts[10] = {0};
+        for (int i = 0; i < 10000; i++) {
+            uint32_t value = rng.Below(10);
+            REQUIRE(value < 10);
+            counts[value]++;
+        }
+        for (int count : counts) {
+            REQUIRE(count > 850);
+            REQUIRE(count < 1150);
+        }
+    }
+}
+
+TEST_CASE("FastDeck - Dealing", "[fast_deck]") {
+    FastDeck deck(5);
+
+    SECTION("Deals all 52 cards once each") {
+        CardMask seen;
+        for (int i = 0; i < NUM_CARDS; i++) {
+            int card = deck.Deal();
+            REQUIRE(card >= 0);
+            REQUIRE_FALSE(seen.Has(card));
+            seen.Add(card);
+        }
+        REQUIRE(deck.IsEmpty());
+        REQUIRE(deck.Deal() == -1);
+        REQUIRE(seen == CardMask::FullDeck());
+    }
+
+    SECTION("Reset puts dealt cards back") {
+        for (int i = 0; i < 10; i++) deck.Deal();
+        REQUIRE(deck.GetRemaining() == 42);
+        deck.Reset();
+        REQUIRE(deck.GetRemaining() == NUM_CARDS);
+        REQUIRE(deck.GetRemainingMask() == CardMask::FullDeck());
+    }
+
+    SECTION("Peek shows the next card") {
+        int peeked = deck.Peek();
+        REQUIRE(deck.Peek() == peeked);
+        REQUIRE(deck.Deal() == peeked);
+    }
+
+    SECTION("Same seed deals the same cards") {
+        FastDeck other(5);
+        for (int i = 0; i < 20; i++) {
+            REQUIRE(deck.Deal() == other.Deal());
+        }
+    }
+}
+
+TEST_CASE("FastDeck - Dead cards", "[fast_deck]") {
+    FastDeck deck(11);
+    CardMask dead = CardMask::FromIndex(0) | CardMask::FromIndex(17) | CardMask::FromIndex(51);
+    deck.RemoveDead(dead);
+    REQUIRE(deck.GetRemaining() == NUM_CARDS - 3);
+
+    SECTION("Dead cards never come out, even across resets") {
+        for (int round = 0; round < 50; round++) {
+            deck.Reset();
+            while (!deck.IsEmpty()) {
+                REQUIRE_FALSE(dead.Has(deck.Deal()));
+            }
+        }
+    }
+
+    SECTION("Dealt or already dead cards can't be removed") {
+        REQUIRE_FALSE(deck.RemoveDead(17));
+        int card = deck.Deal();
+        REQUIRE_FALSE(deck.RemoveDead(card));
+    }
+
+    SECTION("Removing the peeked card picks a new one") {
+        int peeked = deck.Peek();
+        REQUIRE(deck.RemoveDead(peeked));
+        REQUIRE(deck.Deal() != peeked);
+    }
+
+    SECTION("ResetAll brings dead cards back") {
+        deck.ResetAll();
+        REQUIRE(deck.GetRemainingMask() == CardMask::FullDeck());
+    }
+}
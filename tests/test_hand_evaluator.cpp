@@ -0,0 +1,264 @@
+#include "catch_amalgamated.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gameplay/hand_evaluator.hpp"
+
+// Card index shorthand for readable test hands (rank index 0 = two ... 12 = ace)
+static int C(int rankIndex, int suit) {
+    return suit * NUM_RANKS + rankIndex;
+}
+
+// Straightforward reference evaluator for exactly five cards (sort + count, no tables)
+static HandStrength ReferenceEvaluate5(const int* cards) {
+    int counts[NUM_RANKS] = {0};
+    bool flush = true;
+    for (int i = 0; i < 5; i++) {
+        counts[cards[i] % NUM_RANKS]++;
+        if (cards[i] / NUM_RANKS != cards[0] / NUM_RANKS) flush = false;
+    }
+
+    // Group ranks by (count desc, rank desc)
+    int groupCount[5];
+    int groupRank[5];
+    int numGroups = 0;
+    for (int c = 4; c >= 1; c--) {
+        for (int r = NUM_RANKS - 1; r >= 0; r--) {
+            if (counts[r] == c) {
+                groupCount[numGroups] = c;
+                groupRank[numGroups] = r;
+                numGroups++;
+            }
+        }
+    }
+
+    int straightHigh = -1;
+    if (numGroups == 5) {
+        if (groupRank[0] - groupRank[4] == 4) {
+            straightHigh = groupRank[0];
+        } else if (groupRank[0] == 12 && groupRank[1] == 3) {
+            straightHigh = 3;  // Wheel
+        }
+    }
+
+    HandRank rank;
+    if (straightHigh >= 0 && flush) rank = (straightHigh == 12) ? ROYAL_FLUSH : STRAIGHT_FLUSH;
+    else if (groupCount[0] == 4) rank = FOUR_OF_KIND;
+    else if (groupCount[0] == 3 && groupCount[1] == 2) rank = FULL_HOUSE;
+    else if (flush) rank = FLUSH;
+    else if (straightHigh >= 0) rank = STRAIGHT;
+    else if (groupCount[0] == 3) rank = THREE_OF_KIND;
+    else if (groupCount[0] == 2 && groupCount[1] == 2) rank = TWO_PAIR;
+    else if (groupCount[0] == 2) rank = PAIR;
+    else rank = HIGH_CARD;
+
+    uint32_t slots = 0;
+    if (straightHigh >= 0) {
+        slots = static_cast<uint32_t>(straightHigh) << 16;
+    } else {
+        for (int i = 0; i < numGroups; i++) {
+            slots |= static_cast<uint32_t>(groupRank[i]) << (16 - 4 * i);
+        }
+    }
+
+    return (static_cast<uint32_t>(rank) << HAND_RANK_SHIFT) | slots;
+}
+
+TEST_CASE("HandEvaluator - Hand categories", "[hand_evaluator]") {
+    SECTION("Royal flush") {
+        int hand[] = {C(12, 0), C(11, 0), C(10, 0), C(9, 0), C(8, 0), C(0, 1), C(1, 2)};
+        REQUIRE(HandEvaluator::GetRank(HandEvaluator::Evaluate(hand, 7)) == ROYAL_FLUSH);
+    }
+
+    SECTION("Wheel straight is five-high") {
+        int wheel[] = {C(12, 0), C(0, 1), C(1, 2), C(2, 3), C(3, 0)};
+        int sixHigh[] = {C(0, 1), C(1, 2), C(2, 3), C(3, 0), C(4, 1)};
+        HandStrength w = HandEvaluator::Evaluate(wheel, 5);
+        REQUIRE(HandEvaluator::GetRank(w) == STRAIGHT);
+        REQUIRE(HandEvaluator::Evaluate(sixHigh, 5) > w);
+    }
+
+    SECTION("Seven cards pick the best five") {
+        // Two trips make a full house, not three of a kind
+        int hand[] = {C(5, 0), C(5, 1), C(5, 2), C(9, 0), C(9, 1), C(9, 2), C(0, 3)};
+        HandStrength s = HandEvaluator::Evaluate(hand, 7);
+        REQUIRE(HandEvaluator::GetRank(s) == FULL_HOUSE);
+        REQUIRE(((s >> 16) & 0xF) == 9);
+        REQUIRE(((s >> 12) & 0xF) == 5);
+    }
+
+    SECTION("Flush beats straight in the same seven cards") {
+        int hand[] = {C(3, 1), C(4, 1), C(5, 2), C(6, 1), C(7, 3), C(10, 1), C(0, 1)};
+        REQUIRE(HandEvaluator::GetRank(HandEvaluator::Evaluate(hand, 7)) == FLUSH);
+    }
+
+    SECTION("Kickers break ties between equal pairs") {
+        int a[] = {C(12, 0), C(12, 1), C(11, 2), C(4, 3), C(2, 0), C(1, 1), C(0, 2)};
+        int b[] = {C(12, 2), C(12, 3), C(10, 2), C(4, 1), C(2, 2), C(1, 3), C(0, 0)};
+        REQUIRE(HandEvaluator::Evaluate(a, 7) > HandEvaluator::Evaluate(b, 7));
+    }
+
+    SECTION("Mask and index array overloads agree") {
+        int hand[] = {C(12, 0), C(11, 0), C(7, 2), C(7, 3), C(2, 0), C(9, 0), C(4, 0)};
+        CardMask mask;
+        for (int card : hand) mask.Add(card);
+        REQUIRE(HandEvaluator::Evaluate(mask) == HandEvaluator::Evaluate(hand, 7));
+        REQUIRE(HandEvaluator::GetRank(HandEvaluator::Evaluate(mask)) == FLUSH);
+    }
+
+    SECTION("Identical ranks in different suits split") {
+        int a[] = {C(12, 0), C(11, 1), C(7, 2), C(5, 3), C(2, 0)};
+        int b[] = {C(12, 1), C(11, 2), C(7, 3), C(5, 0), C(2, 1)};
+        REQUIRE(HandEvaluator::Evaluate(a, 5) == HandEvaluator::Evaluate(b, 5));
+    }
+}
+
+TEST_CASE("HandEvaluator - Every 5-card hand matches reference", "[hand_evaluator]") {
+    int rankCounts[10] = {0};
+    std::vector<bool> seen(1 << 24, false);
+    int distinct = 0;
+    int mismatches = 0;
+    int total = 0;
+
+    int hand[5];
+    for (hand[0] = 0; hand[0] < NUM_CARDS; hand[0]++)
+    for (hand[1] = hand[0] + 1; hand[1] < NUM_CARDS; hand[1]++)
+    for (hand[2] = hand[1] + 1; hand[2] < NUM_CARDS; hand[2]++)
+    for (hand[3] = hand[2] + 1; hand[3] < NUM_CARDS; hand[3]++)
+    for (hand[4] = hand[3] + 1; hand[4] < NUM_CARDS; hand[4]++) {
+        HandStrength s = HandEvaluator::Evaluate(hand, 5);
+        if (s != ReferenceEvaluate5(hand)) mismatches++;
+        rankCounts[HandEvaluator::GetRank(s)]++;
+        if (!seen[s]) {
+            seen[s] = true;
+            distinct++;
+        }
+        total++;
+    }
+
+    REQUIRE(total == 2598960);
+    REQUIRE(mismatches == 0);
+
+    // Known 5-card poker distribution
+    REQUIRE(rankCounts[ROYAL_FLUSH] == 4);
+    REQUIRE(rankCounts[STRAIGHT_FLUSH] == 36);
+    REQUIRE(rankCounts[FOUR_OF_KIND] == 624);
+    REQUIRE(rankCounts[FULL_HOUSE] == 3744);
+    REQUIRE(rankCounts[FLUSH] == 5108);
+    REQUIRE(rankCounts[STRAIGHT] == 10200);
+    REQUIRE(rankCounts[THREE_OF_KIND] == 54912);
+    REQUIRE(rankCounts[TWO_PAIR] == 123552);
+    REQUIRE(rankCounts[PAIR] == 1098240);
+    REQUIRE(rankCounts[HIGH_CARD] == 1302540);
+
+    // Exactly 7462 distinct hand values exist
+    REQUIRE(distinct == 7462);
+}
+
+TEST_CASE("HandEvaluator - 7-card hands equal best 5-card subset", "[hand_evaluator]") {
+    std::mt19937 rng(12345);
+    int deck[NUM_CARDS];
+    for (int i = 0; i < NUM_CARDS; i++) deck[i] = i;
+
+    int mismatches = 0;
+    for (int trial = 0; trial < 20000; trial++) {
+        std::shuffle(deck, deck + NUM_CARDS, rng);
+
+        HandStrength best = 0;
+        for (int skipA = 0; skipA < 7; skipA++) {
+            for (int skipB = skipA + 1; skipB < 7; skipB++) {
+                int five[5];
+                int n = 0;
+                for (int i = 0; i < 7; i++) {
+                    if (i != skipA && i != skipB) five[n++] = deck[i];
+                }
+                best = std::max(best, ReferenceEvaluate5(five));
+            }
+        }
+
+        if (HandEvaluator::Evaluate(deck, 7) != best) mismatches++;
+    }
+
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("HandEvaluator - Batch kernels match scalar", "[hand_evaluator]") {
+    EvaluatorKernel original = HandEvaluator::GetKernel();
+    REQUIRE(HandEvaluator::IsKernelSupported(KERNEL_SCALAR));
+
+    // Every 5-card hand plus random 6- and 7-card hands
+    std::vector<CardMask> hands;
+    hands.reserve(2598960 + 40000);
+    int five[5];
+    for (five[0] = 0; five[0] < NUM_CARDS; five[0]++)
+    for (five[1] = five[0] + 1; five[1] < NUM_CARDS; five[1]++)
+    for (five[2] = five[1] + 1; five[2] < NUM_CARDS; five[2]++)
+    for (five[3] = five[2] + 1; five[3] < NUM_CARDS; five[3]++)
+    for (five[4] = five[3] + 1; five[4] < NUM_CARDS; five[4]++) {
+        CardMask mask;
+        for (int card : five) mask.Add(card);
+        hands.push_back(mask);
+    }
+
+    std::mt19937 rng(777);
+    int deck[NUM_CARDS];
+    for (int i = 0; i < NUM_CARDS; i++) deck[i] = i;
+    for (int trial = 0; trial < 40000; trial++) {
+        std::shuffle(deck, deck + NUM_CARDS, rng);
+        CardMask mask;
+        for (int i = 0; i < 6 + (trial & 1); i++) mask.Add(deck[i]);
+        hands.push_back(mask);
+    }
+
+    std::vector<HandStrength> expected(hands.size());
+    for (size_t i = 0; i < hands.size(); i++) expected[i] = HandEvaluator::Evaluate(hands[i]);
+
+    const EvaluatorKernel kernels[] = {KERNEL_SCALAR, KERNEL_SSE4, KERNEL_AVX2};
+    for (EvaluatorKernel kernel : kernels) {
+        if (!HandEvaluator::SetKernel(kernel)) continue;
+        INFO("kernel " << HandEvaluator::GetKernelName(kernel));
+
+        SECTION(std::string("Every hand matches with ") + HandEvaluator::GetKernelName(kernel)) {
+            std::vector<HandStrength> batch(hands.size());
+            HandEvaluator::EvaluateBatch(hands.data(), (int)hands.size(), batch.data());
+
+            int mismatches = 0;
+            for (size_t i = 0; i < hands.size(); i++) {
+                if (batch[i] != expected[i]) mismatches++;
+            }
+            REQUIRE(mismatches == 0);
+        }
+
+        SECTION(std::string("Shared board and ragged counts with ") + HandEvaluator::GetKernelName(kernel)) {
+            // Flop + turn + river shared by 1..19 hole-card pairs (exercises the scalar tail)
+            for (int count = 1; count < 20; count++) {
+                std::shuffle(deck, deck + NUM_CARDS, rng);
+                CardMask board;
+                for (int i = 0; i < 5; i++) board.Add(deck[i]);
+
+                CardMask holes[20];
+                HandStrength strengths[20];
+                for (int h = 0; h < count; h++) {
+                    holes[h] = CardMask::FromIndex(deck[5 + (2 * h) % 40]) | CardMask::FromIndex(deck[6 + (2 * h) % 40]);
+                }
+                HandEvaluator::EvaluateBatch(board, holes, count, strengths);
+                for (int h = 0; h < count; h++) {
+                    REQUIRE(strengths[h] == HandEvaluator::Evaluate(holes[h] | board));
+                }
+            }
+        }
+    }
+
+    HandEvaluator::SetKernel(original);
+}
+
+TEST_CASE("HandEvaluator - Kernel selection", "[hand_evaluator]") {
+    EvaluatorKernel kernel = HandEvaluator::GetKernel();
+    REQUIRE(HandEvaluator::IsKernelSupported(kernel));
+    REQUIRE(HandEvaluator::SetKernel(KERNEL_SCALAR));
+    REQUIRE(HandEvaluator::GetKernel() == KERNEL_SCALAR);
+    REQUIRE_FALSE(HandEvaluator::SetKernel(static_cast<EvaluatorKernel>(99)));
+    REQUIRE(HandEvaluator::SetKernel(kernel));
+}
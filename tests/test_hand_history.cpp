@@ -0,0 +1,221 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <string>
+
+#include "gameplay/hand_history.hpp"
+
+#define TEST_HISTORY_BASE "test_hand_history_tmp"
+
+static void RemoveSegments(const std::string& base) {
+    for (const std::string& path : HandHistoryReader::ListSegments(base)) {
+        std::remove(path.c_str());
+    }
+}
+
+// Plays hands with a fixed action cycle (call, call, min-raise, fold...) and records them
+static void RecordHands(HandHistoryRecorder& history, PokerEngine& engine, int hands) {
+    int step = 0;
+    for (int h = 0; h < hands; h++) {
+        if (!engine.StartHand()) return;
+        history.BeginHand(engine);
+
+        while (engine.IsBetting()) {
+            PokerAction action(ACTION_CALL);
+            if (step % 7 == 3) action = PokerAction(ACTION_RAISE, engine.GetMinRaise());
+            if (step % 11 == 5) action = PokerAction(ACTION_FOLD);
+            step++;
+
+            history.RecordAction(engine.GetCurrentSeat(), engine.GetPhase(), action);
+            engine.ApplyAction(action);
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) engine.ResolveShowdown();
+        history.EndHand(engine);
+    }
+}
+
+TEST_CASE("HandHistory - Round trip", "[hand_history]") {
+    RemoveSegments(TEST_HISTORY_BASE);
+
+    PokerEngine engine(99);
+    for (int i = 0; i < 4; i++) engine.SitDown(i, 1000);
+
+    HandHistoryRecorder history;
+    REQUIRE(history.Open(TEST_HISTORY_BASE));
+
+    // Record one hand by hand so the file can be checked against the engine
+    REQUIRE(engine.StartHand());
+    history.BeginHand(engine);
+    uint64_t seed = engine.GetHandSeed();
+    int hole0 = engine.GetSeat(0).holeCards[0];
+    int actions = 0;
+    while (engine.IsBetting()) {
+        PokerAction action(ACTION_CALL);
+        history.RecordAction(engine.GetCurrentSeat(), engine.GetPhase(), action);
+        engine.ApplyAction(action);
+        actions++;
+    }
+    engine.ResolveShowdown();
+    history.EndHand(engine);
+
+    RecordHands(history, engine, 20);
+    uint64_t recorded = history.GetHandCount();
+    history.Close();
+
+    HandHistoryReader reader;
+    REQUIRE(reader.Open(HandHistoryRecorder::SegmentPath(TEST_HISTORY_BASE, 0)));
+
+    SECTION("First record matches the hand that was played") {
+        HandView hand;
+        REQUIRE(reader.Next(hand));
+        const HandRecord& r = *hand.header;
+        REQUIRE(r.handId == 0);
+        REQUIRE(r.deckSeed == seed);
+        REQUIRE(r.seatMask == 0x0F);
+        REQUIRE(r.smallBlind == SMALL_BLIND_AMOUNT);
+        REQUIRE(r.bigBlind == BIG_BLIND_AMOUNT);
+        REQUIRE(r.holeCards[0][0] == hole0);
+        REQUIRE(r.holeCards[5][0] == -1);
+        REQUIRE(r.startStacks[0] == 1000);
+        REQUIRE(r.boardCount == BOARD_SIZE);
+        REQUIRE(r.actionCount == actions);
+        REQUIRE(r.showdownMask == 0x0F);
+
+        // Checked down, so the board and every hole card showed
+        CardMask board;
+        for (int i = 0; i < BOARD_SIZE; i++) board.Add(r.board[i]);
+        REQUIRE(board.Count() == BOARD_SIZE);
+        REQUIRE(CardMask(r.shownHands[0]).Has(hole0));
+
+        int paid = 0;
+        for (int i = 0; i < MAX_SEATS; i++) paid += r.payouts[i];
+        REQUIRE(paid == 4 * BIG_BLIND_AMOUNT);
+
+        REQUIRE(hand.actions[0].seat == 2);    // First to act after the big blind
+        REQUIRE(hand.actions[0].phase == PHASE_PREFLOP);
+        REQUIRE(hand.actions[0].type == ACTION_CALL);
+    }
+
+    SECTION("Every recorded hand reads back in order") {
+        HandView hand;
+        uint64_t count = 0;
+        while (reader.Next(hand)) {
+            const HandRecord& r = *hand.header;
+            REQUIRE(r.handId == count);
+
+            // Someone always gets paid, and never more than was on the table
+            int stacks = 0;
+            int paid = 0;
+            for (int i = 0; i < MAX_SEATS; i++) {
+                stacks += r.startStacks[i];
+                paid += r.payouts[i];
+            }
+            REQUIRE(paid > 0);
+            REQUIRE(paid <= stacks);
+
+            for (int a = 0; a < r.actionCount; a++) {
+                REQUIRE((r.seatMask & (1u << hand.actions[a].seat)) != 0);
+            }
+            count++;
+        }
+        REQUIRE(count == recorded);
+    }
+
+    reader.Close();
+    RemoveSegments(TEST_HISTORY_BASE);
+}
+
+TEST_CASE("HandHistory - Segments", "[hand_history]") {
+    RemoveSegments(TEST_HISTORY_BASE);
+
+    PokerEngine engine(5);
+    for (int i = 0; i < 3; i++) engine.SitDown(i, 500);
+
+    SECTION("Large histories roll over into new segments") {
+        HandHistoryRecorder history;
+        REQUIRE(history.Open(TEST_HISTORY_BASE, 4096));
+        RecordHands(history, engine, 100);
+        uint64_t recorded = history.GetHandCount();
+        REQUIRE(history.GetSegment() > 0);
+        history.Close();
+
+        uint64_t read = 0;
+        for (const std::string& path : HandHistoryReader::ListSegments(TEST_HISTORY_BASE)) {
+            HandHistoryReader reader;
+            REQUIRE(reader.Open(path));
+            REQUIRE(reader.GetSize() <= 4096);
+            HandView hand;
+            while (reader.Next(hand)) {
+                REQUIRE(hand.header->handId == read);
+                read++;
+            }
+        }
+        REQUIRE(read == recorded);
+    }
+
+    SECTION("Reopening appends a new segment instead of overwriting") {
+        HandHistoryRecorder history;
+        REQUIRE(history.Open(TEST_HISTORY_BASE));
+        RecordHands(history, engine, 3);
+        history.Close();
+
+        REQUIRE(history.Open(TEST_HISTORY_BASE));
+        REQUIRE(history.GetSegment() == 1);
+        history.Close();
+    }
+
+    SECTION("Recorders sharing a base never overwrite each other's segments") {
+        PokerEngine other(5);
+        for (int i = 0; i < 3; i++) other.SitDown(i, 500);
+
+        HandHistoryRecorder first, second;
+        REQUIRE(first.Open(TEST_HISTORY_BASE, 4096));
+        REQUIRE(second.Open(TEST_HISTORY_BASE, 4096));
+        REQUIRE(second.GetSegment() != first.GetSegment());
+
+        // Interleave so both keep rolling over into indices the other may have taken
+        for (int round = 0; round < 20; round++) {
+            RecordHands(first, engine, 5);
+            RecordHands(second, other, 5);
+        }
+        uint64_t recorded = first.GetHandCount() + second.GetHandCount();
+        REQUIRE(first.GetSegment() > 1);
+        REQUIRE(second.GetSegment() > 1);
+        first.Close();
+        second.Close();
+
+        uint64_t read = 0;
+        for (const std::string& path : HandHistoryReader::ListSegments(TEST_HISTORY_BASE)) {
+            HandHistoryReader reader;
+            REQUIRE(reader.Open(path));
+            HandView hand;
+            while (reader.Next(hand)) read++;
+        }
+        REQUIRE(read == recorded);
+    }
+
+    SECTION("A truncated tail ends the iteration") {
+        HandHistoryRecorder history;
+        REQUIRE(history.Open(TEST_HISTORY_BASE));
+        RecordHands(history, engine, 2);
+        history.Close();
+
+        // Chop the last few bytes off, as if the game died mid-write
+        std::string path = HandHistoryRecorder::SegmentPath(TEST_HISTORY_BASE, 0);
+        FILE* f = fopen(path.c_str(), "rb");
+        std::string bytes;
+        int c;
+        while ((c = fgetc(f)) != EOF) bytes.push_back(static_cast<char>(c));
+        fclose(f);
+        f = fopen(path.c_str(), "wb");
+        fwrite(bytes.data(), 1, bytes.size() - 4, f);
+        fclose(f);
+
+        HandHistoryReader reader;
+        REQUIRE(reader.Open(path));
+        HandView hand;
+        REQUIRE(reader.Next(hand));
+        REQUIRE_FALSE(reader.Next(hand));
+    }
+
+    RemoveSegments(TEST_HISTORY_BASE);
+}
@@ -0,0 +1,125 @@
+#include "catch_amalgamated.hpp"
+#include "gameplay/hand_optimizer.hpp"
+#include "gameplay/fast_deck.hpp"
+#include "items/card.hpp"
+
+// Every pair, no pruning
+static HandStrength BruteForceBestTwo(CardMask held, CardMask board) {
+    int cards[NUM_CARDS];
+    int count = 0;
+    for (CardMask rest = held & ~board; !rest.IsEmpty();) {
+        cards[count++] = rest.PopFirst();
+    }
+
+    HandStrength best = 0;
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            CardMask pair = CardMask::FromIndex(cards[a]) | CardMask::FromIndex(cards[b]);
+            HandStrength s = HandEvaluator::Evaluate(pair | board);
+            if (s > best) best = s;
+        }
+    }
+    return best;
+}
+
+static CardMask Deal(FastDeck& deck, int count) {
+    CardMask mask;
+    for (int i = 0; i < count; i++) {
+        mask.Add(deck.Deal());
+    }
+    return mask;
+}
+
+TEST_CASE("HandOptimizer - Small holdings", "[hand_optimizer]") {
+    CardMask board;
+    board.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_KING));
+    board.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_SEVEN));
+    board.Add(CardMask::CardIndex(SUIT_SPADES, RANK_TWO));
+
+    SECTION("Nothing held") {
+        HandChoice choice = HandOptimizer::BestTwo(CardMask(), board);
+        REQUIRE(choice.cards[0] == -1);
+        REQUIRE(choice.cards[1] == -1);
+        REQUIRE(choice.GetMask().IsEmpty());
+    }
+
+    SECTION("Two cards are shown as they are") {
+        CardMask held;
+        held.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_ACE));
+        held.Add(CardMask::CardIndex(SUIT_DIAMONDS, RANK_THREE));
+
+        HandChoice choice = HandOptimizer::BestTwo(held, board);
+        REQUIRE(choice.GetMask() == held);
+        REQUIRE(choice.strength == HandEvaluator::Evaluate(held | board));
+    }
+
+    SECTION("Held cards that are already on the board don't count") {
+        CardMask held = board;
+        held.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_ACE));
+        held.Add(CardMask::CardIndex(SUIT_DIAMONDS, RANK_ACE));
+
+        HandChoice choice = HandOptimizer::BestTwo(held, board);
+        REQUIRE((choice.GetMask() & board).IsEmpty());
+        REQUIRE(choice.GetMask().Has(CardMask::CardIndex(SUIT_HEARTS, RANK_ACE)));
+        REQUIRE(choice.GetMask().Has(CardMask::CardIndex(SUIT_DIAMONDS, RANK_ACE)));
+    }
+}
+
+TEST_CASE("HandOptimizer - Picks the best legal pair", "[hand_optimizer]") {
+    SECTION("Completes the flush instead of pairing the board") {
+        CardMask board;
+        board.Add(CardMask::CardIndex(SUIT_SPADES, RANK_TWO));
+        board.Add(CardMask::CardIndex(SUIT_SPADES, RANK_NINE));
+        board.Add(CardMask::CardIndex(SUIT_SPADES, RANK_JACK));
+        board.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_KING));
+        board.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_FOUR));
+
+        CardMask held;
+        held.Add(CardMask::CardIndex(SUIT_DIAMONDS, RANK_KING));
+        held.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_KING));
+        held.Add(CardMask::CardIndex(SUIT_SPADES, RANK_THREE));
+        held.Add(CardMask::CardIndex(SUIT_SPADES, RANK_FIVE));
+        held.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_NINE));
+
+        HandChoice choice = HandOptimizer::BestTwo(held, board);
+        // Quads need three kings from hand - only two may be shown, so trips-vs-flush decides
+        REQUIRE(HandEvaluator::GetRank(choice.strength) == FLUSH);
+        REQUIRE(choice.GetMask().Has(CardMask::CardIndex(SUIT_SPADES, RANK_THREE)));
+        REQUIRE(choice.GetMask().Has(CardMask::CardIndex(SUIT_SPADES, RANK_FIVE)));
+    }
+
+    SECTION("Never uses more than two held cards") {
+        CardMask held;
+        held.Add(CardMask::CardIndex(SUIT_HEARTS, RANK_ACE));
+        held.Add(CardMask::CardIndex(SUIT_DIAMONDS, RANK_ACE));
+        held.Add(CardMask::CardIndex(SUIT_CLUBS, RANK_ACE));
+        held.Add(CardMask::CardIndex(SUIT_SPADES, RANK_ACE));
+
+        HandChoice choice = HandOptimizer::BestTwo(held, CardMask());
+        REQUIRE(choice.GetMask().Count() == 2);
+        REQUIRE(HandEvaluator::GetRank(choice.strength) == PAIR);
+    }
+}
+
+TEST_CASE("HandOptimizer - Matches brute force", "[hand_optimizer]") {
+    FastDeck deck(20240611);
+
+    for (int trial = 0; trial < 400; trial++) {
+        deck.Reset();
+        int boardCount = trial % 6;
+        int heldCount = 3 + (trial * 7) % 30;
+
+        CardMask board = Deal(deck, boardCount);
+        CardMask held = Deal(deck, heldCount);
+
+        HandChoice choice = HandOptimizer::BestTwo(held, board);
+        CardMask shown = choice.GetMask();
+
+        INFO("trial " << trial << " held " << heldCount << " board " << boardCount);
+        REQUIRE(shown.Count() == 2);
+        REQUIRE((shown & held) == shown);
+        REQUIRE(choice.strength == HandEvaluator::Evaluate(shown | board));
+        REQUIRE(choice.strength == BruteForceBestTwo(held, board));
+        REQUIRE(choice.evaluated <= heldCount * (heldCount - 1) / 2);
+    }
+}
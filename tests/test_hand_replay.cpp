@@ -0,0 +1,221 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gameplay/hand_replay.hpp"
+#include "gameplay/poker_table.hpp"
+#include "entities/enemy.hpp"
+#include "items/chip.hpp"
+#include "core/dom.hpp"
+
+#define TEST_REPLAY_BASE "test_hand_replay_tmp"
+
+static void RemoveSegments(const std::string& base) {
+    for (const std::string& path : HandHistoryReader::ListSegments(base)) {
+        std::remove(path.c_str());
+    }
+}
+
+// Random mix of folds, calls and raises of random size, so side pots and all-ins show up
+template <int Seats = DEFAULT_TABLE_SEATS>
+static void RecordRandomHands(const std::string& base, uint64_t seed, int hands, int players = 6, int ante = 0) {
+    PokerEngineT<Seats> engine(seed);
+    Rng rng(seed + 1);
+    for (int i = 0; i < players; i++) engine.SitDown(i, 2000 + 500 * i);
+    engine.SetBlinds(SMALL_BLIND_AMOUNT, BIG_BLIND_AMOUNT, ante);
+
+    HandHistoryRecorder history;
+    history.Open(base);
+    for (int h = 0; h < hands; h++) {
+        if (!engine.StartHand()) break;
+        history.BeginHand(engine);
+        while (engine.IsBetting()) {
+            int seat = engine.GetCurrentSeat();
+            uint32_t roll = rng.Below(10);
+            PokerAction action(ACTION_CALL);
+            if (roll == 0) action = PokerAction(ACTION_FOLD);
+            else if (roll <= 2) action = PokerAction(ACTION_RAISE, engine.GetMinRaise() + rng.Below(200));
+            history.RecordAction(seat, engine.GetPhase(), action);
+            engine.ApplyAction(action);
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) engine.ResolveShowdown();
+        history.EndHand(engine);
+    }
+}
+
+// Copies of every hand in a history (header + actions)
+struct StoredHand {
+    HandRecord header;
+    std::vector<HandActionRecord> actions;
+
+    HandView View() const {
+        HandView view;
+        view.header = &header;
+        view.actions = actions.data();
+        return view;
+    }
+};
+
+static std::vector<StoredHand> LoadHands(const std::string& base) {
+    std::vector<StoredHand> hands;
+    for (const std::string& path : HandHistoryReader::ListSegments(base)) {
+        HandHistoryReader reader;
+        if (!reader.Open(path)) continue;
+        HandView view;
+        while (reader.Next(view)) {
+            StoredHand hand;
+            hand.header = *view.header;
+            hand.actions.assign(view.actions, view.actions + view.header->actionCount);
+            hands.push_back(hand);
+        }
+    }
+    return hands;
+}
+
+TEST_CASE("HandReplay - Engine replays", "[hand_replay]") {
+    RemoveSegments(TEST_REPLAY_BASE);
+    RecordRandomHands(TEST_REPLAY_BASE, 21, 300);
+    std::vector<StoredHand> hands = LoadHands(TEST_REPLAY_BASE);
+    REQUIRE(hands.size() > 20);
+
+    SECTION("Every recorded hand replays to the same stacks") {
+        int showdowns = 0;
+        for (const StoredHand& hand : hands) {
+            ReplayResult result = HandReplay::Replay(hand.View());
+            REQUIRE(result.matched);
+            REQUIRE(result.failedAction == -1);
+            if (hand.header.showdownMask != 0) showdowns++;
+        }
+        REQUIRE(showdowns > 0);
+    }
+
+    SECTION("A wrong payout is caught") {
+        StoredHand hand = hands[0];
+        int winner = 0;
+        while (hand.header.payouts[winner] == 0) winner++;
+        hand.header.endStacks[winner] += 10;
+
+        ReplayResult result = HandReplay::Replay(hand.View());
+        REQUIRE_FALSE(result.matched);
+        REQUIRE(result.mismatchSeat == winner);
+        REQUIRE(result.endStacks[winner] == hand.header.endStacks[winner] - 10);
+    }
+
+    SECTION("An action out of turn stops the replay") {
+        StoredHand hand = hands[0];
+        REQUIRE(hand.actions.size() > 1);
+        hand.actions[0].seat = (hand.actions[0].seat + 1) % MAX_SEATS;
+
+        ReplayResult result = HandReplay::Replay(hand.View());
+        REQUIRE_FALSE(result.matched);
+        REQUIRE(result.failedAction == 0);
+    }
+
+    SECTION("A different deck seed deals different cards") {
+        StoredHand hand = hands[0];
+        hand.header.deckSeed ^= 1;
+
+        PokerEngine engine;
+        HandReplay::Prepare(engine, hand.header);
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetSeat(hand.header.smallBlindSeat).holeCards[0] !=
+                hand.header.holeCards[(int)hand.header.smallBlindSeat][0]);
+    }
+
+    RemoveSegments(TEST_REPLAY_BASE);
+}
+
+TEST_CASE("HandReplay - Other table sizes", "[hand_replay]") {
+    SECTION("Heads-up") {
+        RemoveSegments(TEST_REPLAY_BASE);
+        RecordRandomHands<2>(TEST_REPLAY_BASE, 31, 100, 2);
+        std::vector<StoredHand> hands = LoadHands(TEST_REPLAY_BASE);
+        REQUIRE(!hands.empty());
+        for (const StoredHand& hand : hands) {
+            REQUIRE(hand.header.seatCount == 2);
+            REQUIRE(HandReplay::Replay(hand.View()).matched);
+        }
+    }
+
+    SECTION("Ten-max with antes") {
+        RemoveSegments(TEST_REPLAY_BASE);
+        RecordRandomHands<10>(TEST_REPLAY_BASE, 32, 100, 10, 3);
+        std::vector<StoredHand> hands = LoadHands(TEST_REPLAY_BASE);
+        REQUIRE(!hands.empty());
+        for (const StoredHand& hand : hands) {
+            REQUIRE(hand.header.seatCount == 10);
+            REQUIRE(hand.header.ante == 3);
+            REQUIRE(HandReplay::Replay(hand.View()).matched);
+        }
+    }
+
+    SECTION("Unknown table size") {
+        RemoveSegments(TEST_REPLAY_BASE);
+        RecordRandomHands(TEST_REPLAY_BASE, 33, 5);
+        std::vector<StoredHand> hands = LoadHands(TEST_REPLAY_BASE);
+        REQUIRE(!hands.empty());
+        hands[0].header.seatCount = 7;
+        REQUIRE(HandReplay::Replay(hands[0].View()).failedAction == 0);
+    }
+
+    RemoveSegments(TEST_REPLAY_BASE);
+}
+
+TEST_CASE("HandReplay - Table replays a recorded hand", "[hand_replay][poker_table]") {
+    RemoveSegments(TEST_REPLAY_BASE);
+
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+
+    Enemy enemy1({0, 0, 0}, "Player1");
+    Enemy enemy2({1, 0, 0}, "Player2");
+    for (int i = 0; i < 5; i++) {
+        enemy1.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+        enemy2.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    }
+    table.SeatPerson(&enemy1, 0);
+    table.SeatPerson(&enemy2, 1);
+
+    // Play a few live hands (random enemy decisions) and record them
+    REQUIRE(table.StartRecording(TEST_REPLAY_BASE));
+    for (int frame = 0; frame < 60; frame++) {
+        enemy1.Update(5.0f);
+        enemy2.Update(5.0f);
+        table.Update(0.016f);
+    }
+    table.StopRecording();
+
+    std::vector<StoredHand> hands = LoadHands(TEST_REPLAY_BASE);
+    REQUIRE(!hands.empty());
+
+    // Let any hand still running finish live before replaying (the enemies' answers drive it to the end)
+    for (int frame = 0; frame < 100 && table.GetState() != TABLE_IDLE; frame++) {
+        enemy1.Update(5.0f);
+        enemy2.Update(5.0f);
+    }
+
+    for (const StoredHand& hand : hands) {
+        REQUIRE(!table.GetEngine().IsBetting());
+        REQUIRE(table.LoadReplay(hand.View()));
+
+        // No thinking time: the recorded actions drive every frame
+        for (int frame = 0; frame < 400 && table.IsReplaying(); frame++) {
+            table.Update(0.016f);
+        }
+
+        const ReplayResult& result = table.GetReplayResult();
+        REQUIRE(result.failedAction == -1);
+        REQUIRE(result.matched);
+        REQUIRE(enemy1.GetInventory()->GetTotalChipValue() == hand.header.endStacks[0]);
+        REQUIRE(enemy2.GetInventory()->GetTotalChipValue() == hand.header.endStacks[1]);
+    }
+
+    table.UnseatPerson(&enemy1);
+    table.UnseatPerson(&enemy2);
+    dom.Cleanup();
+    RemoveSegments(TEST_REPLAY_BASE);
+}
@@ -264,14 +264,16 @@ TEST_CASE("Inventory - GetStack", "[inventory]") {
         REQUIRE(inv.GetStack(999) == nullptr);
     }
     
-    SECTION("GetStack returns correct typeString") {
+    SECTION("GetStack returns the item and its stack key") {
         Inventory inv;
         Card* card = new Card(SUIT_SPADES, RANK_ACE, {0,0,0}, nullptr);
         
         inv.AddItem(card);
         
         ItemStack* stack = inv.GetStack(0);
-        REQUIRE(stack->typeString.find("card_spades_ace") != std::string::npos);
+        REQUIRE(stack->item == card);
+        REQUIRE(stack->stackKey == card->GetStackKey());
+        REQUIRE(stack->item->GetType().find("card_spades_ace") != std::string::npos);
         
         delete card;
     }
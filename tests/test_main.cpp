@@ -3,6 +3,7 @@
 #include "raylib.h"
 #include "rendering/lighting_manager.hpp"
 #include "core/dom.hpp"
+#include "gameplay/decision_service.hpp"
 
 // Global variables needed by the game code
 bool g_showCollisionDebug = false;
@@ -19,11 +20,17 @@ int main(int argc, char* argv[]) {
     // Initialize global DOM for tests that need it (like PokerTable)
     DOM globalDom;
     DOM::SetGlobal(&globalDom);
+
+    // Enemy decisions resolve inside PromptBet so frame loops stay deterministic
+    // (tests that need real workers set their own service)
+    DecisionService inlineDecisions(0);
+    DecisionService::SetGlobal(&inlineDecisions);
     
     int result = Catch::Session().run(argc, argv);
     
     // Cleanup (must cleanup shader BEFORE closing window)
     DOM::SetGlobal(nullptr);
+    DecisionService::SetGlobal(nullptr);
     LightingManager::CleanupLightingSystem();
     CloseWindow();
     
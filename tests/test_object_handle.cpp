@@ -0,0 +1,129 @@
+#include "catch_amalgamated.hpp"
+#include <vector>
+
+#include "core/dom.hpp"
+#include "core/object_handle.hpp"
+#include "entities/dealer.hpp"
+#include "entities/player.hpp"
+#include "gameplay/poker_table.hpp"
+#include "items/chip.hpp"
+#include "items/chip_stack.hpp"
+
+// ========== HANDLES ==========
+
+TEST_CASE("ObjectHandle - Resolving", "[object_handle]") {
+    SECTION("A default handle is null") {
+        ObjectHandle handle;
+        REQUIRE(handle.IsNull());
+        REQUIRE(DOM::Resolve(handle) == nullptr);
+    }
+
+    SECTION("Live objects resolve to themselves") {
+        Chip chip(5, {0, 0, 0});
+        ObjectHandle handle = chip.GetHandle();
+        REQUIRE_FALSE(handle.IsNull());
+        REQUIRE(DOM::Resolve(handle) == &chip);
+        REQUIRE(DOM::Resolve<Chip>(handle) == &chip);
+        REQUIRE(DOM::Resolve<Item>(handle) == &chip);
+        REQUIRE(DOM::Resolve<Person>(handle) == nullptr);
+    }
+
+    SECTION("Handles go stale when the object is destroyed") {
+        Chip* chip = new Chip(5, {0, 0, 0});
+        ObjectHandle handle = chip->GetHandle();
+        delete chip;
+        REQUIRE(DOM::Resolve(handle) == nullptr);
+    }
+
+    SECTION("A reused slot does not bring old handles back") {
+        Chip* first = new Chip(5, {0, 0, 0});
+        ObjectHandle oldHandle = first->GetHandle();
+        delete first;
+
+        Chip* second = new Chip(10, {0, 0, 0});
+        ObjectHandle newHandle = second->GetHandle();
+        REQUIRE(newHandle.slot == oldHandle.slot);
+        REQUIRE(newHandle.generation != oldHandle.generation);
+        REQUIRE(DOM::Resolve(oldHandle) == nullptr);
+        REQUIRE(DOM::Resolve(newHandle) == second);
+        delete second;
+    }
+
+    SECTION("Copies get their own handle") {
+        Chip chip(25, {0, 0, 0});
+        Chip copy(chip);
+        REQUIRE(copy.GetHandle() != chip.GetHandle());
+        REQUIRE(DOM::Resolve(copy.GetHandle()) == &copy);
+    }
+
+    SECTION("Pack round-trips") {
+        Chip chip(1, {0, 0, 0});
+        ObjectHandle handle = ObjectHandle::Unpack(chip.GetHandle().Pack());
+        REQUIRE(handle == chip.GetHandle());
+    }
+}
+
+// ========== HOLDERS ==========
+
+TEST_CASE("ObjectHandle - ChipStack skips destroyed chips", "[object_handle][chip_stack]") {
+    DOM* originalGlobal = DOM::GetGlobal();
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    ChipStack stack({0, 0, 0});
+    Chip* kept = new Chip(5, {0, 0, 0});
+    Chip* destroyed = new Chip(25, {0, 0, 0});
+    stack.AddChips({kept, destroyed});
+
+    dom.RemoveObject(destroyed);
+    delete destroyed;
+
+    REQUIRE(stack.GetTotalValue() == 5);
+    std::vector<Chip*> removed = stack.RemoveAll();
+    REQUIRE(removed.size() == 1);
+    REQUIRE(removed[0] == kept);
+    delete kept;
+
+    DOM::SetGlobal(originalGlobal);
+}
+
+TEST_CASE("ObjectHandle - PokerTable survives destroyed objects", "[object_handle][poker_table]") {
+    DOM* originalGlobal = DOM::GetGlobal();
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable* table = new PokerTable({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+
+    SECTION("A seat whose occupant was destroyed reads as empty") {
+        Player* player = new Player({0, 0, 0}, nullptr);
+        REQUIRE(table->SeatPerson(player, 0));
+        delete player;
+
+        table->Update(0.016f);
+        REQUIRE(table->GetState() != TABLE_STOPPED);
+        Player next({0, 0, 0}, nullptr);
+        REQUIRE(table->SeatPerson(&next, 0));
+    }
+
+    SECTION("A destroyed dealer stops the game on the next Update") {
+        Dealer* dealer = table->GetDealer();
+        REQUIRE(dealer != nullptr);
+        Player player({0, 0, 0}, nullptr);
+        REQUIRE(table->SeatPerson(&player, 0));
+
+        dom.RemoveObject(dealer);
+        delete dealer;
+        REQUIRE(table->GetDealer() == nullptr);
+
+        table->Update(0.016f);
+        REQUIRE(table->GetState() == TABLE_STOPPED);
+        REQUIRE_FALSE(player.IsSeated());
+        Player late({1, 0, 0}, nullptr);
+        REQUIRE_FALSE(table->SeatPerson(&late, 1));
+    }
+
+    delete table;
+    for (Object* obj : dom.GetObjects()) delete obj;
+    dom.Cleanup();
+    DOM::SetGlobal(originalGlobal);
+}
@@ -0,0 +1,355 @@
+#include "catch_amalgamated.hpp"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include "gameplay/betting_ai.hpp"
+#include "gameplay/hand_history.hpp"
+#include "gameplay/opponent_stats.hpp"
+
+#define TEST_STATS_HISTORY_BASE "test_opponent_stats_tmp"
+
+static const uint32_t TEST_IDS[MAX_SEATS] = {101, 102, 103, 104, 105, 106, 107, 108, 109, 110};
+
+// Applies one action to the engine and feeds it to the hand tracker (and the recorder, if given)
+static void Act(PokerEngine& engine, OpponentStatsHand& hand, PokerActionType type,
+                HandHistoryRecorder* history = nullptr) {
+    int seat = engine.GetCurrentSeat();
+    PokerAction action(type, type == ACTION_RAISE ? engine.GetMinRaise() : 0);
+    HandPhase phase = engine.GetPhase();
+    engine.ApplyAction(action);
+    action.type = engine.GetLastAction();
+    if (history) history->RecordAction(seat, phase, action);
+    hand.RecordAction(seat, phase, action.type);
+}
+
+// Fixed action cycle (call, call, min-raise, fold...) - the same stream goes live and into the file
+static void PlayHands(PokerEngine& engine, OpponentStatsHand& hand, HandHistoryRecorder* history, int hands) {
+    int step = 0;
+    for (int h = 0; h < hands; h++) {
+        if (!engine.StartHand()) return;
+        if (history) history->BeginHand(engine, TEST_IDS);
+        hand.BeginHand(engine, TEST_IDS);
+
+        while (engine.IsBetting()) {
+            PokerActionType type = ACTION_CALL;
+            if (step % 7 == 3) type = ACTION_RAISE;
+            if (step % 11 == 5) type = ACTION_FOLD;
+            step++;
+            Act(engine, hand, type, history);
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) engine.ResolveShowdown();
+        if (history) history->EndHand(engine);
+        hand.EndHand(engine);
+    }
+}
+
+TEST_CASE("OpponentStats - Player ids", "[opponent_stats]") {
+    REQUIRE(OpponentStatsTracker::PlayerId("Enemy 1") == OpponentStatsTracker::PlayerId("Enemy 1"));
+    REQUIRE(OpponentStatsTracker::PlayerId("Enemy 1") != OpponentStatsTracker::PlayerId("Enemy 2"));
+    REQUIRE(OpponentStatsTracker::PlayerId("") != 0);
+}
+
+TEST_CASE("OpponentStats - Counting one hand", "[opponent_stats]") {
+    OpponentStatsTracker stats;
+    OpponentStatsHand hand(&stats);
+    PokerEngine engine(7);
+    for (int i = 0; i < 3; i++) engine.SitDown(i, 1000);
+
+    // Seat 0 small blind, seat 1 big blind, seat 2 opens
+    REQUIRE(engine.StartHand());
+    REQUIRE(engine.GetSmallBlindSeat() == 0);
+    hand.BeginHand(engine, TEST_IDS);
+
+    Act(engine, hand, ACTION_RAISE);   // Seat 2 opens
+    Act(engine, hand, ACTION_CALL);    // Seat 0 flats (passes on a 3-bet)
+    Act(engine, hand, ACTION_RAISE);   // Seat 1 3-bets
+    Act(engine, hand, ACTION_CALL);    // Seat 2 calls
+    Act(engine, hand, ACTION_CALL);    // Seat 0 calls
+    REQUIRE(engine.GetPhase() == PHASE_FLOP);
+
+    Act(engine, hand, ACTION_CALL);    // Seat 0 checks
+    Act(engine, hand, ACTION_RAISE);   // Seat 1 continuation bets
+    Act(engine, hand, ACTION_FOLD);    // Seat 2 folds to it
+    Act(engine, hand, ACTION_CALL);    // Seat 0 calls it
+    while (engine.IsBetting()) Act(engine, hand, ACTION_CALL);   // Checked down
+    engine.ResolveShowdown();
+    hand.EndHand(engine);
+
+    OpponentStats s0, s1, s2;
+    REQUIRE(stats.Lookup(TEST_IDS[0], s0));
+    REQUIRE(stats.Lookup(TEST_IDS[1], s1));
+    REQUIRE(stats.Lookup(TEST_IDS[2], s2));
+    REQUIRE(stats.GetPlayerCount() == 3);
+
+    SECTION("Preflop") {
+        REQUIRE(s0.GetHands() == 1);
+        REQUIRE(s0.Get(STAT_VPIP) == 1);
+        REQUIRE(s0.Get(STAT_PFR) == 0);
+        REQUIRE(s0.Get(STAT_THREE_BET_CHANCES) == 1);
+        REQUIRE(s0.Get(STAT_THREE_BETS) == 0);
+
+        REQUIRE(s1.Get(STAT_VPIP) == 1);
+        REQUIRE(s1.Get(STAT_PFR) == 1);
+        REQUIRE(s1.Get(STAT_THREE_BET_CHANCES) == 1);
+        REQUIRE(s1.Get(STAT_THREE_BETS) == 1);
+        REQUIRE(s1.ThreeBet() == 1.0f);
+
+        // The opener never faced a single raise
+        REQUIRE(s2.Get(STAT_PFR) == 1);
+        REQUIRE(s2.Get(STAT_THREE_BET_CHANCES) == 0);
+    }
+
+    SECTION("Continuation bets") {
+        REQUIRE(s1.Get(STAT_CBETS_FACED) == 0);
+        REQUIRE(s2.Get(STAT_CBETS_FACED) == 1);
+        REQUIRE(s2.Get(STAT_CBET_FOLDS) == 1);
+        REQUIRE(s0.Get(STAT_CBETS_FACED) == 1);
+        REQUIRE(s0.Get(STAT_CBET_FOLDS) == 0);
+        REQUIRE(s2.FoldToCBet() == 1.0f);
+    }
+
+    SECTION("Aggression and showdowns") {
+        // Checks count as neither
+        REQUIRE(s0.Get(STAT_PASSIVE) == 3);
+        REQUIRE(s0.Get(STAT_AGGRESSIVE) == 0);
+        REQUIRE(s1.Get(STAT_AGGRESSIVE) == 2);
+        REQUIRE(s1.Get(STAT_PASSIVE) == 0);
+        REQUIRE(s2.AggressionFrequency() == 0.5f);
+
+        REQUIRE(s0.Get(STAT_SHOWDOWNS) == 1);
+        REQUIRE(s1.Get(STAT_SHOWDOWNS) == 1);
+        REQUIRE(s2.Get(STAT_SHOWDOWNS) == 0);
+        REQUIRE(s0.Get(STAT_SHOWDOWN_WINS) + s1.Get(STAT_SHOWDOWN_WINS) >= 1);
+    }
+}
+
+TEST_CASE("OpponentStats - Big blind option isn't VPIP", "[opponent_stats]") {
+    OpponentStatsTracker stats;
+    OpponentStatsHand hand(&stats);
+    PokerEngine engine(3);
+    engine.SitDown(0, 1000);
+    engine.SitDown(1, 1000);
+
+    REQUIRE(engine.StartHand());
+    hand.BeginHand(engine, TEST_IDS);
+    while (engine.IsBetting()) Act(engine, hand, ACTION_CALL);
+    engine.ResolveShowdown();
+    hand.EndHand(engine);
+
+    // The small blind limped, the big blind checked its option
+    OpponentStats limper, blind;
+    REQUIRE(stats.Lookup(TEST_IDS[engine.GetSmallBlindSeat()], limper));
+    REQUIRE(stats.Lookup(TEST_IDS[engine.GetBigBlindSeat()], blind));
+    REQUIRE(limper.VPIP() == 1.0f);
+    REQUIRE(limper.Get(STAT_PASSIVE) == 1);
+    REQUIRE(blind.VPIP() == 0.0f);
+    REQUIRE(blind.Get(STAT_PASSIVE) == 0);
+}
+
+TEST_CASE("OpponentStats - Untracked seats", "[opponent_stats]") {
+    OpponentStatsTracker stats;
+    OpponentStatsHand hand(&stats);
+    PokerEngine engine(5);
+    for (int i = 0; i < 3; i++) engine.SitDown(i, 1000);
+
+    uint32_t ids[MAX_SEATS] = {0};
+    ids[1] = 42;
+    REQUIRE(engine.StartHand());
+    hand.BeginHand(engine, ids);
+    while (engine.IsBetting()) Act(engine, hand, ACTION_CALL);
+    engine.ResolveShowdown();
+    hand.EndHand(engine);
+
+    OpponentStats s;
+    REQUIRE(stats.GetPlayerCount() == 1);
+    REQUIRE(stats.Lookup(42, s));
+    REQUIRE(s.GetHands() == 1);
+    REQUIRE_FALSE(stats.Lookup(0, s));
+    REQUIRE_FALSE(stats.Lookup(43, s));
+
+    stats.Clear();
+    REQUIRE(stats.GetPlayerCount() == 0);
+}
+
+TEST_CASE("OpponentStats - Rebuilt from hand history", "[opponent_stats]") {
+    for (const std::string& path : HandHistoryReader::ListSegments(TEST_STATS_HISTORY_BASE)) {
+        std::remove(path.c_str());
+    }
+
+    OpponentStatsTracker live;
+    OpponentStatsHand liveHand(&live);
+    PokerEngine engine(11);
+    for (int i = 0; i < 6; i++) engine.SitDown(i, 1000);
+    {
+        HandHistoryRecorder history;
+        REQUIRE(history.Open(TEST_STATS_HISTORY_BASE));
+        PlayHands(engine, liveHand, &history, 200);
+    }
+
+    OpponentStatsTracker rebuilt;
+    int hands = rebuilt.LoadHistory(TEST_STATS_HISTORY_BASE);
+    REQUIRE(hands > 0);
+
+    uint32_t dealt = 0;
+    for (int i = 0; i < 6; i++) {
+        OpponentStats a, b;
+        REQUIRE(live.Lookup(TEST_IDS[i], a));
+        REQUIRE(rebuilt.Lookup(TEST_IDS[i], b));
+        for (int k = 0; k < OPPONENT_STAT_COUNT; k++) {
+            REQUIRE(a.counts[k] == b.counts[k]);
+        }
+        dealt += a.GetHands();
+    }
+    REQUIRE(dealt >= (uint32_t)hands * 2);
+
+    for (const std::string& path : HandHistoryReader::ListSegments(TEST_STATS_HISTORY_BASE)) {
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("OpponentStats - Tables sharing a tracker", "[opponent_stats]") {
+    static const uint32_t OTHER_IDS[MAX_SEATS] = {201, 202, 203, 204, 205, 206, 207, 208, 209, 210};
+
+    // Each table alone, with its own tracker
+    OpponentStatsTracker aloneA, aloneB;
+    {
+        PokerEngine engineA(21), engineB(22);
+        for (int i = 0; i < 4; i++) {
+            engineA.SitDown(i, 100000);
+            engineB.SitDown(i, 100000);
+        }
+        OpponentStatsHand handA(&aloneA), handB(&aloneB);
+        PlayHands(engineA, handA, nullptr, 300);
+        PlayHands(engineB, handB, nullptr, 300);
+    }
+
+    // Same hands, one shared tracker, actions from the two tables interleaved one by one
+    OpponentStatsTracker shared;
+    PokerEngine engineA(21), engineB(22);
+    for (int i = 0; i < 4; i++) {
+        engineA.SitDown(i, 100000);
+        engineB.SitDown(i, 100000);
+    }
+    OpponentStatsHand handA(&shared), handB(&shared);
+    const uint32_t* ids[2] = {TEST_IDS, OTHER_IDS};
+    PokerEngine* engines[2] = {&engineA, &engineB};
+    OpponentStatsHand* hands[2] = {&handA, &handB};
+    int steps[2] = {0, 0};
+    int played[2] = {0, 0};
+    while (played[0] < 300 || played[1] < 300) {
+        for (int t = 0; t < 2; t++) {
+            PokerEngine& engine = *engines[t];
+            if (played[t] >= 300) continue;
+            if (!engine.IsBetting()) {
+                if (!engine.StartHand()) {
+                    played[t] = 300;
+                    continue;
+                }
+                hands[t]->BeginHand(engine, ids[t]);
+            }
+
+            // Same action cycle as PlayHands, one action per turn
+            if (engine.IsBetting()) {
+                PokerActionType type = ACTION_CALL;
+                if (steps[t] % 7 == 3) type = ACTION_RAISE;
+                if (steps[t] % 11 == 5) type = ACTION_FOLD;
+                steps[t]++;
+                Act(engine, *hands[t], type);
+            }
+
+            if (!engine.IsBetting()) {
+                if (engine.GetPhase() == PHASE_SHOWDOWN) engine.ResolveShowdown();
+                hands[t]->EndHand(engine);
+                played[t]++;
+            }
+        }
+    }
+
+    // Table B's players ran under OTHER_IDS, so compare them against table B alone (TEST_IDS there)
+    for (int i = 0; i < 4; i++) {
+        OpponentStats a, b, sharedA, sharedB;
+        REQUIRE(aloneA.Lookup(TEST_IDS[i], a));
+        REQUIRE(aloneB.Lookup(TEST_IDS[i], b));
+        REQUIRE(shared.Lookup(TEST_IDS[i], sharedA));
+        REQUIRE(shared.Lookup(OTHER_IDS[i], sharedB));
+        for (int k = 0; k < OPPONENT_STAT_COUNT; k++) {
+            REQUIRE(sharedA.counts[k] == a.counts[k]);
+            REQUIRE(sharedB.counts[k] == b.counts[k]);
+        }
+    }
+}
+
+TEST_CASE("OpponentStats - Reads while a table writes", "[opponent_stats]") {
+    OpponentStatsTracker stats;
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+
+    // Counters that move together must never be seen apart
+    std::thread reader([&] {
+        OpponentStats s;
+        while (!done.load()) {
+            for (int i = 0; i < 6; i++) {
+                if (!stats.Lookup(TEST_IDS[i], s)) continue;
+                if (s.Get(STAT_VPIP) > s.GetHands() || s.Get(STAT_PFR) > s.Get(STAT_VPIP) ||
+                    s.Get(STAT_CBET_FOLDS) > s.Get(STAT_CBETS_FACED) ||
+                    s.Get(STAT_SHOWDOWN_WINS) > s.Get(STAT_SHOWDOWNS)) {
+                    torn++;
+                }
+            }
+        }
+    });
+
+    PokerEngine engine(13);
+    for (int i = 0; i < 6; i++) engine.SitDown(i, 100000);
+    OpponentStatsHand hand(&stats);
+    PlayHands(engine, hand, nullptr, 5000);
+    done = true;
+    reader.join();
+
+    REQUIRE(torn.load() == 0);
+    OpponentStats s;
+    REQUIRE(stats.Lookup(TEST_IDS[0], s));
+    REQUIRE(s.GetHands() > 0);
+}
+
+TEST_CASE("OpponentStats - Exploitative adjustments", "[opponent_stats]") {
+    BettingAIParams base;
+    OpponentStats profile;
+
+    SECTION("Too few hands changes nothing") {
+        profile.counts[STAT_HANDS] = OPPONENT_STATS_MIN_HANDS - 1;
+        profile.counts[STAT_CBETS_FACED] = 10;
+        profile.counts[STAT_CBET_FOLDS] = 10;
+        BettingAIParams params = BettingAI::Exploit(profile);
+        REQUIRE(params.raiseFactor == base.raiseFactor);
+        REQUIRE(params.callFactor == base.callFactor);
+    }
+
+    SECTION("Raise lighter into folders") {
+        profile.counts[STAT_HANDS] = 100;
+        profile.counts[STAT_CBETS_FACED] = 20;
+        profile.counts[STAT_CBET_FOLDS] = 18;
+        REQUIRE(BettingAI::Exploit(profile).raiseFactor < base.raiseFactor);
+    }
+
+    SECTION("Call lighter against aggression") {
+        profile.counts[STAT_HANDS] = 100;
+        profile.counts[STAT_AGGRESSIVE] = 80;
+        profile.counts[STAT_PASSIVE] = 20;
+        BettingAIParams params = BettingAI::Exploit(profile);
+        REQUIRE(params.callFactor < 1.0);
+
+        // Equity just under the pot odds now calls
+        int raiseAmount = 0;
+        REQUIRE(BettingAI::ChooseAction(0.32, 3, 100, 50, 1000, 60, 1000, raiseAmount) == 0);
+        REQUIRE(BettingAI::ChooseAction(0.32, 3, 100, 50, 1000, 60, 1000, raiseAmount, params) == 1);
+    }
+
+    SECTION("Bigger value raises against loose players") {
+        profile.counts[STAT_HANDS] = 100;
+        profile.counts[STAT_VPIP] = 70;
+        REQUIRE(BettingAI::Exploit(profile).raiseFraction > base.raiseFraction);
+    }
+}
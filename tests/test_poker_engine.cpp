@@ -0,0 +1,483 @@
+#include "catch_amalgamated.hpp"
+
+#include "gameplay/poker_engine.hpp"
+
+// Total chips on the table (stacks + pot) - must never change
+template <class Engine>
+static int TotalChips(const Engine& engine) {
+    int total = engine.GetPot();
+    for (int i = 0; i < engine.GetSeatCount(); i++) {
+        total += engine.GetStack(i);
+    }
+    return total;
+}
+
+// Everyone calls/checks until the hand reaches showdown
+template <class Engine>
+static void CheckDown(Engine& engine) {
+    while (engine.IsBetting()) {
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+    }
+}
+
+TEST_CASE("PokerEngine - Starting a hand", "[poker_engine]") {
+    PokerEngine engine(1);
+
+    SECTION("Needs two players with chips") {
+        REQUIRE_FALSE(engine.StartHand());
+        engine.SitDown(0, 1000);
+        REQUIRE_FALSE(engine.StartHand());
+        engine.SitDown(3, 0);
+        REQUIRE_FALSE(engine.StartHand());
+        engine.SitDown(5, 1000);
+        REQUIRE(engine.StartHand());
+        REQUIRE_FALSE(engine.GetSeat(3).inHand);
+    }
+
+    SECTION("Seats cannot be taken twice") {
+        REQUIRE(engine.SitDown(2, 100));
+        REQUIRE_FALSE(engine.SitDown(2, 100));
+        REQUIRE_FALSE(engine.SitDown(engine.GetSeatCount(), 100));
+    }
+
+    SECTION("Blinds are posted and action starts after the big blind") {
+        engine.SitDown(0, 1000);
+        engine.SitDown(1, 1000);
+        engine.SitDown(2, 1000);
+        REQUIRE(engine.StartHand());
+
+        REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+        REQUIRE(engine.GetSmallBlindSeat() == 0);
+        REQUIRE(engine.GetBigBlindSeat() == 1);
+        REQUIRE(engine.GetPot() == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+        REQUIRE(engine.GetCurrentSeat() == 2);
+        REQUIRE(engine.GetCallAmount(2) == BIG_BLIND_AMOUNT);
+        REQUIRE(engine.GetCallAmount(0) == BIG_BLIND_AMOUNT - SMALL_BLIND_AMOUNT);
+    }
+
+    SECTION("Blind levels change the posted blinds") {
+        engine.SitDown(0, 1000);
+        engine.SitDown(1, 1000);
+        engine.SetBlinds(25, 50);
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetPot() == 75);
+        REQUIRE(engine.GetMinRaise() == 100);
+
+        // Ignored mid-hand
+        engine.SetBlinds(100, 200);
+        REQUIRE(engine.GetBigBlind() == 50);
+    }
+
+    SECTION("Every seat gets two distinct hole cards") {
+        for (int i = 0; i < DEFAULT_TABLE_SEATS; i++) engine.SitDown(i, 100);
+        REQUIRE(engine.StartHand());
+
+        CardMask dealt;
+        for (int i = 0; i < DEFAULT_TABLE_SEATS; i++) {
+            REQUIRE(engine.GetSeat(i).hand.Count() == 2);
+            dealt |= engine.GetSeat(i).hand;
+        }
+        REQUIRE(dealt.Count() == 2 * DEFAULT_TABLE_SEATS);
+    }
+
+    SECTION("Blinds rotate between hands") {
+        engine.SitDown(0, 1000);
+        engine.SitDown(1, 1000);
+        engine.SitDown(2, 1000);
+
+        engine.StartHand();
+        CheckDown(engine);
+        engine.ResolveShowdown();
+
+        engine.StartHand();
+        REQUIRE(engine.GetSmallBlindSeat() == 1);
+        REQUIRE(engine.GetBigBlindSeat() == 2);
+    }
+}
+
+TEST_CASE("PokerEngine - Betting", "[poker_engine]") {
+    PokerEngine engine(2);
+    engine.SitDown(0, 1000);
+    engine.SitDown(1, 1000);
+    engine.SitDown(2, 1000);
+    engine.StartHand();
+
+    SECTION("Folding around awards the pot to the big blind") {
+        engine.ApplyAction(PokerAction(ACTION_FOLD));  // Seat 2
+        engine.ApplyAction(PokerAction(ACTION_FOLD));  // Seat 0 (small blind)
+
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(engine.GetWinnings(1) == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+        REQUIRE(engine.GetStack(1) == 1000 + SMALL_BLIND_AMOUNT);
+        REQUIRE(TotalChips(engine) == 3000);
+    }
+
+    SECTION("Big blind gets an option before the flop") {
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 2
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 0
+        REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+        REQUIRE(engine.GetCurrentSeat() == 1);
+
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 1 checks
+        REQUIRE(engine.GetPhase() == PHASE_FLOP);
+        REQUIRE(engine.GetBoardCount() == 3);
+        REQUIRE(engine.GetCurrentSeat() == 0);  // Small blind acts first after the flop
+    }
+
+    SECTION("A raise reopens the action and each seat raises once per round") {
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 50));  // Seat 2 raises to 50
+        REQUIRE(engine.GetCurrentBet() == 50);
+        REQUIRE_FALSE(engine.CanRaise(2));
+
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 0
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 100));  // Seat 1 re-raises
+        REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+        REQUIRE(engine.GetCurrentSeat() == 2);
+
+        // Seat 2 already raised - a raise turns into a call
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 500));
+        REQUIRE(engine.GetCurrentBet() == 100);
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 0
+        REQUIRE(engine.GetPhase() == PHASE_FLOP);
+        REQUIRE(engine.GetPot() == 300);
+    }
+
+    SECTION("Raises are clamped to the legal range") {
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 1));
+        REQUIRE(engine.GetCurrentBet() == BIG_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 1000000));
+        REQUIRE(engine.GetCurrentBet() == 1000);
+        REQUIRE(engine.GetSeat(0).allIn);
+    }
+
+    SECTION("Checking down reaches showdown and pays out the whole pot") {
+        CheckDown(engine);
+        REQUIRE(engine.GetPhase() == PHASE_SHOWDOWN);
+        REQUIRE(engine.GetBoardCount() == BOARD_SIZE);
+        REQUIRE(engine.GetBoard().Count() == BOARD_SIZE);
+
+        engine.ResolveShowdown();
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(engine.GetPot() == 0);
+        int paid = engine.GetWinnings(0) + engine.GetWinnings(1) + engine.GetWinnings(2);
+        REQUIRE(paid == 3 * BIG_BLIND_AMOUNT);
+        REQUIRE(TotalChips(engine) == 3000);
+    }
+
+    SECTION("Standing up mid-hand folds the seat") {
+        engine.StandUp(2);
+        REQUIRE_FALSE(engine.IsInHand(2));
+        REQUIRE(engine.GetCurrentSeat() == 0);
+
+        engine.ApplyAction(PokerAction(ACTION_FOLD));  // Seat 0
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(engine.GetWinnings(1) == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+    }
+}
+
+TEST_CASE("PokerEngine - Post-flop order", "[poker_engine]") {
+    PokerEngine engine(4);
+
+    SECTION("Three or more: the first live seat from the small blind") {
+        for (int i = 0; i < 4; i++) engine.SitDown(i, 1000);
+        engine.StartHand();
+        REQUIRE(engine.GetSmallBlindSeat() == 0);
+
+        CheckDown(engine);
+        engine.ResolveShowdown();
+
+        // Seat 1 has the small blind; it folds preflop, so the big blind leads
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetSmallBlindSeat() == 1);
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 3
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 0
+        engine.ApplyAction(PokerAction(ACTION_FOLD));  // Seat 1 (small blind)
+        engine.ApplyAction(PokerAction(ACTION_CALL));  // Seat 2 checks
+        REQUIRE(engine.GetPhase() == PHASE_FLOP);
+        REQUIRE(engine.GetCurrentSeat() == 2);
+
+        // Still three-handed, so the last live seat (seat 0) keeps acting last
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        REQUIRE(engine.GetCurrentSeat() == 0);
+    }
+
+    SECTION("Two players: the big blind, on any table size") {
+        engine.SitDown(2, 1000);
+        engine.SitDown(5, 1000);
+        engine.StartHand();
+        REQUIRE(engine.GetSmallBlindSeat() == 2);
+
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        REQUIRE(engine.GetPhase() == PHASE_FLOP);
+        REQUIRE(engine.GetCurrentSeat() == 5);
+    }
+}
+
+TEST_CASE("PokerEngine - Showdown", "[poker_engine]") {
+    PokerEngine engine(3);
+    engine.SitDown(0, 1000);
+    engine.SitDown(1, 1000);
+    engine.StartHand();
+    CheckDown(engine);
+
+    SECTION("Overridden hands decide the winner") {
+        // Seat 1 shows down with a royal flush it picked up somewhere
+        CardMask royal;
+        for (int rank = 8; rank <= 12; rank++) royal.Add(rank);
+        engine.SetHand(1, royal & ~engine.GetBoard());
+        engine.SetHand(0, CardMask());
+        engine.ResolveShowdown();
+
+        REQUIRE(engine.GetWinnings(1) == 2 * BIG_BLIND_AMOUNT);
+        REQUIRE(engine.GetWinnings(0) == 0);
+    }
+
+    SECTION("Equal hands split the pot") {
+        engine.SetHand(0, CardMask());
+        engine.SetHand(1, CardMask());
+        engine.ResolveShowdown();
+        REQUIRE(engine.GetWinnings(0) == BIG_BLIND_AMOUNT);
+        REQUIRE(engine.GetWinnings(1) == BIG_BLIND_AMOUNT);
+    }
+}
+
+TEST_CASE("PokerEngine - All-in", "[poker_engine]") {
+    PokerEngine engine(4);
+    engine.SitDown(0, 100);
+    engine.SitDown(1, 100);
+    engine.StartHand();
+
+    SECTION("Both players all-in runs out the board") {
+        engine.ApplyAction(PokerAction(ACTION_RAISE, 100));  // Seat 0 shoves
+        engine.ApplyAction(PokerAction(ACTION_CALL));        // Seat 1 calls
+        REQUIRE(engine.GetPhase() == PHASE_SHOWDOWN);
+        REQUIRE(engine.GetBoardCount() == BOARD_SIZE);
+
+        engine.ResolveShowdown();
+        REQUIRE(TotalChips(engine) == 200);
+    }
+
+    SECTION("Uneven all-ins build side pots") {
+        PokerEngine sideEngine(6);
+        sideEngine.SitDown(0, 50);
+        sideEngine.SitDown(1, 200);
+        sideEngine.SitDown(2, 400);
+        sideEngine.StartHand();
+
+        // Seat 2 acts first preflop and shoves; the others call all-in
+        while (sideEngine.IsBetting()) {
+            int seat = sideEngine.GetCurrentSeat();
+            sideEngine.ApplyAction(PokerAction(ACTION_RAISE, sideEngine.GetMaxRaise(seat)));
+        }
+        REQUIRE(sideEngine.GetPhase() == PHASE_SHOWDOWN);
+
+        SidePot pots[MAX_POTS];
+        REQUIRE(sideEngine.GetPots(pots) == 3);
+        REQUIRE(pots[0].amount == 150);
+        REQUIRE(pots[1].amount == 300);
+        REQUIRE(pots[2].amount == 200);  // Seat 2's uncalled chips come back to it
+
+        // Shortest stack holds the nuts: it can only win the main pot
+        CardMask royal;
+        for (int rank = 8; rank <= 12; rank++) royal.Add(rank);
+        sideEngine.SetHand(0, royal);
+        sideEngine.SetHand(1, CardMask::FromIndex(NUM_RANKS + 12) | CardMask::FromIndex(2 * NUM_RANKS + 12));
+        sideEngine.SetHand(2, CardMask());
+        sideEngine.ResolveShowdown();
+
+        REQUIRE(sideEngine.GetWinnings(0) == 150);
+        REQUIRE(sideEngine.GetWinnings(1) >= 150);  // Aces can at worst split the side pot
+        REQUIRE(sideEngine.GetWinnings(1) + sideEngine.GetWinnings(2) == 500);
+        REQUIRE(TotalChips(sideEngine) == 650);
+    }
+
+    SECTION("Short blind is all-in from the start") {
+        PokerEngine shortEngine(5);
+        shortEngine.SitDown(0, 1000);
+        shortEngine.SitDown(1, 3);  // Can't cover the big blind
+        shortEngine.StartHand();
+        REQUIRE(shortEngine.GetSeat(1).allIn);
+        REQUIRE(shortEngine.GetPot() == SMALL_BLIND_AMOUNT + 3);
+    }
+}
+
+TEST_CASE("PokerEngine - Determinism and conservation", "[poker_engine]") {
+    SECTION("Same seed deals the same cards") {
+        PokerEngine a(42);
+        PokerEngine b(42);
+        for (int i = 0; i < 4; i++) {
+            a.SitDown(i, 500);
+            b.SitDown(i, 500);
+        }
+        a.StartHand();
+        b.StartHand();
+        CheckDown(a);
+        CheckDown(b);
+        REQUIRE(a.GetBoard() == b.GetBoard());
+        for (int i = 0; i < 4; i++) {
+            REQUIRE(a.GetSeat(i).hand == b.GetSeat(i).hand);
+        }
+    }
+
+    SECTION("Chips are conserved over many scripted hands") {
+        PokerEngine engine(9);
+        for (int i = 0; i < 6; i++) engine.SitDown(i, 200);
+
+        std::mt19937 rng(9);
+        int hands = 0;
+        while (hands < 2000 && engine.StartHand()) {
+            while (engine.IsBetting()) {
+                int seat = engine.GetCurrentSeat();
+                int roll = rng() % 10;
+                if (roll == 0) engine.ApplyAction(PokerAction(ACTION_FOLD));
+                else if (roll == 1) engine.ApplyAction(PokerAction(ACTION_RAISE, engine.GetMinRaise() + rng() % 50));
+                else if (roll == 2) engine.ApplyAction(PokerAction(ACTION_RAISE, engine.GetMaxRaise(seat)));
+                else engine.ApplyAction(PokerAction(ACTION_CALL));
+                REQUIRE(TotalChips(engine) == 1200);
+            }
+            engine.ResolveShowdown();
+            REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+            REQUIRE(TotalChips(engine) == 1200);
+            hands++;
+        }
+        REQUIRE(hands > 1);
+    }
+}
+
+TEST_CASE("PokerEngine - Table sizes", "[poker_engine]") {
+    SECTION("Heads-up: the small blind acts first preflop") {
+        PokerEngineT<2> engine(11);
+        REQUIRE(engine.GetSeatCount() == 2);
+        REQUIRE(engine.SitDown(0, 1000));
+        REQUIRE(engine.SitDown(1, 1000));
+        REQUIRE_FALSE(engine.SitDown(2, 1000));
+
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetSmallBlindSeat() == 0);
+        REQUIRE(engine.GetBigBlindSeat() == 1);
+        REQUIRE(engine.GetCurrentSeat() == 0);
+
+        engine.ApplyAction(PokerAction(ACTION_FOLD));
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(engine.GetWinnings(1) == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+
+        // Button moves to the other seat
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetSmallBlindSeat() == 1);
+
+        // ...and the small blind (the button) acts last on every later street
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        engine.ApplyAction(PokerAction(ACTION_CALL));
+        for (HandPhase street : {PHASE_FLOP, PHASE_TURN, PHASE_RIVER}) {
+            REQUIRE(engine.GetPhase() == street);
+            REQUIRE(engine.GetCurrentSeat() == engine.GetBigBlindSeat());
+            engine.ApplyAction(PokerAction(ACTION_CALL));
+            REQUIRE(engine.GetCurrentSeat() == engine.GetSmallBlindSeat());
+            engine.ApplyAction(PokerAction(ACTION_CALL));
+        }
+        REQUIRE(engine.GetPhase() == PHASE_SHOWDOWN);
+    }
+
+    SECTION("Ten-max deals every seat") {
+        PokerEngineT<10> engine(12);
+        for (int i = 0; i < 10; i++) REQUIRE(engine.SitDown(i, 100));
+        REQUIRE(engine.StartHand());
+
+        CardMask dealt;
+        for (int i = 0; i < 10; i++) dealt |= engine.GetSeat(i).hand;
+        REQUIRE(dealt.Count() == 20);
+        CheckDown(engine);
+        REQUIRE(engine.GetBoardCount() == BOARD_SIZE);
+    }
+
+    SECTION("Empty seats don't change the hand") {
+        // The same six players on a 6-max and a 10-max engine play out identically
+        PokerEngineT<6> small(77);
+        PokerEngineT<10> wide(77);
+        for (int i = 0; i < 6; i++) {
+            small.SitDown(i, 300 + 40 * i);
+            wide.SitDown(i, 300 + 40 * i);
+        }
+
+        std::mt19937 rng(5);
+        for (int h = 0; h < 200 && small.StartHand(); h++) {
+            REQUIRE(wide.StartHand());
+            while (small.IsBetting()) {
+                REQUIRE(wide.GetCurrentSeat() == small.GetCurrentSeat());
+                int roll = rng() % 8;
+                PokerAction action(ACTION_CALL);
+                if (roll == 0) action = PokerAction(ACTION_FOLD);
+                else if (roll == 1) action = PokerAction(ACTION_RAISE, small.GetMinRaise() + rng() % 60);
+                small.ApplyAction(action);
+                wide.ApplyAction(action);
+            }
+            small.ResolveShowdown();
+            wide.ResolveShowdown();
+            REQUIRE(wide.GetBoard() == small.GetBoard());
+            for (int i = 0; i < 6; i++) {
+                REQUIRE(wide.GetStack(i) == small.GetStack(i));
+            }
+        }
+    }
+}
+
+TEST_CASE("PokerEngine - Antes and blind structures", "[poker_engine]") {
+    PokerEngineT<6> engine(21);
+    for (int i = 0; i < 4; i++) engine.SitDown(i, 1000);
+
+    SECTION("Every seat antes before the blinds") {
+        engine.SetBlinds(10, 20, 5);
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetAnte() == 5);
+        REQUIRE(engine.GetPot() == 4 * 5 + 10 + 20);
+
+        // Antes are dead money - calling still owes the full big blind
+        REQUIRE(engine.GetCallAmount(engine.GetCurrentSeat()) == 20);
+        REQUIRE(engine.GetMinRaise() == 40);
+
+        CheckDown(engine);
+        engine.ResolveShowdown();
+        REQUIRE(TotalChips(engine) == 4000);
+    }
+
+    SECTION("A stack smaller than the ante is all-in") {
+        engine.SetStack(2, 3);
+        engine.SetBlinds(10, 20, 5);
+        REQUIRE(engine.StartHand());
+        REQUIRE(engine.GetSeat(2).allIn);
+        REQUIRE(engine.GetSeat(2).totalBet == 3);
+
+        CheckDown(engine);
+        engine.ResolveShowdown();
+        REQUIRE(TotalChips(engine) == 3003);
+    }
+
+    SECTION("Levels advance with the hands played") {
+        BlindStructure structure = BlindStructure::Fixed(5, 10);
+        structure.AddLevel(BlindLevel(10, 20, 2));
+        structure.SetHandsPerLevel(2);
+        engine.SetBlindStructure(structure);
+
+        int bigBlinds[4];
+        for (int h = 0; h < 4; h++) {
+            REQUIRE(engine.StartHand());
+            bigBlinds[h] = engine.GetBigBlind();
+            CheckDown(engine);
+            engine.ResolveShowdown();
+        }
+        REQUIRE(bigBlinds[0] == 10);
+        REQUIRE(bigBlinds[1] == 10);
+        REQUIRE(bigBlinds[2] == 20);
+        REQUIRE(bigBlinds[3] == 20);
+        REQUIRE(engine.GetAnte() == 2);
+    }
+
+    SECTION("Invalid structures are ignored") {
+        engine.SetBlinds(10, 5);
+        REQUIRE(engine.GetBigBlind() == BIG_BLIND_AMOUNT);
+        engine.SetBlinds(5, 10, -1);
+        REQUIRE(engine.GetAnte() == 0);
+    }
+}
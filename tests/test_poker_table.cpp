@@ -1,4 +1,6 @@
 #include "catch_amalgamated.hpp"
+#include <algorithm>
+#include <cstdio>
 #include <string>
 
 #include "gameplay/poker_table.hpp"
@@ -9,6 +11,33 @@
 #include "weapons/pistol.hpp"
 #include "items/inventory.hpp"
 #include "core/dom.hpp"
+#include "raymath.h"
+
+// Person that only answers when told to, counting how often the table asks
+class ManualPerson : public Person {
+public:
+    int prompts;
+    int nextAction;
+
+    ManualPerson(Vector3 pos, const std::string& personName)
+        : Person(pos, personName), prompts(0), nextAction(-1) {}
+
+    int PromptBet(int currentBet, int callAmount, int minRaise, int maxRaise, int& raiseAmount) override {
+        (void)currentBet; (void)callAmount; (void)maxRaise;
+        prompts++;
+        raiseAmount = minRaise;
+        // One answer per Act() - if the table asks again straight away (next street), wait
+        int action = nextAction;
+        nextAction = -1;
+        return action;
+    }
+
+    void Act(int action) {
+        nextAction = action;
+        ResolveBet();
+        nextAction = -1;
+    }
+};
 
 TEST_CASE("PokerTable - Construction", "[poker_table]") {
     SECTION("Create poker table") {
@@ -30,7 +59,7 @@ TEST_CASE("PokerTable - Seating", "[poker_table]") {
     SECTION("Find closest open seat") {
         int seatIndex = table.FindClosestOpenSeat({0, 0, 0});
         REQUIRE(seatIndex >= 0);
-        REQUIRE(seatIndex < MAX_SEATS);
+        REQUIRE(seatIndex < table.GetSeatCount());
     }
 
     SECTION("Seat a player") {
@@ -80,8 +109,9 @@ TEST_CASE("PokerTable - Seating", "[poker_table]") {
         REQUIRE(table.FindSeatIndex(&player3) == 2);
     }
 
-    SECTION("Seat all MAX_SEATS players") {
-        Player players[MAX_SEATS] = {
+    SECTION("Seat all DEFAULT_TABLE_SEATS players") {
+        REQUIRE(table.GetSeatCount() == DEFAULT_TABLE_SEATS);
+        Player players[DEFAULT_TABLE_SEATS] = {
             {{0, 0, 0}, nullptr},
             {{1, 0, 0}, nullptr},
             {{2, 0, 0}, nullptr},
@@ -92,7 +122,7 @@ TEST_CASE("PokerTable - Seating", "[poker_table]") {
             {{7, 0, 0}, nullptr}
         };
 
-        for (int i = 0; i < MAX_SEATS; i++) {
+        for (int i = 0; i < DEFAULT_TABLE_SEATS; i++) {
             bool seated = table.SeatPerson(&players[i], i);
             REQUIRE(seated == true);
         }
@@ -104,6 +134,82 @@ TEST_CASE("PokerTable - Seating", "[poker_table]") {
     }
 }
 
+TEST_CASE("PokerTable - Table sizes", "[poker_table]") {
+    DOM* originalGlobal = DOM::GetGlobal();
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    SECTION("Seats are laid out for the table size") {
+        for (int count : {2, 6, 9, 10}) {
+            PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr, count);
+            REQUIRE(table.GetSeatCount() == count);
+
+            // Every seat is reachable and no two seats share a spot
+            std::vector<Player*> players;
+            for (int i = 0; i < count; i++) {
+                players.push_back(new Player({0, 0, 0}, nullptr));
+                REQUIRE(table.SeatPerson(players.back(), i));
+            }
+            for (int i = 0; i < count; i++) {
+                for (int j = i + 1; j < count; j++) {
+                    REQUIRE(Vector3Distance(players[i]->position, players[j]->position) > 0.5f);
+                }
+            }
+
+            Player extra({0, 0, 0}, nullptr);
+            REQUIRE_FALSE(table.SeatPerson(&extra, count));
+            REQUIRE(table.FindClosestOpenSeat({0, 0, 0}) == -1);
+
+            for (Player* p : players) {
+                table.UnseatPerson(p);
+                delete p;
+            }
+        }
+    }
+
+    SECTION("Sizes are clamped to what the engine supports") {
+        PokerTable tiny({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr, 1);
+        PokerTable huge({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr, MAX_SEATS + 5);
+        REQUIRE(tiny.GetSeatCount() == 2);
+        REQUIRE(huge.GetSeatCount() == MAX_SEATS);
+    }
+
+    SECTION("Mixed table sizes play side by side with their own blinds") {
+        PokerTable headsUp({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr, 2);
+        PokerTable tenMax({10, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr, 10);
+        dom.AddObject(&headsUp);
+        dom.AddObject(&tenMax);
+        tenMax.SetBlindStructure(BlindStructure::Fixed(10, 20, 2));
+
+        std::vector<Enemy*> enemies;
+        for (int i = 0; i < 2 + 3; i++) {
+            Enemy* e = new Enemy({0, 0, 0}, "Enemy" + std::to_string(i));
+            for (int c = 0; c < 5; c++) e->GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+            enemies.push_back(e);
+        }
+        headsUp.SeatPerson(enemies[0], 0);
+        headsUp.SeatPerson(enemies[1], 1);
+        tenMax.SeatPerson(enemies[2], 0);
+        tenMax.SeatPerson(enemies[3], 4);
+        tenMax.SeatPerson(enemies[4], 9);
+
+        headsUp.Update(0.016f);
+        tenMax.Update(0.016f);
+        REQUIRE(headsUp.GetEngine().GetPot() == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+        REQUIRE(tenMax.GetEngine().GetPot() == 3 * 2 + 10 + 20);
+        REQUIRE(tenMax.GetEngine().IsInHand(9));
+
+        for (Enemy* e : enemies) {
+            headsUp.UnseatPerson(e);
+            tenMax.UnseatPerson(e);
+            delete e;
+        }
+    }
+
+    dom.Cleanup();
+    DOM::SetGlobal(originalGlobal);
+}
+
 TEST_CASE("PokerTable - Player Sit/Stand Cycles", "[poker_table]") {
     PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
     Player player({0, 0, 0}, nullptr);
@@ -500,3 +606,312 @@ TEST_CASE("PokerTable - Community Cards Memory Management", "[poker_table][regre
         dom.Cleanup();
     }
 }
+
+TEST_CASE("PokerTable - Engine drives the hand", "[poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+
+    Enemy enemy1({0, 0, 0}, "Player1");
+    Enemy enemy2({1, 0, 0}, "Player2");
+    for (int i = 0; i < 5; i++) {
+        enemy1.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+        enemy2.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    }
+
+    table.SeatPerson(&enemy1, 0);
+    table.SeatPerson(&enemy2, 1);
+
+    SECTION("Hole cards and blinds come from the engine") {
+        table.Update(0.016f);
+
+        const TableEngine& engine = table.GetEngine();
+        REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+        REQUIRE(enemy1.GetInventory()->GetCardMask() == engine.GetSeat(0).hand);
+        REQUIRE(enemy2.GetInventory()->GetCardMask() == engine.GetSeat(1).hand);
+        REQUIRE(engine.GetPot() == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+    }
+
+    SECTION("Inventories and pot always add up to the starting chips") {
+        for (int frame = 0; frame < 200; frame++) {
+            // Skip the enemies' thinking delay
+            enemy1.Update(5.0f);
+            enemy2.Update(5.0f);
+            table.Update(0.016f);
+
+            int total = enemy1.GetInventory()->GetTotalChipValue() +
+                        enemy2.GetInventory()->GetTotalChipValue() +
+                        table.GetEngine().GetPot();
+            REQUIRE(total == 1000);
+        }
+        REQUIRE(table.GetBoardMask().Count() <= BOARD_SIZE);
+    }
+
+    SECTION("Bets adjust inventory stacks in place") {
+        Chip* hundred = static_cast<Chip*>(enemy1.GetInventory()->GetStack(
+            enemy1.GetInventory()->FindChipStack(100))->item);
+
+        table.Update(0.016f);
+
+        // Blinds broke one 100 each; the original chip object still backs the stack
+        Inventory* inv = enemy1.GetInventory();
+        REQUIRE(inv->GetStack(inv->FindChipStack(100))->item == hundred);
+        REQUIRE(inv->GetChipLedger().GetCount(100) == 4);
+        REQUIRE(table.GetPotStack()->GetTotalValue() == SMALL_BLIND_AMOUNT + BIG_BLIND_AMOUNT);
+
+        // Only the pot chips and the new change stacks came from the pool
+        REQUIRE(table.GetChipPool().GetAllocatedCount() <=
+                table.GetPotStack()->GetChipCount() + 2 * CHIP_DENOMINATION_COUNT);
+    }
+
+    SECTION("Pot chips mirror the pot") {
+        for (int frame = 0; frame < 200; frame++) {
+            enemy1.Update(5.0f);
+            enemy2.Update(5.0f);
+            table.Update(0.016f);
+
+            if (table.GetEngine().IsBetting()) {
+                REQUIRE(table.GetPotStack()->GetTotalValue() == table.GetEngine().GetPot());
+            }
+        }
+    }
+
+    SECTION("Finished hands are recorded to the hand history") {
+        REQUIRE(table.StartRecording("test_table_history_tmp"));
+
+        for (int frame = 0; frame < 200; frame++) {
+            enemy1.Update(5.0f);
+            enemy2.Update(5.0f);
+            table.Update(0.016f);
+        }
+        uint64_t recorded = table.GetHistory().GetHandCount();
+        REQUIRE(recorded > 0);
+        table.StopRecording();
+
+        HandHistoryReader reader;
+        REQUIRE(reader.Open(HandHistoryRecorder::SegmentPath("test_table_history_tmp", 0)));
+        HandView hand;
+        uint64_t read = 0;
+        while (reader.Next(hand)) {
+            REQUIRE(hand.header->seatMask == 0x03);
+            REQUIRE(hand.header->actionCount > 0);
+            read++;
+        }
+        REQUIRE(read == recorded);
+        reader.Close();
+        std::remove(HandHistoryRecorder::SegmentPath("test_table_history_tmp", 0).c_str());
+    }
+
+    table.UnseatPerson(&enemy1);
+    table.UnseatPerson(&enemy2);
+    dom.Cleanup();
+}
+
+TEST_CASE("PokerTable - Event-driven betting", "[poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+
+    ManualPerson alice({0, 0, 0}, "Alice");
+    ManualPerson bob({1, 0, 0}, "Bob");
+    for (int i = 0; i < 5; i++) {
+        alice.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+        bob.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    }
+    table.SeatPerson(&alice, 0);
+    table.SeatPerson(&bob, 1);
+
+    table.Update(0.016f);
+    REQUIRE(table.GetState() == TABLE_AWAIT_BET);
+    const TableEngine& engine = table.GetEngine();
+    ManualPerson* first = engine.GetCurrentSeat() == 0 ? &alice : &bob;
+    ManualPerson* second = (first == &alice) ? &bob : &alice;
+
+    SECTION("The seat to act is asked once, not every frame") {
+        for (int frame = 0; frame < 100; frame++) {
+            table.Update(0.016f);
+        }
+        REQUIRE(first->prompts == 1);
+        REQUIRE(second->prompts == 0);
+        REQUIRE(first->HasPendingBet());
+    }
+
+    SECTION("An answer moves the hand on and asks the next seat") {
+        first->Act(1);
+        REQUIRE_FALSE(first->HasPendingBet());
+        REQUIRE(second->HasPendingBet());
+        REQUIRE(second->prompts == 1);
+        REQUIRE(table.GetState() == TABLE_AWAIT_BET);
+    }
+
+    SECTION("A fold ends the hand and the next one is dealt on the next Update") {
+        first->Act(0);
+        REQUIRE(table.GetState() == TABLE_IDLE);
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(alice.GetInventory()->GetTotalChipValue() + bob.GetInventory()->GetTotalChipValue() == 1000);
+
+        table.Update(0.016f);
+        REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+        REQUIRE(table.GetState() == TABLE_AWAIT_BET);
+    }
+
+    SECTION("Leaving while asked cancels the request and finishes the hand") {
+        table.UnseatPerson(first);
+        REQUIRE_FALSE(first->HasPendingBet());
+        REQUIRE(table.GetState() == TABLE_ADVANCE);
+
+        table.Update(0.016f);
+        REQUIRE(engine.GetPhase() == PHASE_COMPLETE);
+        REQUIRE(table.GetState() == TABLE_IDLE);
+
+        // With one seat left nobody gets dealt in
+        table.Update(0.016f);
+        REQUIRE(table.GetState() == TABLE_IDLE);
+        REQUIRE(second->prompts == 0);
+    }
+
+    SECTION("Killing the dealer stops the table") {
+        Person* dealer = nullptr;
+        for (int i = 0; i < dom.GetCount(); i++) {
+            if (dom.GetObject(i)->GetType().find("dealer") != std::string::npos) {
+                dealer = static_cast<Person*>(dom.GetObject(i));
+            }
+        }
+        REQUIRE(dealer != nullptr);
+
+        table.OnPersonKilled(dealer);
+        REQUIRE(table.GetState() == TABLE_STOPPED);
+        REQUIRE_FALSE(first->HasPendingBet());
+        REQUIRE(table.FindSeatIndex(&alice) == -1);
+
+        table.Update(0.016f);
+        REQUIRE(table.GetState() == TABLE_STOPPED);
+        REQUIRE_FALSE(table.SeatPerson(&alice, 0));
+
+        dom.RemoveAndDelete(dealer);
+    }
+
+    table.UnseatPerson(&alice);
+    table.UnseatPerson(&bob);
+    dom.Cleanup();
+}
+
+TEST_CASE("PokerTable - Seated people outlive the table", "[poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    SECTION("A pending bet is cancelled when the table is destroyed") {
+        PokerTable* table = new PokerTable({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+        dom.AddObject(table);
+        ManualPerson alice({0, 0, 0}, "Alice");
+        ManualPerson bob({1, 0, 0}, "Bob");
+        for (int i = 0; i < 5; i++) {
+            alice.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+            bob.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+        }
+        table->SeatPerson(&alice, 0);
+        table->SeatPerson(&bob, 1);
+        table->Update(0.016f);
+        REQUIRE(table->GetState() == TABLE_AWAIT_BET);
+        ManualPerson* first = alice.HasPendingBet() ? &alice : &bob;
+
+        dom.RemoveAndDelete(table);
+        REQUIRE_FALSE(first->HasPendingBet());
+        first->Act(1);  // Nothing left to call back into
+        REQUIRE(first->prompts == 1);
+    }
+
+    SECTION("A card selection can be cancelled") {
+        Player player({0, 0, 0}, nullptr);
+        player.RequestCardSelection([] {});
+        player.selectedCardIndices.push_back(0);
+        REQUIRE(player.cardSelectionUIActive);
+
+        player.CancelCardSelection();
+        REQUIRE_FALSE(player.cardSelectionUIActive);
+        REQUIRE(player.selectedCardIndices.empty());
+    }
+
+    dom.Cleanup();
+}
+
+TEST_CASE("PokerTable - Stats count the action the engine applied", "[poker_table][opponent_stats]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+    OpponentStatsTracker tracker;
+    table.SetStatsTracker(&tracker);
+
+    ManualPerson alice({0, 0, 0}, "Alice");
+    ManualPerson bob({1, 0, 0}, "Bob");
+    for (int i = 0; i < 5; i++) {
+        alice.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+        bob.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    }
+    table.SeatPerson(&alice, 0);
+    table.SeatPerson(&bob, 1);
+
+    table.Update(0.016f);
+    REQUIRE(table.GetState() == TABLE_AWAIT_BET);
+    const TableEngine& engine = table.GetEngine();
+    ManualPerson* first = engine.GetCurrentSeat() == 0 ? &alice : &bob;
+    ManualPerson* second = (first == &alice) ? &bob : &alice;
+
+    // Raise, re-raise, then a second raise from the same seat - the engine plays that one as a call
+    first->Act(2);
+    second->Act(2);
+    REQUIRE(engine.GetPhase() == PHASE_PREFLOP);
+    first->Act(2);
+    REQUIRE(engine.GetLastAction() == ACTION_CALL);
+    REQUIRE(engine.GetPhase() == PHASE_FLOP);
+
+    OpponentStats s1, s2;
+    REQUIRE(tracker.Lookup(OpponentStatsTracker::PlayerId(first->GetName()), s1));
+    REQUIRE(tracker.Lookup(OpponentStatsTracker::PlayerId(second->GetName()), s2));
+    REQUIRE(s1.Get(STAT_AGGRESSIVE) == 1);
+    REQUIRE(s1.Get(STAT_PASSIVE) == 1);
+    REQUIRE(s1.Get(STAT_PFR) == 1);
+    REQUIRE(s2.Get(STAT_AGGRESSIVE) == 1);
+    REQUIRE(s2.Get(STAT_THREE_BETS) == 1);
+
+    table.UnseatPerson(&alice);
+    table.UnseatPerson(&bob);
+    dom.Cleanup();
+}
+
+TEST_CASE("PokerTable - Failed deals are retried on a timer", "[poker_table]") {
+    DOM dom;
+    DOM::SetGlobal(&dom);
+
+    PokerTable table({0, 1, 0}, {4, 0.2f, 2.5f}, BROWN, nullptr);
+    dom.AddObject(&table);
+
+    // Only one of them has chips, so no hand can start
+    ManualPerson alice({0, 0, 0}, "Alice");
+    ManualPerson bob({1, 0, 0}, "Bob");
+    alice.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    table.SeatPerson(&alice, 0);
+    table.SeatPerson(&bob, 1);
+
+    table.Update(0.016f);
+    REQUIRE(table.GetState() == TABLE_IDLE);
+    REQUIRE(table.GetEngine().GetPhase() == PHASE_WAITING);
+
+    // Chips show up between attempts; the deal waits for the retry timer
+    bob.GetInventory()->AddItem(new Chip(100, {0, 0, 0}, nullptr));
+    table.Update(0.016f);
+    REQUIRE(table.GetEngine().GetPhase() == PHASE_WAITING);
+
+    table.Update(TABLE_DEAL_RETRY_SECONDS);
+    REQUIRE(table.GetEngine().GetPhase() == PHASE_PREFLOP);
+
+    table.UnseatPerson(&alice);
+    table.UnseatPerson(&bob);
+    dom.Cleanup();
+}
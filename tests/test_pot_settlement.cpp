@@ -0,0 +1,104 @@
+#include "catch_amalgamated.hpp"
+#include <random>
+
+#include "gameplay/pot_settlement.hpp"
+
+static PotContributions Contributions(std::initializer_list<int> committed, std::initializer_list<bool> live) {
+    PotContributions c;
+    int seat = 0;
+    for (int amount : committed) c.committed[seat++] = amount;
+    seat = 0;
+    for (bool isLive : live) c.live[seat++] = isLive;
+    return c;
+}
+
+TEST_CASE("PotSettlement - Building pots", "[pot_settlement]") {
+    SidePot pots[MAX_POTS];
+
+    SECTION("Equal contributions make a single pot") {
+        PotContributions c = Contributions({100, 100, 100}, {true, true, true});
+        REQUIRE(PotSettlement::BuildPots(c, pots) == 1);
+        REQUIRE(pots[0].amount == 300);
+        REQUIRE(pots[0].eligible == 0x7);
+    }
+
+    SECTION("Short all-ins create side pots") {
+        // Seat 0 all-in for 50, seat 1 all-in for 120, seats 2 and 3 cover 200
+        PotContributions c = Contributions({50, 120, 200, 200}, {true, true, true, true});
+        REQUIRE(PotSettlement::BuildPots(c, pots) == 3);
+        REQUIRE(pots[0].amount == 200);
+        REQUIRE(pots[0].eligible == 0xF);
+        REQUIRE(pots[1].amount == 210);
+        REQUIRE(pots[1].eligible == 0xE);
+        REQUIRE(pots[2].amount == 160);
+        REQUIRE(pots[2].eligible == 0xC);
+    }
+
+    SECTION("Folded chips stay in but their seats can't win") {
+        PotContributions c = Contributions({80, 30, 80}, {true, false, true});
+        REQUIRE(PotSettlement::BuildPots(c, pots) == 1);
+        REQUIRE(pots[0].amount == 190);
+        REQUIRE(pots[0].eligible == 0x5);
+    }
+
+    SECTION("Folded chips above every live level go to the last pot") {
+        PotContributions c = Contributions({40, 100, 60}, {true, false, true});
+        REQUIRE(PotSettlement::BuildPots(c, pots) == 2);
+        REQUIRE(pots[0].amount == 120);
+        REQUIRE(pots[1].amount == 80);
+        REQUIRE(pots[1].eligible == 0x4);
+    }
+}
+
+TEST_CASE("PotSettlement - Paying out", "[pot_settlement]") {
+    HandStrength strengths[MAX_SEATS] = {0};
+
+    SECTION("Short stack wins only the main pot") {
+        PotContributions c = Contributions({50, 200, 200}, {true, true, true});
+        strengths[0] = 300;
+        strengths[1] = 200;
+        strengths[2] = 100;
+
+        int winnings[MAX_SEATS] = {0};
+        REQUIRE(PotSettlement::Settle(c, strengths, 0, winnings) == 450);
+        REQUIRE(winnings[0] == 150);
+        REQUIRE(winnings[1] == 300);
+        REQUIRE(winnings[2] == 0);
+    }
+
+    SECTION("Ties split and odd chips go to the first seat after the button") {
+        PotContributions c = Contributions({25, 25, 25}, {true, true, true});
+        strengths[0] = 100;
+        strengths[1] = 50;
+        strengths[2] = 100;
+
+        int winnings[MAX_SEATS] = {0};
+        PotSettlement::Settle(c, strengths, 1, winnings);
+        REQUIRE(winnings[2] == 38);  // Seat 2 comes first from seat 1
+        REQUIRE(winnings[0] == 37);
+        REQUIRE(winnings[1] == 0);
+    }
+
+    SECTION("Random contributions always pay out everything") {
+        std::mt19937 rng(3);
+        for (int trial = 0; trial < 5000; trial++) {
+            PotContributions c;
+            int total = 0;
+            int liveCount = 0;
+            for (int seat = 0; seat < MAX_SEATS; seat++) {
+                c.committed[seat] = rng() % 4 == 0 ? 0 : rng() % 500;
+                c.live[seat] = (rng() % 3 != 0);
+                strengths[seat] = rng() % 4;
+                total += c.committed[seat];
+                if (c.live[seat]) liveCount++;
+            }
+            if (liveCount == 0) continue;
+
+            int winnings[MAX_SEATS] = {0};
+            REQUIRE(PotSettlement::Settle(c, strengths, rng() % MAX_SEATS, winnings) == total);
+            for (int seat = 0; seat < MAX_SEATS; seat++) {
+                if (!c.live[seat]) REQUIRE(winnings[seat] == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include "catch_amalgamated.hpp"
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include "gameplay/preflop_table.hpp"
+#include "entities/enemy.hpp"
+#include "items/card.hpp"
+
+#define TEST_PREFLOP_PATH "test_preflop_table_tmp.bin"
+
+static CardMask Hole(int cardA, int cardB) {
+    return CardMask::FromIndex(cardA) | CardMask::FromIndex(cardB);
+}
+
+// Writes a table with recognizable values: heads-up = cls / 1000, multiway = cls + opponents / 10
+static bool WriteSyntheticTable(const std::string& path) {
+    std::vector<float> headsUp(PREFLOP_CLASSES * PREFLOP_CLASSES);
+    std::vector<float> multiway(PREFLOP_CLASSES * PREFLOP_MAX_OPPONENTS);
+    for (int cls = 0; cls < PREFLOP_CLASSES; cls++) {
+        for (int vs = 0; vs < PREFLOP_CLASSES; vs++) {
+            headsUp[cls * PREFLOP_CLASSES + vs] = cls / 1000.0f + vs / 1000000.0f;
+        }
+        for (int o = 1; o <= PREFLOP_MAX_OPPONENTS; o++) {
+            multiway[cls * PREFLOP_MAX_OPPONENTS + o - 1] = cls + o / 10.0f;
+        }
+    }
+
+    PreflopTableHeader header;
+    memset(&header, 0, sizeof(header));
+    header.headsUpSamples = 1;
+    header.multiwaySamples = 1;
+    return PreflopTable::Write(path, header, headsUp.data(), multiway.data());
+}
+
+TEST_CASE("PreflopTable - Classes", "[preflop_table]") {
+    SECTION("Every holding maps to one of 169 classes with the right combo counts") {
+        int counts[PREFLOP_CLASSES] = {};
+        for (int a = 0; a < NUM_CARDS; a++) {
+            for (int b = a + 1; b < NUM_CARDS; b++) {
+                int cls = PreflopTable::ClassOf(a, b);
+                REQUIRE(cls >= 0);
+                REQUIRE(cls < PREFLOP_CLASSES);
+                REQUIRE(PreflopTable::ClassOf(b, a) == cls);
+                counts[cls]++;
+            }
+        }
+        for (int cls = 0; cls < PREFLOP_CLASSES; cls++) {
+            int expected = PreflopTable::IsPair(cls) ? 6 : PreflopTable::IsSuited(cls) ? 4 : 12;
+            REQUIRE(counts[cls] == expected);
+        }
+    }
+
+    SECTION("ClassCombos lists exactly the holdings of the class") {
+        for (int cls = 0; cls < PREFLOP_CLASSES; cls++) {
+            int combos[PREFLOP_MAX_COMBOS][2];
+            int count = PreflopTable::ClassCombos(cls, combos);
+            std::set<uint64_t> seen;
+            for (int i = 0; i < count; i++) {
+                REQUIRE(PreflopTable::ClassOf(combos[i][0], combos[i][1]) == cls);
+                seen.insert(Hole(combos[i][0], combos[i][1]).bits);
+            }
+            REQUIRE(static_cast<int>(seen.size()) == count);
+        }
+    }
+
+    SECTION("Names round-trip") {
+        std::set<std::string> names;
+        for (int cls = 0; cls < PREFLOP_CLASSES; cls++) {
+            std::string name = PreflopTable::ClassName(cls);
+            REQUIRE(PreflopTable::ClassFromName(name) == cls);
+            names.insert(name);
+        }
+        REQUIRE(names.size() == PREFLOP_CLASSES);
+
+        // Ace of spades + king of spades / king of hearts (card index = suit * 13 + rank index)
+        REQUIRE(PreflopTable::ClassName(PreflopTable::ClassOf(12, 11)) == "AKs");
+        REQUIRE(PreflopTable::ClassName(PreflopTable::ClassOf(12, 13 + 11)) == "AKo");
+        REQUIRE(PreflopTable::ClassName(PreflopTable::ClassOf(12, 13 + 12)) == "AA");
+        REQUIRE(PreflopTable::ClassFromName("KAs") == -1);
+        REQUIRE(PreflopTable::ClassFromName("AAs") == -1);
+        REQUIRE(PreflopTable::ClassFromName("AK") == -1);
+        REQUIRE(PreflopTable::ClassFromName("X2o") == -1);
+    }
+
+    SECTION("ClassOf a mask needs exactly two cards") {
+        REQUIRE(PreflopTable::ClassOf(Hole(0, 1)) == PreflopTable::ClassFromName("32s"));
+        REQUIRE(PreflopTable::ClassOf(CardMask::FromIndex(5)) == -1);
+        REQUIRE(PreflopTable::ClassOf(Hole(0, 1) | CardMask::FromIndex(2)) == -1);
+    }
+}
+
+TEST_CASE("PreflopTable - MatchupEquity", "[preflop_table]") {
+    int aces = PreflopTable::ClassFromName("AA");
+    int kings = PreflopTable::ClassFromName("KK");
+    int sevenTwo = PreflopTable::ClassFromName("72o");
+    int aceKing = PreflopTable::ClassFromName("AKs");
+
+    SECTION("Known matchups land near their exact values") {
+        REQUIRE(PreflopTable::MatchupEquity(aces, kings, 20000, 1) == Catch::Approx(0.82).margin(0.015));
+        REQUIRE(PreflopTable::MatchupEquity(aces, sevenTwo, 20000, 2) == Catch::Approx(0.88).margin(0.015));
+        REQUIRE(PreflopTable::MatchupEquity(kings, aceKing, 20000, 3) == Catch::Approx(0.66).margin(0.015));
+    }
+
+    SECTION("Same seed, same estimate") {
+        REQUIRE(PreflopTable::MatchupEquity(aceKing, kings, 2000, 7) ==
+                PreflopTable::MatchupEquity(aceKing, kings, 2000, 7));
+    }
+}
+
+TEST_CASE("PreflopTable - File", "[preflop_table]") {
+    std::remove(TEST_PREFLOP_PATH);
+
+    SECTION("Missing file stays unloaded") {
+        PreflopTable table;
+        double equity = -1.0;
+        REQUIRE_FALSE(table.Open(TEST_PREFLOP_PATH));
+        REQUIRE_FALSE(table.IsLoaded());
+        REQUIRE_FALSE(table.Lookup(Hole(12, 25), 1, equity));
+        REQUIRE(equity == -1.0);
+    }
+
+    SECTION("Written values read back through the mapping") {
+        REQUIRE(WriteSyntheticTable(TEST_PREFLOP_PATH));
+
+        PreflopTable table;
+        REQUIRE(table.Open(TEST_PREFLOP_PATH));
+        REQUIRE(table.IsLoaded());
+        REQUIRE(table.HeadsUp(3, 5) == Catch::Approx(0.003005f));
+        REQUIRE(table.Multiway(100, 7) == Catch::Approx(100.7f));
+
+        int aces = PreflopTable::ClassFromName("AA");
+        double equity = 0.0;
+        REQUIRE(table.Lookup(Hole(12, 25), 3, equity));
+        REQUIRE(equity == Catch::Approx(aces + 0.3));
+
+        // Opponent counts outside 1..7 clamp
+        REQUIRE(table.Lookup(Hole(12, 25), 0, equity));
+        REQUIRE(equity == Catch::Approx(aces + 0.1));
+        REQUIRE(table.Lookup(Hole(12, 25), 12, equity));
+        REQUIRE(equity == Catch::Approx(aces + 0.7));
+
+        REQUIRE_FALSE(table.Lookup(CardMask::FromIndex(12), 1, equity));
+
+        table.Close();
+        REQUIRE_FALSE(table.IsLoaded());
+    }
+
+    SECTION("Wrong version or truncated file is rejected") {
+        REQUIRE(WriteSyntheticTable(TEST_PREFLOP_PATH));
+
+        FILE* f = fopen(TEST_PREFLOP_PATH, "r+b");
+        REQUIRE(f != nullptr);
+        uint16_t version = PREFLOP_TABLE_VERSION + 1;
+        fseek(f, 4, SEEK_SET);
+        fwrite(&version, sizeof(version), 1, f);
+        fclose(f);
+
+        PreflopTable table;
+        REQUIRE_FALSE(table.Open(TEST_PREFLOP_PATH));
+
+        // A header alone isn't a table
+        PreflopTableHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = PREFLOP_TABLE_MAGIC;
+        header.version = PREFLOP_TABLE_VERSION;
+        header.classCount = PREFLOP_CLASSES;
+        header.maxOpponents = PREFLOP_MAX_OPPONENTS;
+        header.headerBytes = sizeof(PreflopTableHeader);
+        f = fopen(TEST_PREFLOP_PATH, "wb");
+        REQUIRE(f != nullptr);
+        fwrite(&header, sizeof(header), 1, f);
+        fclose(f);
+        REQUIRE_FALSE(table.Open(TEST_PREFLOP_PATH));
+    }
+
+    std::remove(TEST_PREFLOP_PATH);
+}
+
+TEST_CASE("PreflopTable - Enemy preflop decisions use the global table", "[preflop_table]") {
+    REQUIRE(WriteSyntheticTable(TEST_PREFLOP_PATH));
+    REQUIRE(PreflopTable::GetGlobal()->Open(TEST_PREFLOP_PATH));
+
+    Enemy enemy({0, 0, 0});
+    Card* ace = new Card(SUIT_SPADES, RANK_ACE, {0, 0, 0}, nullptr);
+    Card* king = new Card(SUIT_HEARTS, RANK_KING, {0, 0, 0}, nullptr);
+    enemy.GetInventory()->AddItem(ace);
+    enemy.GetInventory()->AddItem(king);
+
+    TableView view;
+    view.liveOpponents = 2;
+    view.pot = 30;
+    enemy.SetTableView(view);
+
+    int raiseAmount = 0;
+    REQUIRE(enemy.PromptBet(20, 10, 40, 1000, raiseAmount) == -1);   // Starts thinking
+    enemy.Update(5.0f);
+    enemy.PromptBet(20, 10, 40, 1000, raiseAmount);
+
+    // Synthetic values can't come from Monte Carlo, so the table answered
+    REQUIRE(enemy.GetLastEquity() == Catch::Approx(PreflopTable::ClassFromName("AKo") + 0.2));
+
+    PreflopTable::GetGlobal()->Close();
+    std::remove(TEST_PREFLOP_PATH);
+    delete ace;
+    delete king;
+}
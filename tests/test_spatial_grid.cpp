@@ -0,0 +1,174 @@
+#include "catch_amalgamated.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "core/dom.hpp"
+#include "core/rng.hpp"
+#include "core/spatial_grid.hpp"
+#include "items/chip.hpp"
+
+// Object with a settable bounding radius, standing in for walls and people
+class SizedObject : public Object {
+public:
+    float radius;
+    SizedObject(Vector3 pos, float r) : Object(pos), radius(r) {}
+    float GetBoundingRadius() const override { return radius; }
+};
+
+static std::vector<Object*> Scatter(int count, float extent, uint64_t seed) {
+    Rng rng(seed);
+    std::vector<Object*> objects;
+    for (int i = 0; i < count; i++) {
+        Vector3 pos = {(float)(rng.NextDouble() * extent), (float)(rng.NextDouble() * 2.0),
+                       (float)(rng.NextDouble() * extent)};
+        float radius = (i % 50 == 0) ? 3.0f : ((i % 7 == 0) ? 0.6f : 0.0f);
+        objects.push_back(new SizedObject(pos, radius));
+    }
+    return objects;
+}
+
+static std::vector<Object*> Sorted(std::vector<Object*> list) {
+    std::sort(list.begin(), list.end());
+    return list;
+}
+
+// ========== GRID ==========
+
+TEST_CASE("SpatialGrid - Queries match a linear scan", "[spatial_grid]") {
+    std::vector<Object*> objects = Scatter(600, 40.0f, 11);
+    SpatialGrid grid;
+    for (Object* obj : objects) grid.Insert(obj);
+    REQUIRE(grid.GetCount() == 600);
+
+    Rng rng(12);
+    std::vector<Object*> found;
+    for (int q = 0; q < 50; q++) {
+        Vector3 p = {(float)(rng.NextDouble() * 50.0 - 5.0), (float)rng.NextDouble(), (float)(rng.NextDouble() * 50.0 - 5.0)};
+        float yaw = (float)(rng.NextDouble() * 6.283);
+        Vector3 dir = {cosf(yaw), 0.05f, sinf(yaw)};
+        float len = sqrtf(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+        dir = {dir.x / len, dir.y / len, dir.z / len};
+
+        std::vector<Object*> sphere, cone, ray;
+        for (Object* obj : objects) {
+            if (SpatialGrid::SphereTouches(obj, p, 4.0f)) sphere.push_back(obj);
+            if (SpatialGrid::ConeTouches(obj, p, dir, 15.0f, 0.3f)) cone.push_back(obj);
+            if (SpatialGrid::RayTouches(obj, p, dir, 30.0f, 1.0f)) ray.push_back(obj);
+        }
+
+        grid.QuerySphere(p, 4.0f, found);
+        REQUIRE(Sorted(found) == Sorted(sphere));
+        grid.QueryCone(p, dir, 15.0f, 0.3f, found);
+        REQUIRE(Sorted(found) == Sorted(cone));
+        grid.QueryRay(p, dir, 30.0f, 1.0f, found);
+        REQUIRE(Sorted(found) == Sorted(ray));
+    }
+
+    for (Object* obj : objects) delete obj;
+}
+
+TEST_CASE("SpatialGrid - Moving and removing objects", "[spatial_grid]") {
+    SpatialGrid grid;
+    Object a({0, 0, 0});
+    Object b({1, 0, 0});
+    SizedObject wall({50, 0, 0}, 10.0f);
+    grid.Insert(&a);
+    grid.Insert(&b);
+    grid.Insert(&wall);
+
+    std::vector<Object*> found;
+
+    SECTION("Objects are found near where they were inserted") {
+        grid.QuerySphere({0, 0, 0}, 2.0f, found);
+        REQUIRE(found.size() == 2);
+    }
+
+    SECTION("Refresh moves an object to its new cell") {
+        a.position = {20, 0, 20};
+        grid.Refresh(&a);
+        grid.QuerySphere({0, 0, 0}, 2.0f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == &b);
+        grid.QuerySphere({20, 0, 20}, 0.5f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == &a);
+    }
+
+    SECTION("Large objects are found by their bounds, not just their center") {
+        grid.QuerySphere({41, 0, 0}, 0.5f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == &wall);
+    }
+
+    SECTION("Removed objects no longer show up") {
+        grid.Remove(&b);
+        grid.Remove(&wall);
+        REQUIRE(grid.GetCount() == 1);
+        grid.QueryRay({-10, 0, 0}, {1, 0, 0}, 100.0f, 1.0f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == &a);
+    }
+
+    SECTION("Rays stop at the occupied cells") {
+        grid.QueryRay({-10000, 0, 0}, {1, 0, 0}, 20000.0f, 0.5f, found);
+        REQUIRE(found.size() == 3);
+        grid.QueryRay({0, 100, 0}, {1, 0, 0}, 1000.0f, 0.5f, found);
+        REQUIRE(found.empty());
+    }
+}
+
+// ========== DOM ==========
+
+TEST_CASE("DOM - Spatial queries", "[dom][spatial_grid]") {
+    DOM dom;
+    Chip* nearChip = new Chip(5, {2, 0, 0});
+    Chip* farChip = new Chip(10, {30, 0, 0});
+    Object* plain = new Object({1, 0, 0});
+    dom.AddObject(nearChip);
+    dom.AddObject(farChip);
+    dom.AddObject(plain);
+    REQUIRE(dom.IsSpatialIndexEnabled());
+
+    std::vector<Object*> found;
+
+    SECTION("Type filter keeps only matching objects") {
+        dom.QuerySphere({0, 0, 0}, 5.0f, found);
+        REQUIRE(found.size() == 2);
+        dom.QuerySphere({0, 0, 0}, 5.0f, found, TypeBit(TYPE_CHIP));
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == nearChip);
+    }
+
+    SECTION("Linear fallback gives the same answers") {
+        dom.SetSpatialIndexEnabled(false);
+        dom.QueryRay({0, 0, 0}, {1, 0, 0}, 50.0f, 0.5f, found, TypeBit(TYPE_ITEM));
+        REQUIRE(found.size() == 2);
+        dom.QueryCone({0, 0, 0}, {1, 0, 0}, 10.0f, 0.2f, found);
+        REQUIRE(found.size() == 2);
+        dom.SetSpatialIndexEnabled(true);
+        dom.QueryCone({0, 0, 0}, {1, 0, 0}, 10.0f, 0.2f, found);
+        REQUIRE(found.size() == 2);
+    }
+
+    SECTION("UpdateSpatialIndex picks up moved objects") {
+        farChip->position = {1, 0, 1};
+        dom.QuerySphere({0, 0, 0}, 3.0f, found, TypeBit(TYPE_CHIP));
+        REQUIRE(found.size() == 1);
+        dom.UpdateSpatialIndex();
+        dom.QuerySphere({0, 0, 0}, 3.0f, found, TypeBit(TYPE_CHIP));
+        REQUIRE(found.size() == 2);
+    }
+
+    SECTION("Removed objects leave the index") {
+        dom.RemoveObject(nearChip);
+        dom.QuerySphere({0, 0, 0}, 5.0f, found);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == plain);
+        delete nearChip;
+        nearChip = nullptr;
+    }
+
+    for (Object* obj : dom.GetObjects()) delete obj;
+    dom.Cleanup();
+}
@@ -0,0 +1,172 @@
+#include "catch_amalgamated.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "core/dom.hpp"
+#include "entities/dealer.hpp"
+#include "entities/player.hpp"
+#include "items/card.hpp"
+#include "items/chip.hpp"
+#include "items/inventory.hpp"
+#include "rendering/light_bulb.hpp"
+#include "substances/weed.hpp"
+#include "weapons/pistol.hpp"
+
+// ========== ALLOCATION COUNTER ==========
+
+// Replaces global new/delete for the test binary; only counts between StartCounting and StopCounting
+static std::atomic<bool> countingAllocations(false);
+static std::atomic<int> allocationCount(0);
+
+void* operator new(std::size_t size) {
+    if (countingAllocations.load(std::memory_order_relaxed)) allocationCount++;
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+// Kept out of line so the compiler never pairs an inlined free() with a new expression
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    ::operator delete(p);
+}
+
+static void StartCounting() {
+    allocationCount = 0;
+    countingAllocations = true;
+}
+
+static int StopCounting() {
+    countingAllocations = false;
+    return allocationCount.load();
+}
+
+// ========== TYPE IDS ==========
+
+TEST_CASE("Type ids - IsA follows the class hierarchy", "[type_id]") {
+    Pistol pistol;
+    Weed weed;
+    Chip chip(25);
+    Dealer dealer({0, 0, 0});
+    LightBulb bulb({0, 0, 0}, WHITE);
+
+    SECTION("Each class reports its own id") {
+        REQUIRE(pistol.GetTypeId() == TYPE_PISTOL);
+        REQUIRE(weed.GetTypeId() == TYPE_WEED);
+        REQUIRE(chip.GetTypeId() == TYPE_CHIP);
+        REQUIRE(dealer.GetTypeId() == TYPE_DEALER);
+        REQUIRE(bulb.GetTypeId() == TYPE_LIGHT_BULB);
+    }
+
+    SECTION("Ancestors match, siblings do not") {
+        REQUIRE(pistol.IsA<Weapon>());
+        REQUIRE(pistol.IsA<Item>());
+        REQUIRE(pistol.IsA<Interactable>());
+        REQUIRE(pistol.IsA<Object>());
+        REQUIRE_FALSE(pistol.IsA<Person>());
+        REQUIRE_FALSE(pistol.IsA(TYPE_SUBSTANCE));
+
+        REQUIRE(weed.IsA(TYPE_SUBSTANCE));
+        REQUIRE_FALSE(weed.IsA<Weapon>());
+        REQUIRE(dealer.IsA<Person>());
+        REQUIRE_FALSE(dealer.IsA<Player>());
+        REQUIRE(bulb.IsA<Light>());
+        REQUIRE_FALSE(bulb.IsA<Interactable>());
+    }
+
+    SECTION("As casts only to matching types") {
+        Object* obj = &chip;
+        REQUIRE(obj->As<Chip>() == &chip);
+        REQUIRE(obj->As<Item>() == &chip);
+        REQUIRE(obj->As<Card>() == nullptr);
+        REQUIRE(obj->As<Person>() == nullptr);
+    }
+
+    SECTION("Masks agree with the type strings") {
+        REQUIRE(pistol.GetType().find("weapon") != std::string::npos);
+        REQUIRE(bulb.GetType().find("light") != std::string::npos);
+        REQUIRE(dealer.GetType().find("person") != std::string::npos);
+    }
+}
+
+TEST_CASE("Type ids - Inventory stacks by stack key", "[type_id][inventory]") {
+    Inventory inv;
+    Chip five(5), otherFive(5), ten(10);
+    Weed weedA, weedB;
+
+    inv.AddItem(&five);
+    inv.AddItem(&otherFive);
+    inv.AddItem(&ten);
+    inv.AddItem(&weedA);
+    inv.AddItem(&weedB);
+
+    REQUIRE(inv.GetStackCount() == 3);
+    REQUIRE(inv.CountItemsByType(TYPE_CHIP) == 3);
+    REQUIRE(inv.CountItemsByType(TYPE_SUBSTANCE) == 2);
+    REQUIRE(inv.GetIndicesByType(TYPE_CHIP).size() == 2);
+    REQUIRE(inv.GetTotalChipValue() == 20);
+}
+
+// ========== PER-FRAME ALLOCATIONS ==========
+
+TEST_CASE("Type ids - Per-frame type checks do not allocate", "[type_id]") {
+    DOM dom;
+    DOM* originalGlobal = DOM::GetGlobal();
+    DOM::SetGlobal(&dom);
+
+    Player* player = new Player({0, 0, 0}, nullptr);
+    dom.AddObject(player);
+    dom.AddObject(new Dealer({3, 0, 0}));
+    dom.AddObject(new LightBulb({0, 3, 0}, WHITE));
+    for (int i = 0; i < 20; i++) {
+        dom.AddObject(new Chip(5, {(float)i, 0, 2}));
+    }
+
+    Inventory inv;
+    Card ace(SUIT_SPADES, RANK_ACE, {0, 0, 0}, nullptr);
+    Card king(SUIT_HEARTS, RANK_KING, {0, 0, 0}, nullptr);
+    Chip five(5), ten(10);
+    Pistol pistol;
+    inv.AddItem(&ace);
+    inv.AddItem(&king);
+    inv.AddItem(&five);
+    inv.AddItem(&ten);
+    inv.AddItem(&pistol);
+
+    Vector3 rayStart = {0, 1, -5};
+    Vector3 rayDir = {0, 0, 1};
+
+    int lights = 0;
+    int people = 0;
+    auto runFrame = [&]() {
+        for (int i = 0; i < dom.GetCount(); i++) {
+            if (dom.GetObject(i)->As<Light>()) lights++;
+            if (dom.GetObject(i)->IsA<Person>()) people++;
+        }
+        player->GetClosestInteractable();
+        pistol.PerformRaycast(rayStart, rayDir, player);
+        inv.GetTotalChipValue();
+        inv.GetCardMask();
+        inv.GetChipLedger();
+        inv.FindChipStack(10);
+        inv.CountItemsByType(TYPE_CARD);
+    };
+
+    // First frame sizes the reused query buffers; every frame after that must not allocate
+    runFrame();
+    StartCounting();
+    for (int frame = 0; frame < 10; frame++) {
+        runFrame();
+    }
+    int allocations = StopCounting();
+
+    REQUIRE(lights == 11);
+    REQUIRE(people == 22);
+    REQUIRE(allocations == 0);
+
+    DOM::SetGlobal(originalGlobal);
+}
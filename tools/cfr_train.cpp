@@ -0,0 +1,162 @@
+// Offline CFR trainer for the strategy table Enemy maps at startup
+// Runs chance-sampled CFR+ over StrategyTable's bucketed heads-up abstraction on the work-stealing pool,
+// reporting iterations per second and estimated exploitability as it goes, then writes the quantized
+// average strategy (see StrategyTable). Jobs derive their seeds from the master seed and their position,
+// so a run - and a run resumed from a checkpoint - comes out the same regardless of thread count.
+//
+// Usage: ./cfr_trainer [--out FILE] [--iterations N] [--seed X] [--threads T] [--preflop FILE]
+//                      [--bucket-samples N] [--jobs N] [--job-deals N]
+//                      [--checkpoint FILE] [--checkpoint-every N] [--resume FILE]
+//                      [--report-every N] [--exploit-deals N]
+
+#include "core/thread_pool.hpp"
+#include "gameplay/cfr_trainer.hpp"
+#include "gameplay/preflop_table.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define CFR_DEFAULT_ITERATIONS 1000
+#define CFR_DEFAULT_REPORT_EVERY 100
+#define CFR_DEFAULT_CHECKPOINT_EVERY 250
+
+struct TrainOptions {
+    std::string out;
+    int iterations;             // Total, counting any resumed ones
+    int threads;                // 0 = one per hardware thread
+    std::string preflopPath;
+    std::string checkpoint;     // Empty = no checkpoints
+    int checkpointEvery;
+    std::string resume;         // Empty = start fresh
+    int reportEvery;
+    int exploitDeals;           // 0 = skip the exploitability estimate
+    CfrConfig config;
+    PreflopTable preflop;
+
+    TrainOptions()
+        : out(STRATEGY_TABLE_PATH), iterations(CFR_DEFAULT_ITERATIONS), threads(0),
+          checkpointEvery(CFR_DEFAULT_CHECKPOINT_EVERY), reportEvery(CFR_DEFAULT_REPORT_EVERY),
+          exploitDeals(CFR_EXPLOIT_DEALS), config() {}
+};
+
+static void PrintUsage() {
+    fprintf(stderr,
+        "Usage: cfr_trainer [--out FILE] [--iterations N] [--seed X] [--threads T] [--preflop FILE]\n"
+        "                   [--bucket-samples N] [--jobs N] [--job-deals N]\n"
+        "                   [--checkpoint FILE] [--checkpoint-every N] [--resume FILE]\n"
+        "                   [--report-every N] [--exploit-deals N]\n");
+}
+
+static bool ParseOptions(int argc, char** argv, TrainOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) return false;
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(arg, "--out") == 0) options.out = value;
+        else if (strcmp(arg, "--iterations") == 0) options.iterations = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) options.config.seed = strtoull(value, nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0) options.threads = atoi(value);
+        else if (strcmp(arg, "--preflop") == 0) options.preflopPath = value;
+        else if (strcmp(arg, "--bucket-samples") == 0) options.config.bucketSamples = atoi(value);
+        else if (strcmp(arg, "--jobs") == 0) options.config.jobs = atoi(value);
+        else if (strcmp(arg, "--job-deals") == 0) options.config.jobDeals = atoi(value);
+        else if (strcmp(arg, "--checkpoint") == 0) options.checkpoint = value;
+        else if (strcmp(arg, "--checkpoint-every") == 0) options.checkpointEvery = atoi(value);
+        else if (strcmp(arg, "--resume") == 0) options.resume = value;
+        else if (strcmp(arg, "--report-every") == 0) options.reportEvery = atoi(value);
+        else if (strcmp(arg, "--exploit-deals") == 0) options.exploitDeals = atoi(value);
+        else {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.out.empty() || options.iterations < 0 || options.config.bucketSamples < 1 ||
+        options.config.jobs < 1 || options.config.jobDeals < 1 || options.checkpointEvery < 1 ||
+        options.reportEvery < 1 || options.exploitDeals < 0) {
+        fprintf(stderr, "Invalid option values\n");
+        return false;
+    }
+    if (!options.preflopPath.empty() && !options.preflop.Open(options.preflopPath)) {
+        fprintf(stderr, "Could not load preflop table: %s\n", options.preflopPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    TrainOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    CfrTrainer trainer(options.config);
+    if (options.preflop.IsLoaded()) trainer.SetPreflopTable(&options.preflop);
+    if (!options.resume.empty()) {
+        if (!trainer.LoadCheckpoint(options.resume)) {
+            fprintf(stderr, "Could not resume from %s\n", options.resume.c_str());
+            return 1;
+        }
+        fprintf(stderr, "resumed %s at iteration %llu\n", options.resume.c_str(),
+                (unsigned long long)trainer.GetIterations());
+    }
+
+    ThreadPool pool(options.threads);
+    printf("iteration,deals,iterations_per_sec,deals_per_sec,exploitability_mbb,seconds\n");
+
+    auto start = std::chrono::steady_clock::now();
+    double trainSeconds = 0.0;
+    double exploitability = -1.0;
+    uint64_t firstIteration = trainer.GetIterations();
+
+    while (trainer.GetIterations() < (uint64_t)options.iterations) {
+        // Train up to the next report or checkpoint boundary
+        uint64_t done = trainer.GetIterations();
+        uint64_t nextReport = (done / options.reportEvery + 1) * options.reportEvery;
+        uint64_t nextCheckpoint = (done / options.checkpointEvery + 1) * options.checkpointEvery;
+        uint64_t target = std::min<uint64_t>({nextReport, nextCheckpoint, (uint64_t)options.iterations});
+
+        auto before = std::chrono::steady_clock::now();
+        trainer.Train(static_cast<int>(target - done), &pool);
+        trainSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+
+        bool last = target == (uint64_t)options.iterations;
+        if (!options.checkpoint.empty() && (target % options.checkpointEvery == 0 || last)) {
+            if (!trainer.SaveCheckpoint(options.checkpoint)) {
+                fprintf(stderr, "Failed to write checkpoint %s\n", options.checkpoint.c_str());
+            }
+        }
+
+        if (target % options.reportEvery == 0 || last) {
+            // Measured on the same deals every report so the numbers are comparable
+            if (options.exploitDeals > 0) {
+                exploitability = trainer.Exploitability(options.exploitDeals, trainer.GetConfig().seed ^ 0x4558504CULL,
+                                                        &pool);
+            }
+            uint64_t trained = trainer.GetIterations() - firstIteration;
+            double rate = trainSeconds > 0.0 ? trained / trainSeconds : 0.0;
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            printf("%llu,%llu,%.2f,%.0f,%.2f,%.2f\n", (unsigned long long)trainer.GetIterations(),
+                   (unsigned long long)trainer.GetDeals(), rate,
+                   rate * trainer.GetConfig().jobs * trainer.GetConfig().jobDeals, exploitability, elapsed);
+            fflush(stdout);
+        }
+    }
+
+    if (!trainer.WriteTable(options.out, static_cast<float>(exploitability))) {
+        fprintf(stderr, "Failed to write %s\n", options.out.c_str());
+        return 1;
+    }
+    printf("# wrote %s infosets=%d iterations=%llu threads=%d\n", options.out.c_str(), STRATEGY_INFOSETS,
+           (unsigned long long)trainer.GetIterations(), pool.GetThreadCount());
+    return 0;
+}
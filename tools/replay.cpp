@@ -0,0 +1,80 @@
+// Headless hand-history replayer
+// Re-runs every recorded hand through PokerEngine from its deck seed and action stream and checks
+// that the payouts and end stacks come out the same. Exits non-zero on the first mismatching history,
+// so captured hands double as regression tests for the engine and pot settlement.
+//
+// Usage: ./replayer [--verbose] BASE [BASE...]   (BASE as passed to HandHistoryRecorder::Open)
+
+#include "gameplay/hand_replay.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define REPLAY_MAX_REPORTED 20   // Mismatches printed per run
+
+static void PrintUsage() {
+    fprintf(stderr, "Usage: replayer [--verbose] BASE [BASE...]\n");
+}
+
+static void PrintMismatch(const std::string& path, const HandRecord& record, const ReplayResult& result) {
+    printf("MISMATCH %s hand=%llu seed=%llu", path.c_str(), (unsigned long long)record.handId,
+           (unsigned long long)record.deckSeed);
+    if (result.failedAction >= 0) {
+        printf(" failed_action=%d", result.failedAction);
+    }
+    if (result.mismatchSeat >= 0) {
+        int seat = result.mismatchSeat;
+        printf(" seat=%d recorded=%d replayed=%d", seat, record.endStacks[seat], result.endStacks[seat]);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    bool verbose = false;
+    std::vector<std::string> bases;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            PrintUsage();
+            return 1;
+        }
+        if (strcmp(argv[i], "--verbose") == 0) verbose = true;
+        else bases.push_back(argv[i]);
+    }
+    if (bases.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    long long hands = 0;
+    long long mismatches = 0;
+    int segments = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (const std::string& base : bases) {
+        for (const std::string& path : HandHistoryReader::ListSegments(base)) {
+            HandHistoryReader reader;
+            if (!reader.Open(path)) continue;
+            segments++;
+
+            HandView hand;
+            while (reader.Next(hand)) {
+                ReplayResult result = HandReplay::Replay(hand);
+                hands++;
+                if (result.matched) continue;
+
+                mismatches++;
+                if (verbose || mismatches <= REPLAY_MAX_REPORTED) {
+                    PrintMismatch(path, *hand.header, result);
+                }
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("# segments=%d hands=%lld mismatches=%lld seconds=%.4f hands_per_sec=%.1f\n",
+           segments, hands, mismatches, seconds, seconds > 0.0 ? hands / seconds : 0.0);
+    return mismatches == 0 ? 0 : 1;
+}
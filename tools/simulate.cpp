@@ -0,0 +1,406 @@
+// Headless multi-table tournament simulator
+// Runs K independent tables on the work-stealing ThreadPool and prints aggregate results as CSV or JSON.
+// Every table derives its own seed from the master seed, so a run is reproducible regardless of
+// thread count or scheduling order.
+//
+// Usage: ./simulator [--tables K] [--seats N] [--stack S] [--hands H] [--seed X] [--threads T]
+//                    [--players scripted|ai|mixed] [--ai-samples N] [--raise-factor F] [--raise-fraction F]
+//                    [--small-blind B] [--big-blind B] [--ante A] [--blind-levels N] [--format csv|json]
+//                    [--history BASE]   (records every table to BASE_tNNNN.NNNN.phh)
+//                    [--preflop FILE]   (AI looks up preflop equity instead of sampling it)
+//                    [--exploit 0|1]    (AI adjusts to its opponents' stats, tracked per table)
+//                    [--exact-threshold N]  (AI enumerates equity exactly at or below N completions, 0 = never)
+
+#include "core/rng.hpp"
+#include "core/thread_pool.hpp"
+#include "gameplay/betting_ai.hpp"
+#include "gameplay/equity_engine.hpp"
+#include "gameplay/hand_history.hpp"
+#include "gameplay/opponent_stats.hpp"
+#include "gameplay/poker_engine.hpp"
+#include "gameplay/preflop_table.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define SIM_DEFAULT_TABLES 64
+#define SIM_DEFAULT_SEATS 6
+#define SIM_DEFAULT_STACK 1000
+#define SIM_DEFAULT_HANDS 2000       // Per-table cap so a stalled tournament still ends
+#define SIM_DEFAULT_SEED 1
+#define SIM_DEFAULT_AI_SAMPLES 200   // Equity samples per AI decision
+#define SIM_DEFAULT_EXACT_THRESHOLD 1000  // Heads-up rivers only: with 200 samples, exact turns cost ~50x more
+
+enum PlayerKind {
+    PLAYER_SCRIPTED,
+    PLAYER_AI,
+    PLAYER_MIXED            // Even seats AI, odd seats scripted
+};
+
+struct SimOptions {
+    int tables;
+    int seats;
+    int stack;
+    int hands;
+    uint64_t seed;
+    int threads;            // 0 = one per hardware thread
+    PlayerKind players;
+    int aiSamples;
+    int exactThreshold;
+    BettingAIParams ai;
+    int smallBlind;
+    int bigBlind;
+    int ante;
+    int blindLevelHands;    // Double the blinds and ante every N hands (0 = fixed blinds)
+    bool json;
+    std::string historyBase;    // Empty = don't record
+    std::string preflopPath;    // Empty = Monte Carlo preflop too
+    PreflopTable preflop;
+    bool exploit;
+
+    SimOptions()
+        : tables(SIM_DEFAULT_TABLES), seats(SIM_DEFAULT_SEATS), stack(SIM_DEFAULT_STACK),
+          hands(SIM_DEFAULT_HANDS), seed(SIM_DEFAULT_SEED), threads(0), players(PLAYER_SCRIPTED),
+          aiSamples(SIM_DEFAULT_AI_SAMPLES), exactThreshold(SIM_DEFAULT_EXACT_THRESHOLD), ai(), smallBlind(SMALL_BLIND_AMOUNT),
+          bigBlind(BIG_BLIND_AMOUNT), ante(0), blindLevelHands(0), json(false), exploit(false) {}
+};
+
+// Outcome of one table
+struct TableResult {
+    int handsPlayed;
+    int winner;                     // Last seat standing (-1 if the hand cap was hit first)
+    int finalStack[MAX_SEATS];
+    int bustHand[MAX_SEATS];        // Hand number the seat busted on (-1 = survived)
+};
+
+// ========== PLAYERS ==========
+
+// Scripted player: mostly calls, sometimes folds or min-raises (same policy as the engine bench)
+template <class Engine>
+static PokerAction ScriptedAction(const Engine& engine, Rng& rng) {
+    uint32_t roll = rng.Below(10);
+    if (roll == 0) return PokerAction(ACTION_FOLD);
+    if (roll == 1) return PokerAction(ACTION_RAISE, engine.GetMinRaise());
+    return PokerAction(ACTION_CALL);
+}
+
+// AI player: Monte Carlo equity on this thread (no nested pool work) fed into the shared betting rule
+template <class Engine>
+static PokerAction AIAction(const Engine& engine, const SimOptions& options, Rng& rng,
+                            const OpponentStatsTracker* stats, const uint32_t* playerIds) {
+    int seat = engine.GetCurrentSeat();
+    const EngineSeat& s = engine.GetSeat(seat);
+
+    EquityRequest request;
+    request.hole = s.hand;
+    request.board = engine.GetBoard();
+    request.opponents = std::min(engine.GetLiveCount() - 1, EQUITY_MAX_OPPONENTS);
+    request.maxSamples = options.aiSamples;
+    request.exactThreshold = options.exactThreshold;
+    request.seed = rng.Next() | 1u;
+    double equity = 0.0;
+    if (!request.board.IsEmpty() || !options.preflop.Lookup(request.hole, request.opponents, equity)) {
+        equity = EquityEngine::Calculate(request, nullptr).equity;
+    }
+
+    BettingAIParams params = options.ai;
+    if (stats) {
+        uint32_t opponents[MAX_SEATS];
+        int count = 0;
+        for (uint32_t m = engine.GetLiveMask() & ~(1u << seat); m; m &= m - 1) {
+            opponents[count++] = playerIds[__builtin_ctz(m)];
+        }
+        params = BettingAI::Exploit(stats->Profile(opponents, count), options.ai);
+    }
+
+    int raiseAmount = 0;
+    int minRaise = engine.CanRaise(seat) ? engine.GetMinRaise() : engine.GetMaxRaise(seat) + 1;
+    int callAmount = engine.GetCallAmount(seat);
+    int decision = BettingAI::ChooseAction(equity, request.opponents, engine.GetPot(), callAmount, s.stack,
+                                           minRaise, engine.GetMaxRaise(seat), raiseAmount, params);
+
+    // The engine lets short stacks call all-in, so don't fold a good hand just because the bet covers us
+    if (decision == ACTION_FOLD && callAmount > s.stack && equity >= 0.5) {
+        decision = ACTION_CALL;
+    }
+    return PokerAction(static_cast<PokerActionType>(decision), raiseAmount);
+}
+
+static bool IsAISeat(const SimOptions& options, int seat) {
+    if (options.players == PLAYER_AI) return true;
+    if (options.players == PLAYER_MIXED) return (seat % 2) == 0;
+    return false;
+}
+
+// ========== TABLE ==========
+
+template <int Seats>
+static TableResult PlayTable(const SimOptions& options, int table, uint64_t tableSeed) {
+    TableResult result;
+    result.handsPlayed = 0;
+    result.winner = -1;
+    for (int i = 0; i < MAX_SEATS; i++) {
+        result.finalStack[i] = 0;
+        result.bustHand[i] = -1;
+    }
+
+    // Deck and players draw from separate streams of the table seed
+    uint64_t seedState = tableSeed;
+    PokerEngineT<Seats> engine(Rng::SplitMix64(seedState) | 1u);
+    Rng rng(Rng::SplitMix64(seedState));
+    for (int i = 0; i < options.seats; i++) {
+        engine.SitDown(i, options.stack);
+    }
+
+    // Each table writes its own segments, so recording never synchronizes workers
+    HandHistoryRecorder history;
+    if (!options.historyBase.empty()) {
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), "_t%04d", table);
+        history.Open(options.historyBase + suffix);
+    }
+
+    // Seat numbers double as player ids; the tracker is per table like everything else here
+    uint32_t playerIds[MAX_SEATS];
+    for (int i = 0; i < MAX_SEATS; i++) playerIds[i] = i + 1;
+    std::unique_ptr<OpponentStatsTracker> stats;
+    if (options.exploit) stats.reset(new OpponentStatsTracker());
+    OpponentStatsHand statsHand(stats.get());
+
+    engine.SetBlindStructure(BlindStructure::Doubling(options.smallBlind, options.bigBlind, options.ante,
+                                                      options.blindLevelHands));
+
+    for (int hand = 0; hand < options.hands; hand++) {
+        if (!engine.StartHand()) break;  // One player left
+        result.handsPlayed++;
+        history.BeginHand(engine, playerIds);
+        statsHand.BeginHand(engine, playerIds);
+
+        while (engine.IsBetting()) {
+            int seat = engine.GetCurrentSeat();
+            PokerAction action = IsAISeat(options, seat) ? AIAction(engine, options, rng, stats.get(), playerIds)
+                                                         : ScriptedAction(engine, rng);
+            HandPhase phase = engine.GetPhase();
+            engine.ApplyAction(action);
+            action.type = engine.GetLastAction();   // Disallowed raises were played as calls
+            history.RecordAction(seat, phase, action);
+            statsHand.RecordAction(seat, phase, action.type);
+        }
+        if (engine.GetPhase() == PHASE_SHOWDOWN) {
+            engine.ResolveShowdown();
+        }
+        history.EndHand(engine);
+        statsHand.EndHand(engine);
+
+        for (int i = 0; i < options.seats; i++) {
+            if (result.bustHand[i] < 0 && engine.GetStack(i) == 0) {
+                result.bustHand[i] = hand + 1;
+            }
+        }
+    }
+
+    int survivors = 0;
+    for (int i = 0; i < options.seats; i++) {
+        result.finalStack[i] = engine.GetStack(i);
+        if (result.finalStack[i] > 0) {
+            survivors++;
+            result.winner = i;
+        }
+    }
+    if (survivors != 1) result.winner = -1;
+
+    return result;
+}
+
+// Smallest engine build that fits the table (the extra seats just stay empty)
+static TableResult RunTable(const SimOptions& options, int table, uint64_t tableSeed) {
+#define SIM_RUN_TABLE(n) if (options.seats <= n) return PlayTable<n>(options, table, tableSeed);
+    POKER_ENGINE_SEAT_COUNTS(SIM_RUN_TABLE)
+#undef SIM_RUN_TABLE
+    return PlayTable<MAX_SEATS>(options, table, tableSeed);
+}
+
+// ========== OPTIONS ==========
+
+static void PrintUsage() {
+    fprintf(stderr,
+        "Usage: simulator [--tables K] [--seats N] [--stack S] [--hands H] [--seed X] [--threads T]\n"
+        "                 [--players scripted|ai|mixed] [--ai-samples N] [--raise-factor F]\n"
+        "                 [--raise-fraction F] [--small-blind B] [--big-blind B] [--ante A] [--blind-levels N]\n"
+        "                 [--format csv|json] [--history BASE] [--preflop FILE] [--exploit 0|1]\n"
+        "                 [--exact-threshold N]\n");
+}
+
+static bool ParseOptions(int argc, char** argv, SimOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) return false;
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(arg, "--tables") == 0) options.tables = atoi(value);
+        else if (strcmp(arg, "--seats") == 0) options.seats = atoi(value);
+        else if (strcmp(arg, "--stack") == 0) options.stack = atoi(value);
+        else if (strcmp(arg, "--hands") == 0) options.hands = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) options.seed = strtoull(value, nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0) options.threads = atoi(value);
+        else if (strcmp(arg, "--ai-samples") == 0) options.aiSamples = atoi(value);
+        else if (strcmp(arg, "--exact-threshold") == 0) options.exactThreshold = atoi(value);
+        else if (strcmp(arg, "--raise-factor") == 0) options.ai.raiseFactor = atof(value);
+        else if (strcmp(arg, "--raise-fraction") == 0) options.ai.raiseFraction = atof(value);
+        else if (strcmp(arg, "--small-blind") == 0) options.smallBlind = atoi(value);
+        else if (strcmp(arg, "--big-blind") == 0) options.bigBlind = atoi(value);
+        else if (strcmp(arg, "--ante") == 0) options.ante = atoi(value);
+        else if (strcmp(arg, "--blind-levels") == 0) options.blindLevelHands = atoi(value);
+        else if (strcmp(arg, "--history") == 0) options.historyBase = value;
+        else if (strcmp(arg, "--preflop") == 0) options.preflopPath = value;
+        else if (strcmp(arg, "--exploit") == 0) options.exploit = atoi(value) != 0;
+        else if (strcmp(arg, "--players") == 0) {
+            if (strcmp(value, "scripted") == 0) options.players = PLAYER_SCRIPTED;
+            else if (strcmp(value, "ai") == 0) options.players = PLAYER_AI;
+            else if (strcmp(value, "mixed") == 0) options.players = PLAYER_MIXED;
+            else {
+                fprintf(stderr, "Unknown player type: %s\n", value);
+                return false;
+            }
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "csv") == 0) options.json = false;
+            else if (strcmp(value, "json") == 0) options.json = true;
+            else {
+                fprintf(stderr, "Unknown format: %s\n", value);
+                return false;
+            }
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.tables < 1 || options.seats < 2 || options.seats > MAX_SEATS || options.stack < 1 ||
+        options.hands < 1 || options.bigBlind < options.smallBlind || options.smallBlind < 0 ||
+        options.ante < 0 || options.blindLevelHands < 0 || options.exactThreshold < 0) {
+        fprintf(stderr, "Invalid option values\n");
+        return false;
+    }
+    if (!options.preflopPath.empty() && !options.preflop.Open(options.preflopPath)) {
+        fprintf(stderr, "Could not load preflop table: %s\n", options.preflopPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ========== REPORT ==========
+
+// Nearest-rank percentile of a sorted list
+static int Percentile(const std::vector<int>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static void PrintReport(const SimOptions& options, const std::vector<TableResult>& results,
+                        double seconds, int threads) {
+    long long totalHands = 0;
+    int finished = 0;
+    std::vector<int> allStacks;
+    for (const TableResult& r : results) {
+        totalHands += r.handsPlayed;
+        if (r.winner >= 0) finished++;
+        for (int i = 0; i < options.seats; i++) allStacks.push_back(r.finalStack[i]);
+    }
+    std::sort(allStacks.begin(), allStacks.end());
+    double handsPerSec = (seconds > 0.0) ? totalHands / seconds : 0.0;
+
+    const char* players = (options.players == PLAYER_AI) ? "ai" : (options.players == PLAYER_MIXED) ? "mixed" : "scripted";
+
+    if (options.json) {
+        printf("{\n  \"summary\": {\"tables\": %d, \"seats\": %d, \"players\": \"%s\", \"seed\": %llu, "
+               "\"threads\": %d, \"hands\": %lld, \"finished\": %d, \"seconds\": %.4f, \"hands_per_sec\": %.1f, "
+               "\"stack_p10\": %d, \"stack_p50\": %d, \"stack_p90\": %d},\n  \"seats\": [\n",
+               options.tables, options.seats, players, (unsigned long long)options.seed, threads, totalHands,
+               finished, seconds, handsPerSec,
+               Percentile(allStacks, 0.1), Percentile(allStacks, 0.5), Percentile(allStacks, 0.9));
+    } else {
+        printf("# tables=%d seats=%d players=%s seed=%llu threads=%d\n",
+               options.tables, options.seats, players, (unsigned long long)options.seed, threads);
+        printf("# hands=%lld finished=%d seconds=%.4f hands_per_sec=%.1f\n",
+               totalHands, finished, seconds, handsPerSec);
+        printf("# stack_p10=%d stack_p50=%d stack_p90=%d\n",
+               Percentile(allStacks, 0.1), Percentile(allStacks, 0.5), Percentile(allStacks, 0.9));
+        printf("seat,type,mean_stack,min_stack,max_stack,wins,busts,mean_bust_hand\n");
+    }
+
+    for (int seat = 0; seat < options.seats; seat++) {
+        long long stackSum = 0;
+        int minStack = results[0].finalStack[seat];
+        int maxStack = minStack;
+        int wins = 0;
+        int busts = 0;
+        long long bustSum = 0;
+        for (const TableResult& r : results) {
+            stackSum += r.finalStack[seat];
+            minStack = std::min(minStack, r.finalStack[seat]);
+            maxStack = std::max(maxStack, r.finalStack[seat]);
+            if (r.winner == seat) wins++;
+            if (r.bustHand[seat] >= 0) {
+                busts++;
+                bustSum += r.bustHand[seat];
+            }
+        }
+        double meanStack = (double)stackSum / results.size();
+        double meanBust = busts > 0 ? (double)bustSum / busts : 0.0;
+        const char* type = IsAISeat(options, seat) ? "ai" : "scripted";
+
+        if (options.json) {
+            printf("    {\"seat\": %d, \"type\": \"%s\", \"mean_stack\": %.1f, \"min_stack\": %d, \"max_stack\": %d, "
+                   "\"wins\": %d, \"busts\": %d, \"mean_bust_hand\": %.1f}%s\n",
+                   seat, type, meanStack, minStack, maxStack, wins, busts, meanBust,
+                   seat + 1 < options.seats ? "," : "");
+        } else {
+            printf("%d,%s,%.1f,%d,%d,%d,%d,%.1f\n", seat, type, meanStack, minStack, maxStack, wins, busts, meanBust);
+        }
+    }
+
+    if (options.json) printf("  ]\n}\n");
+}
+
+// ========== MAIN ==========
+
+int main(int argc, char** argv) {
+    SimOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    // Seeds are drawn up front in table order, so results don't depend on which worker runs what
+    std::vector<uint64_t> seeds(options.tables);
+    uint64_t seedState = options.seed;
+    for (int t = 0; t < options.tables; t++) {
+        seeds[t] = Rng::SplitMix64(seedState);
+    }
+
+    std::vector<TableResult> results(options.tables);
+    ThreadPool pool(options.threads);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < options.tables; t++) {
+        pool.Submit([&options, &seeds, &results, t] {
+            results[t] = RunTable(options, t, seeds[t]);
+        });
+    }
+    pool.Wait();
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    PrintReport(options, results, seconds, pool.GetThreadCount());
+    return 0;
+}